@@ -3,6 +3,7 @@
 #include "Geometric.hpp"
 #include "Multiples.hpp"
 #include "Prescribed.hpp"
+#include "Sieved.hpp"
 #include "UniformGenerator.hpp"
 
 namespace aleatoric {
@@ -48,4 +49,9 @@ DurationProtocol::createGeometric(Range range, int collectionSize)
 {
     return std::make_unique<Geometric>(range, collectionSize);
 }
+
+std::unique_ptr<DurationProtocol> DurationProtocol::createSieved(Sieve sieve)
+{
+    return std::make_unique<Sieved>(sieve);
+}
 } // namespace aleatoric
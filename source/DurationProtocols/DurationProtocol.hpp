@@ -2,6 +2,7 @@
 #define DurationProtocol_hpp
 
 #include "Range.hpp"
+#include "Sieve.hpp"
 
 #include <memory>
 #include <vector>
@@ -37,6 +38,8 @@ class DurationProtocol {
 
     static std::unique_ptr<DurationProtocol>
     createGeometric(Range range, int collectionSize);
+
+    static std::unique_ptr<DurationProtocol> createSieved(Sieve sieve);
 };
 } // namespace aleatoric
 
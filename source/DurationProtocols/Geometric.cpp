@@ -1,17 +1,26 @@
 #include "Geometric.hpp"
 
+#include "ErrorChecker.hpp"
+
 #include <math.h>
-#include <stdexcept>
 
 namespace aleatoric {
-Geometric::Geometric(Range range, int collectionSize)
-: m_durations(collectionSize), m_range(range)
+Geometric::Geometric(Range range, int collectionSize) : m_range(range)
 {
     if(m_range.start < 1) {
-        throw std::invalid_argument("The range object supplied must have a "
-                                    "start value equal to, or greater than, 1");
+        ErrorChecker::throwInvalidArgument(
+            "The range object supplied must have a start value equal to, or "
+            "greater than, 1");
+    }
+
+    if(collectionSize < 2) {
+        ErrorChecker::throwInvalidArgument(
+            "The collection size supplied must be equal to, or greater than, "
+            "2");
     }
 
+    m_durations.resize(collectionSize);
+
     // calculate the common ratio:
     // pow((m_range.end / m_range.start), (1 / collectionSize - 1))
     double crBase =
@@ -43,10 +52,7 @@ int Geometric::getCollectionSize()
 
 int Geometric::getDuration(int index)
 {
-    // NB: using vector.at() because it will throw out of bounds if index isn't
-    // accessible
-
-    return m_durations.at(index);
+    return ErrorChecker::getElement(m_durations, index);
 }
 
 std::vector<int> Geometric::getSelectableDurations()
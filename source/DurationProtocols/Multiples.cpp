@@ -3,18 +3,17 @@
 #include "ErrorChecker.hpp"
 
 #include <math.h>
-#include <stdexcept>
 
 namespace aleatoric {
 Multiples::Multiples(int baseIncrement, Range range)
 {
     if(baseIncrement < 1) {
-        throw std::invalid_argument(
+        ErrorChecker::throwInvalidArgument(
             "The base increment supplied must be equal to, or greater than, 1");
     }
 
     if(range.start < 1) {
-        throw std::invalid_argument(
+        ErrorChecker::throwInvalidArgument(
             "The range object supplied must have a start value equal to, or "
             "greater than, 1");
     }
@@ -43,13 +42,13 @@ Multiples::Multiples(int baseIncrement,
 Multiples::Multiples(int baseIncrement, std::vector<int> multipliers)
 {
     if(baseIncrement < 1) {
-        throw std::invalid_argument(
+        ErrorChecker::throwInvalidArgument(
             "The base increment supplied must be equal to, or greater than, 1");
     }
 
     for(auto &&i : multipliers) {
         if(i < 1) {
-            throw std::invalid_argument(
+            ErrorChecker::throwInvalidArgument(
                 "The collection passed for the argument multipliers contains "
                 "an invalid value. Values must be equal to, or greater than, "
                 "1");
@@ -85,8 +84,7 @@ int Multiples::getCollectionSize()
 
 int Multiples::getDuration(int index)
 {
-    // NB: using vector.at() because it will throw out of bounds if index isn't
-    // accessible
+    auto duration = ErrorChecker::getElement(m_durations, index);
 
     if(m_hasDeviationFactor) {
         // NB: The deviationFactor is the FULL value EITHER SIDE of the selected
@@ -96,11 +94,11 @@ int Multiples::getDuration(int index)
         // calculate the min-max devFactor around the selected duration
         // e.g. duration = 100, devFactor 0.5 = min: 50, max: 150
         int potentialDeviation =
-            static_cast<int>(round(m_deviationFactor * m_durations.at(index)));
+            static_cast<int>(round(m_deviationFactor * duration));
 
         // round the min-max values and cast to ints
-        int deviationMin = m_durations.at(index) - potentialDeviation;
-        int deviationMax = m_durations.at(index) + potentialDeviation;
+        int deviationMin = duration - potentialDeviation;
+        int deviationMax = duration + potentialDeviation;
 
         // set the generator to the right range
         m_generator->setDistribution(deviationMin, deviationMax);
@@ -109,7 +107,7 @@ int Multiples::getDuration(int index)
         return m_generator->getNumber();
     }
 
-    return m_durations.at(index);
+    return duration;
 }
 
 std::vector<int> Multiples::getSelectableDurations()
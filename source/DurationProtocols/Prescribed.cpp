@@ -1,13 +1,13 @@
 #include "Prescribed.hpp"
 
-#include <stdexcept>
+#include "ErrorChecker.hpp"
 
 namespace aleatoric {
 Prescribed::Prescribed(std::vector<int> durations) : m_durations(durations)
 {
     for(auto &&i : m_durations) {
         if(i < 1) {
-            throw std::invalid_argument(
+            ErrorChecker::throwInvalidArgument(
                 "All durations supplied must be equal to, or greater than, 1");
         }
     }
@@ -23,9 +23,7 @@ int Prescribed::getCollectionSize()
 
 int Prescribed::getDuration(int index)
 {
-    // NB: using vector.at() because it will throw out of bounds if index isn't
-    // accessible
-    return m_durations.at(index);
+    return ErrorChecker::getElement(m_durations, index);
 }
 
 std::vector<int> Prescribed::getSelectableDurations()
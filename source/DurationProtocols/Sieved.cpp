@@ -0,0 +1,34 @@
+#include "Sieved.hpp"
+
+#include "ErrorChecker.hpp"
+
+namespace aleatoric {
+Sieved::Sieved(Sieve sieve) : m_sieve(sieve)
+{
+    if(m_sieve.getRange().start < 1) {
+        ErrorChecker::throwInvalidArgument(
+            "The range of the sieve supplied must have a start value equal "
+            "to, or greater than, 1");
+    }
+}
+
+Sieved::~Sieved()
+{}
+
+int Sieved::getCollectionSize()
+{
+    return m_sieve.getSize();
+}
+
+int Sieved::getDuration(int index)
+{
+    // NB: throws out of range if index isn't accessible, unless built with
+    // ALEATORIC_UNCHECKED_ACCESS
+    return m_sieve.getNumber(index);
+}
+
+std::vector<int> Sieved::getSelectableDurations()
+{
+    return m_sieve.getNumbers();
+}
+} // namespace aleatoric
@@ -0,0 +1,29 @@
+#ifndef Sieved_hpp
+#define Sieved_hpp
+
+#include "DurationProtocol.hpp"
+#include "Sieve.hpp"
+
+namespace aleatoric {
+/*!
+ * @brief Uses the members of a Sieve as the selectable durations
+ *
+ * Durations are read from the sieve by index without being copied out of it,
+ * so very large sieves can be used.
+ */
+class Sieved : public DurationProtocol {
+  public:
+    /*!
+     * @param sieve The range of the sieve must start at 1 or greater.
+     */
+    Sieved(Sieve sieve);
+    ~Sieved();
+    int getCollectionSize() override;
+    int getDuration(int index) override;
+    std::vector<int> getSelectableDurations() override;
+
+  private:
+    Sieve m_sieve;
+};
+} // namespace aleatoric
+#endif /* Sieved_hpp */
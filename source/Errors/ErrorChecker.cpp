@@ -1,6 +1,8 @@
 #include "ErrorChecker.hpp"
 
-#include <stdexcept> // std::invalid_argument
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept> // std::invalid_argument, std::out_of_range
 
 namespace aleatoric {
 ErrorChecker::ErrorChecker()
@@ -12,20 +14,49 @@ void ErrorChecker::checkInitialSelectionInRange(int initialSelection,
                                                 Range const &range)
 {
     if(!range.numberIsInRange(initialSelection)) {
-        throw std::invalid_argument(
+        throwInvalidArgument(
             "The value passed as argument for initialSelection must be "
             "within the range of " +
             std::to_string(range.start) + " to " + std::to_string(range.end));
     }
 }
 
+void ErrorChecker::checkMaxStepIsValid(int maxStep, Range const &range)
+{
+    if(maxStep < 1 || maxStep > range.size) {
+        throwInvalidArgument("The value passed as argument for maxStep "
+                             "must be less than or equal to " +
+                             std::to_string(range.size));
+    }
+}
+
 void ErrorChecker::checkValueWithinUnitInterval(double value,
                                                 std::string argumentName)
 {
     if(value < 0.0 || value > 1.0) {
-        throw std::invalid_argument("The value passed as argument for " +
-                                    argumentName +
-                                    " must be within the range of 0.0 to 1.0");
+        throwInvalidArgument("The value passed as argument for " +
+                             argumentName +
+                             " must be within the range of 0.0 to 1.0");
     }
 }
+
+void ErrorChecker::throwInvalidArgument(const std::string &message)
+{
+#ifdef ALEATORIC_NO_EXCEPTIONS
+    std::fprintf(stderr, "aleatoric: invalid argument: %s\n", message.c_str());
+    std::abort();
+#else
+    throw std::invalid_argument(message);
+#endif
+}
+
+void ErrorChecker::throwOutOfRange(const std::string &message)
+{
+#ifdef ALEATORIC_NO_EXCEPTIONS
+    std::fprintf(stderr, "aleatoric: out of range: %s\n", message.c_str());
+    std::abort();
+#else
+    throw std::out_of_range(message);
+#endif
+}
 } // namespace aleatoric
@@ -4,6 +4,7 @@
 #include "Range.hpp"
 
 #include <string>
+#include <vector>
 
 namespace aleatoric {
 
@@ -15,11 +16,35 @@ class ErrorChecker {
     static void checkInitialSelectionInRange(int initialSelection,
                                              Range const &range);
 
+    // For the Walk protocol and WalkBank
+    static void checkMaxStepIsValid(int maxStep, Range const &range);
+
     // In mathematics, the unit interval is the closed interval [0,1], that is,
     // the set of all real numbers that are greater than or equal to 0 and less
     // than or equal to 1. See https://en.wikipedia.org/wiki/Unit_interval
     static void checkValueWithinUnitInterval(double value,
                                              std::string argumentName);
+
+    // Reports invalid arguments and indices. Throws std::invalid_argument or
+    // std::out_of_range, or, when built with ALEATORIC_NO_EXCEPTIONS, writes
+    // the message to stderr and aborts, as there is nothing to catch.
+    [[noreturn]] static void throwInvalidArgument(const std::string &message);
+
+    [[noreturn]] static void throwOutOfRange(const std::string &message);
+
+    // Returns the element at an index that validation in constructors and
+    // setParams already keeps within the collection, e.g. one produced by a
+    // number protocol whose range was set to the collection. Bounds checked
+    // unless built with ALEATORIC_UNCHECKED_ACCESS.
+    template<typename T>
+    static const T &getElement(const std::vector<T> &collection, int index)
+    {
+#ifdef ALEATORIC_UNCHECKED_ACCESS
+        return collection[index];
+#else
+        return collection.at(index);
+#endif
+    }
 };
 
 } // namespace aleatoric
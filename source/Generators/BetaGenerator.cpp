@@ -0,0 +1,98 @@
+#include "BetaGenerator.hpp"
+
+#include "Engine.hpp"
+#include "ErrorChecker.hpp"
+#include "Ziggurat.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace aleatoric {
+BetaGenerator::BetaGenerator()
+: m_engine(std::make_unique<Engine>()), m_alpha(1.0), m_beta(1.0)
+{}
+
+BetaGenerator::BetaGenerator(double alpha, double beta)
+: m_engine(std::make_unique<Engine>())
+{
+    setDistribution(alpha, beta);
+}
+
+BetaGenerator::~BetaGenerator()
+{}
+
+double BetaGenerator::getNumber()
+{
+    // Gamma numbers of small shapes underflow to 0, so the ratio
+    // first / (first + second) is taken from their logarithms
+    auto logFirst = getLogGammaNumber(m_alpha);
+    auto logSecond = getLogGammaNumber(m_beta);
+    return 1.0 / (1.0 + std::exp(logSecond - logFirst));
+}
+
+void BetaGenerator::getNumbers(double *output, int size)
+{
+    for(int i = 0; i < size; i++) {
+        output[i] = getNumber();
+    }
+}
+
+std::vector<double> BetaGenerator::getNumbers(int size)
+{
+    std::vector<double> numbers(std::max(size, 0));
+    getNumbers(numbers.data(), size);
+    return numbers;
+}
+
+void BetaGenerator::setDistribution(double alpha, double beta)
+{
+    if(!(alpha > 0.0) || !(beta > 0.0)) {
+        ErrorChecker::throwInvalidArgument(
+            "The alpha and beta values must be greater than 0");
+    }
+
+    m_alpha = alpha;
+    m_beta = beta;
+}
+
+std::pair<double, double> BetaGenerator::getDistribution()
+{
+    return std::make_pair(m_alpha, m_beta);
+}
+
+// Private methods
+double BetaGenerator::getLogGammaNumber(double shape)
+{
+    auto &engine = m_engine->getEngine();
+
+    // Marsaglia and Tsang's method needs a shape of at least 1. Smaller shapes
+    // are drawn with the shape increased by 1 and then scaled down by
+    // uniform^(1 / shape), which is added as its logarithm
+    auto logScale = 0.0;
+    if(shape < 1.0) {
+        logScale = std::log(Ziggurat::getUniform(engine)) / shape;
+        shape += 1.0;
+    }
+
+    auto d = shape - 1.0 / 3.0;
+    auto c = 1.0 / std::sqrt(9.0 * d);
+
+    while(true) {
+        double normal;
+        double v;
+        do {
+            normal = Ziggurat::getNormal(engine);
+            v = 1.0 + c * normal;
+        } while(v <= 0.0);
+
+        v = v * v * v;
+        auto uniform = Ziggurat::getUniform(engine);
+        auto squared = normal * normal;
+
+        if(uniform < 1.0 - 0.0331 * squared * squared ||
+           std::log(uniform) < 0.5 * squared + d * (1.0 - v + std::log(v))) {
+            return std::log(d * v) + logScale;
+        }
+    }
+}
+} // namespace aleatoric
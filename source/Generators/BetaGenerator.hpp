@@ -0,0 +1,66 @@
+#ifndef BetaGenerator_hpp
+#define BetaGenerator_hpp
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace aleatoric {
+class Engine;
+/*!
+@brief Implementation class for generating numbers from a beta
+distribution
+
+Uses a [Permuted Congruential Generator -
+PCG](https://github.com/imneme/pcg-cpp) engine. Each number is the ratio of two
+gamma distributed numbers, which are produced with the method of Marsaglia and
+Tsang on top of ziggurat normal numbers. The ratio is computed from the
+logarithms of the gamma numbers, which for small shapes are too small to
+represent. Numbers fall within the range 0 to 1.
+*/
+class BetaGenerator {
+  public:
+    /*!
+     * @brief Constructor
+     *
+     * Creates a generator with both shape parameters set to 1 (a uniform
+     * distribution over 0 to 1).
+     */
+    BetaGenerator();
+
+    /*!
+     * @brief Constructor
+     *
+     * @param alpha the first shape parameter. Must be greater than 0.
+     * @param beta the second shape parameter. Must be greater than 0.
+     */
+    BetaGenerator(double alpha, double beta);
+
+    ~BetaGenerator();
+
+    double getNumber();
+
+    /*!
+     * @brief Fills output with size numbers. Cheaper per number than calling
+     * getNumber() repeatedly.
+     */
+    void getNumbers(double *output, int size);
+
+    std::vector<double> getNumbers(int size);
+
+    void setDistribution(double alpha, double beta);
+
+    /*!
+     * @return alpha and beta
+     */
+    std::pair<double, double> getDistribution();
+
+  private:
+    std::unique_ptr<Engine> m_engine;
+    double m_alpha;
+    double m_beta;
+    double getLogGammaNumber(double shape);
+};
+} // namespace aleatoric
+
+#endif /* BetaGenerator_hpp */
@@ -0,0 +1,72 @@
+#include "CauchyGenerator.hpp"
+
+#include "Engine.hpp"
+#include "ErrorChecker.hpp"
+#include "Ziggurat.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace aleatoric {
+namespace {
+const double pi = 3.14159265358979323846;
+} // namespace
+
+CauchyGenerator::CauchyGenerator()
+: m_engine(std::make_unique<Engine>()), m_location(0.0), m_scale(1.0)
+{}
+
+CauchyGenerator::CauchyGenerator(double location, double scale)
+: m_engine(std::make_unique<Engine>())
+{
+    setDistribution(location, scale);
+}
+
+CauchyGenerator::~CauchyGenerator()
+{}
+
+double CauchyGenerator::getNumber()
+{
+    double number;
+    getNumbers(&number, 1);
+    return number;
+}
+
+void CauchyGenerator::getNumbers(double *output, int size)
+{
+    auto &engine = m_engine->getEngine();
+
+    for(int i = 0; i < size; i++) {
+        output[i] = Ziggurat::getUniform(engine);
+    }
+
+    // The inverse of the cumulative distribution function, kept apart from
+    // the engine loop so that it can be vectorised
+    for(int i = 0; i < size; i++) {
+        auto uniform = output[i];
+        output[i] = m_location + m_scale * std::tan(pi * (uniform - 0.5));
+    }
+}
+
+std::vector<double> CauchyGenerator::getNumbers(int size)
+{
+    std::vector<double> numbers(std::max(size, 0));
+    getNumbers(numbers.data(), size);
+    return numbers;
+}
+
+void CauchyGenerator::setDistribution(double location, double scale)
+{
+    if(!(scale > 0.0)) {
+        ErrorChecker::throwInvalidArgument("The scale must be greater than 0");
+    }
+
+    m_location = location;
+    m_scale = scale;
+}
+
+std::pair<double, double> CauchyGenerator::getDistribution()
+{
+    return std::make_pair(m_location, m_scale);
+}
+} // namespace aleatoric
@@ -0,0 +1,58 @@
+#include "ExponentialGenerator.hpp"
+
+#include "Engine.hpp"
+#include "ErrorChecker.hpp"
+#include "Ziggurat.hpp"
+
+#include <algorithm>
+
+namespace aleatoric {
+ExponentialGenerator::ExponentialGenerator()
+: m_engine(std::make_unique<Engine>()), m_rate(1.0)
+{}
+
+ExponentialGenerator::ExponentialGenerator(double rate)
+: m_engine(std::make_unique<Engine>())
+{
+    setDistribution(rate);
+}
+
+ExponentialGenerator::~ExponentialGenerator()
+{}
+
+double ExponentialGenerator::getNumber()
+{
+    return Ziggurat::getExponential(m_engine->getEngine()) / m_rate;
+}
+
+void ExponentialGenerator::getNumbers(double *output, int size)
+{
+    Ziggurat::getExponentials(m_engine->getEngine(), output, size);
+
+    auto mean = 1.0 / m_rate;
+    for(int i = 0; i < size; i++) {
+        output[i] *= mean;
+    }
+}
+
+std::vector<double> ExponentialGenerator::getNumbers(int size)
+{
+    std::vector<double> numbers(std::max(size, 0));
+    getNumbers(numbers.data(), size);
+    return numbers;
+}
+
+void ExponentialGenerator::setDistribution(double rate)
+{
+    if(!(rate > 0.0)) {
+        ErrorChecker::throwInvalidArgument("The rate must be greater than 0");
+    }
+
+    m_rate = rate;
+}
+
+double ExponentialGenerator::getDistribution()
+{
+    return m_rate;
+}
+} // namespace aleatoric
@@ -0,0 +1,60 @@
+#ifndef ExponentialGenerator_hpp
+#define ExponentialGenerator_hpp
+
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+class Engine;
+/*!
+@brief Implementation class for generating numbers from an exponential
+distribution
+
+Uses a [Permuted Congruential Generator -
+PCG](https://github.com/imneme/pcg-cpp) engine. Numbers are produced with the
+ziggurat method of Marsaglia and Tsang, which in most cases turns a single
+engine output into a number with a table lookup and a multiplication.
+*/
+class ExponentialGenerator {
+  public:
+    /*!
+     * @brief Constructor
+     *
+     * Creates a generator with a rate of 1.
+     */
+    ExponentialGenerator();
+
+    /*!
+     * @brief Constructor
+     *
+     * @param rate the rate (inverse of the mean) of the distribution. Must be
+     * greater than 0.
+     */
+    ExponentialGenerator(double rate);
+
+    ~ExponentialGenerator();
+
+    double getNumber();
+
+    /*!
+     * @brief Fills output with size numbers. Cheaper per number than calling
+     * getNumber() repeatedly.
+     */
+    void getNumbers(double *output, int size);
+
+    std::vector<double> getNumbers(int size);
+
+    void setDistribution(double rate);
+
+    /*!
+     * @return the rate
+     */
+    double getDistribution();
+
+  private:
+    std::unique_ptr<Engine> m_engine;
+    double m_rate;
+};
+} // namespace aleatoric
+
+#endif /* ExponentialGenerator_hpp */
@@ -0,0 +1,60 @@
+#include "GaussianGenerator.hpp"
+
+#include "Engine.hpp"
+#include "ErrorChecker.hpp"
+#include "Ziggurat.hpp"
+
+#include <algorithm>
+
+namespace aleatoric {
+GaussianGenerator::GaussianGenerator()
+: m_engine(std::make_unique<Engine>()), m_mean(0.0), m_standardDeviation(1.0)
+{}
+
+GaussianGenerator::GaussianGenerator(double mean, double standardDeviation)
+: m_engine(std::make_unique<Engine>())
+{
+    setDistribution(mean, standardDeviation);
+}
+
+GaussianGenerator::~GaussianGenerator()
+{}
+
+double GaussianGenerator::getNumber()
+{
+    return m_mean +
+           m_standardDeviation * Ziggurat::getNormal(m_engine->getEngine());
+}
+
+void GaussianGenerator::getNumbers(double *output, int size)
+{
+    Ziggurat::getNormals(m_engine->getEngine(), output, size);
+
+    for(int i = 0; i < size; i++) {
+        output[i] = m_mean + m_standardDeviation * output[i];
+    }
+}
+
+std::vector<double> GaussianGenerator::getNumbers(int size)
+{
+    std::vector<double> numbers(std::max(size, 0));
+    getNumbers(numbers.data(), size);
+    return numbers;
+}
+
+void GaussianGenerator::setDistribution(double mean, double standardDeviation)
+{
+    if(!(standardDeviation > 0.0)) {
+        ErrorChecker::throwInvalidArgument(
+            "The standard deviation must be greater than 0");
+    }
+
+    m_mean = mean;
+    m_standardDeviation = standardDeviation;
+}
+
+std::pair<double, double> GaussianGenerator::getDistribution()
+{
+    return std::make_pair(m_mean, m_standardDeviation);
+}
+} // namespace aleatoric
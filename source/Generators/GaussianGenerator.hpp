@@ -0,0 +1,65 @@
+#ifndef GaussianGenerator_hpp
+#define GaussianGenerator_hpp
+
+#include "IGaussianGenerator.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace aleatoric {
+class Engine;
+/*!
+@brief Implementation class for generating numbers from a normal (Gaussian)
+distribution
+
+Uses a [Permuted Congruential Generator -
+PCG](https://github.com/imneme/pcg-cpp) engine together with the ziggurat method
+of Marsaglia and Tsang, which in most cases turns a single engine output into a
+number with a table lookup and a multiplication.
+*/
+class GaussianGenerator : public IGaussianGenerator {
+  public:
+    /*!
+     * @brief Constructor
+     *
+     * Creates a generator with a mean of 0 and a standard deviation of 1.
+     */
+    GaussianGenerator();
+
+    /*!
+     * @brief Constructor
+     *
+     * @param mean the centre of the distribution
+     * @param standardDeviation the spread of the distribution. Must be greater
+     * than 0.
+     */
+    GaussianGenerator(double mean, double standardDeviation);
+
+    ~GaussianGenerator();
+
+    double getNumber() override;
+
+    /*!
+     * @brief Fills output with size numbers. Cheaper per number than calling
+     * getNumber() repeatedly.
+     */
+    void getNumbers(double *output, int size) override;
+
+    std::vector<double> getNumbers(int size);
+
+    void setDistribution(double mean, double standardDeviation) override;
+
+    /*!
+     * @return the mean and standard deviation
+     */
+    std::pair<double, double> getDistribution() override;
+
+  private:
+    std::unique_ptr<Engine> m_engine;
+    double m_mean;
+    double m_standardDeviation;
+};
+} // namespace aleatoric
+
+#endif /* GaussianGenerator_hpp */
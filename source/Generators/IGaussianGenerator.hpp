@@ -0,0 +1,30 @@
+// Interface
+#ifndef IGaussianGenerator_hpp
+#define IGaussianGenerator_hpp
+
+#include <utility>
+
+namespace aleatoric {
+/*! @brief An interface abstract class from which the GaussianGenerator class
+ * is derived */
+class IGaussianGenerator {
+  public:
+    /*! @brief pure virtual method for returning generated numbers */
+    virtual double getNumber() = 0;
+
+    /*! @brief pure virtual method for filling output with size generated
+     * numbers */
+    virtual void getNumbers(double *output, int size) = 0;
+
+    /*! @brief pure virtual method for setting the mean and standard deviation
+     * of the distribution */
+    virtual void setDistribution(double mean, double standardDeviation) = 0;
+
+    /*! @brief pure virtual method for getting the mean and standard deviation
+     * of the distribution */
+    virtual std::pair<double, double> getDistribution() = 0;
+    virtual ~IGaussianGenerator() = default;
+};
+} // namespace aleatoric
+
+#endif /* IGaussianGenerator_hpp */
@@ -0,0 +1,25 @@
+// Interface
+#ifndef IUniformRealGenerator_hpp
+#define IUniformRealGenerator_hpp
+
+#include <utility>
+
+namespace aleatoric {
+/*! @brief An interface abstract class from which the UniformRealGenerator
+ * class is derived */
+class IUniformRealGenerator {
+  public:
+    /*! @brief pure virtual method for returning generated numbers */
+    virtual double getNumber() = 0;
+
+    /*! @brief pure virtual method for setting the distribution for the uniform
+     * generator */
+    virtual void setDistribution(double rangeStart, double rangeEnd) = 0;
+
+    /*! @brief pure virtual method for getting the range of the distribution */
+    virtual std::pair<double, double> getDistribution() = 0;
+    virtual ~IUniformRealGenerator() = default;
+};
+} // namespace aleatoric
+
+#endif /* IUniformRealGenerator_hpp */
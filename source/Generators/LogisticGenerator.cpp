@@ -0,0 +1,68 @@
+#include "LogisticGenerator.hpp"
+
+#include "Engine.hpp"
+#include "ErrorChecker.hpp"
+#include "Ziggurat.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace aleatoric {
+LogisticGenerator::LogisticGenerator()
+: m_engine(std::make_unique<Engine>()), m_location(0.0), m_scale(1.0)
+{}
+
+LogisticGenerator::LogisticGenerator(double location, double scale)
+: m_engine(std::make_unique<Engine>())
+{
+    setDistribution(location, scale);
+}
+
+LogisticGenerator::~LogisticGenerator()
+{}
+
+double LogisticGenerator::getNumber()
+{
+    double number;
+    getNumbers(&number, 1);
+    return number;
+}
+
+void LogisticGenerator::getNumbers(double *output, int size)
+{
+    auto &engine = m_engine->getEngine();
+
+    for(int i = 0; i < size; i++) {
+        output[i] = Ziggurat::getUniform(engine);
+    }
+
+    // The inverse of the cumulative distribution function, kept apart from
+    // the engine loop so that it can be vectorised
+    for(int i = 0; i < size; i++) {
+        auto uniform = output[i];
+        output[i] = m_location + m_scale * std::log(uniform / (1.0 - uniform));
+    }
+}
+
+std::vector<double> LogisticGenerator::getNumbers(int size)
+{
+    std::vector<double> numbers(std::max(size, 0));
+    getNumbers(numbers.data(), size);
+    return numbers;
+}
+
+void LogisticGenerator::setDistribution(double location, double scale)
+{
+    if(!(scale > 0.0)) {
+        ErrorChecker::throwInvalidArgument("The scale must be greater than 0");
+    }
+
+    m_location = location;
+    m_scale = scale;
+}
+
+std::pair<double, double> LogisticGenerator::getDistribution()
+{
+    return std::make_pair(m_location, m_scale);
+}
+} // namespace aleatoric
@@ -0,0 +1,62 @@
+#ifndef LogisticGenerator_hpp
+#define LogisticGenerator_hpp
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace aleatoric {
+class Engine;
+/*!
+@brief Implementation class for generating numbers from a logistic
+distribution
+
+Uses a [Permuted Congruential Generator -
+PCG](https://github.com/imneme/pcg-cpp) engine. Numbers are produced by
+inverting the cumulative distribution function, which needs a single engine
+output per number.
+*/
+class LogisticGenerator {
+  public:
+    /*!
+     * @brief Constructor
+     *
+     * Creates a generator with a location of 0 and a scale of 1.
+     */
+    LogisticGenerator();
+
+    /*!
+     * @brief Constructor
+     *
+     * @param location the mean of the distribution
+     * @param scale the spread of the distribution. Must be greater than 0.
+     */
+    LogisticGenerator(double location, double scale);
+
+    ~LogisticGenerator();
+
+    double getNumber();
+
+    /*!
+     * @brief Fills output with size numbers. Cheaper per number than calling
+     * getNumber() repeatedly.
+     */
+    void getNumbers(double *output, int size);
+
+    std::vector<double> getNumbers(int size);
+
+    void setDistribution(double location, double scale);
+
+    /*!
+     * @return the location and scale
+     */
+    std::pair<double, double> getDistribution();
+
+  private:
+    std::unique_ptr<Engine> m_engine;
+    double m_location;
+    double m_scale;
+};
+} // namespace aleatoric
+
+#endif /* LogisticGenerator_hpp */
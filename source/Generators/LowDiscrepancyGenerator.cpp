@@ -0,0 +1,57 @@
+#include "LowDiscrepancyGenerator.hpp"
+
+#include <algorithm>
+
+namespace aleatoric {
+LowDiscrepancyGenerator::LowDiscrepancyGenerator(Sequence sequence,
+                                                 int dimension)
+: LowDiscrepancyGenerator(sequence, dimension, 0, 1)
+{}
+
+LowDiscrepancyGenerator::LowDiscrepancyGenerator(Sequence sequence,
+                                                 int dimension,
+                                                 int rangeStart,
+                                                 int rangeEnd)
+: m_generator(sequence, dimension)
+{
+    setDistribution(rangeStart, rangeEnd);
+}
+
+LowDiscrepancyGenerator::~LowDiscrepancyGenerator()
+{}
+
+int LowDiscrepancyGenerator::getNumber()
+{
+    // Numbers from the generator are less than 1, so the offset is less than
+    // the size, but it is clamped in case rounding takes it to the size
+    auto offset = static_cast<long long>(m_generator.getNumber() * m_size);
+    offset = std::min(offset, static_cast<long long>(m_size) - 1);
+    return static_cast<int>(m_rangeStart + offset);
+}
+
+void LowDiscrepancyGenerator::setDistribution(int rangeStart, int rangeEnd)
+{
+    m_rangeStart = rangeStart;
+    m_size = static_cast<double>(rangeEnd) - rangeStart + 1.0;
+}
+
+void LowDiscrepancyGenerator::skip(int count)
+{
+    m_generator.skip(count);
+}
+
+uint32_t LowDiscrepancyGenerator::getIndex()
+{
+    return m_generator.getIndex();
+}
+
+LowDiscrepancyGenerator::Sequence LowDiscrepancyGenerator::getSequence()
+{
+    return m_generator.getSequence();
+}
+
+int LowDiscrepancyGenerator::getDimension()
+{
+    return m_generator.getDimension();
+}
+} // namespace aleatoric
@@ -0,0 +1,76 @@
+#ifndef LowDiscrepancyGenerator_hpp
+#define LowDiscrepancyGenerator_hpp
+
+#include "IUniformGenerator.hpp"
+#include "LowDiscrepancyRealGenerator.hpp"
+
+#include <cstdint>
+
+namespace aleatoric {
+/*!
+@brief Implementation class for generating integers that cover a range evenly,
+from a scrambled low-discrepancy sequence
+
+The integer counterpart of LowDiscrepancyRealGenerator, which describes the
+sequences. Where the size of the range is a power of 2 (Sobol) or of the base
+(Halton), each run of that many numbers from the start of the sequence is a
+permutation of the range. Otherwise the numbers are spread as evenly as the
+size allows.
+
+Can be used in place of UniformGenerator, for example by Basic, to audition a
+range with far fewer numbers.
+*/
+class LowDiscrepancyGenerator : public IUniformGenerator {
+  public:
+    using Sequence = LowDiscrepancyRealGenerator::Sequence;
+
+    /*!
+     * @brief Constructor
+     *
+     * Creates a generator with a range of 0 to 1.
+     *
+     * @param sequence the low-discrepancy sequence to use
+     * @param dimension the dimension of the sequence. Must be between 0 and
+     * 15.
+     */
+    LowDiscrepancyGenerator(Sequence sequence, int dimension = 0);
+
+    /*!
+     * @brief Constructor
+     *
+     * @param sequence the low-discrepancy sequence to use
+     * @param dimension the dimension of the sequence. Must be between 0 and
+     * 15.
+     * @param rangeStart start value for the distribution
+     * @param rangeEnd end value for the distribution (inclusive)
+     */
+    LowDiscrepancyGenerator(Sequence sequence,
+                            int dimension,
+                            int rangeStart,
+                            int rangeEnd);
+
+    ~LowDiscrepancyGenerator();
+
+    int getNumber() override;
+
+    /*! @brief Sets the range of the distribution. The range is inclusive. The
+     * position in the sequence is unaffected. */
+    void setDistribution(int rangeStart, int rangeEnd) override;
+
+    /*! @copydoc LowDiscrepancyRealGenerator::skip() */
+    void skip(int count);
+
+    uint32_t getIndex();
+
+    Sequence getSequence();
+
+    int getDimension();
+
+  private:
+    LowDiscrepancyRealGenerator m_generator;
+    int m_rangeStart;
+    double m_size;
+};
+} // namespace aleatoric
+
+#endif /* LowDiscrepancyGenerator_hpp */
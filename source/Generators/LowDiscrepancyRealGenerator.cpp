@@ -0,0 +1,226 @@
+#include "LowDiscrepancyRealGenerator.hpp"
+
+#include "BitOperations.hpp"
+#include "Engine.hpp"
+#include "ErrorChecker.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+
+namespace aleatoric {
+namespace {
+const int bits = 32;
+
+// The primitive polynomials and initial direction numbers of dimensions 2 to
+// 16 of Joe and Kuo's new-joe-kuo-6.21201. Dimension 1 (here 0) is the van der
+// Corput sequence, which needs neither.
+struct SobolDimension {
+    int degree;
+    uint32_t coefficients;
+    uint32_t initial[6];
+};
+
+const SobolDimension sobolDimensions[] = {{1, 0, {1}},
+                                          {2, 1, {1, 3}},
+                                          {3, 1, {1, 3, 1}},
+                                          {3, 2, {1, 1, 1}},
+                                          {4, 1, {1, 1, 3, 3}},
+                                          {4, 4, {1, 3, 5, 13}},
+                                          {5, 2, {1, 1, 5, 5, 17}},
+                                          {5, 4, {1, 1, 5, 5, 5}},
+                                          {5, 7, {1, 1, 7, 11, 19}},
+                                          {5, 11, {1, 1, 5, 1, 1}},
+                                          {5, 13, {1, 1, 1, 3, 11}},
+                                          {5, 14, {1, 3, 5, 5, 31}},
+                                          {6, 1, {1, 3, 3, 9, 7, 49}},
+                                          {6, 13, {1, 1, 1, 15, 21, 21}},
+                                          {6, 16, {1, 3, 1, 13, 27, 49}}};
+
+const int primes[] = {
+    2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53};
+
+uint32_t reverseBits(uint32_t word)
+{
+    word = ((word >> 1) & 0x55555555) | ((word & 0x55555555) << 1);
+    word = ((word >> 2) & 0x33333333) | ((word & 0x33333333) << 2);
+    word = ((word >> 4) & 0x0f0f0f0f) | ((word & 0x0f0f0f0f) << 4);
+    word = ((word >> 8) & 0x00ff00ff) | ((word & 0x00ff00ff) << 8);
+    return (word >> 16) | (word << 16);
+}
+
+// Each bit of the result depends only on the same and lower bits of the word,
+// so applied to the reversed bits of a number it scrambles each binary digit
+// depending only on the digits above it, which is a nested uniform scramble
+uint32_t hashTowardsHigherBits(uint32_t word, uint32_t seed)
+{
+    word += seed;
+    word ^= word * 0x6c50b47c;
+    word ^= word * 0xb82f1e52;
+    word ^= word * 0xc7afe638;
+    word ^= word * 0x8d22f6e6;
+    return word;
+}
+} // namespace
+
+LowDiscrepancyRealGenerator::LowDiscrepancyRealGenerator(Sequence sequence,
+                                                         int dimension)
+: LowDiscrepancyRealGenerator(sequence, dimension, 0.0, 1.0)
+{}
+
+LowDiscrepancyRealGenerator::LowDiscrepancyRealGenerator(Sequence sequence,
+                                                         int dimension,
+                                                         double rangeStart,
+                                                         double rangeEnd)
+: m_sequence(sequence),
+  m_dimension(dimension),
+  m_range(rangeStart, rangeEnd),
+  m_index(0),
+  m_point(0),
+  m_seed(0),
+  m_base(2)
+{
+    if(dimension < 0 || dimension >= numberOfDimensions) {
+        ErrorChecker::throwInvalidArgument(
+            "The dimension must be between 0 and " +
+            std::to_string(numberOfDimensions - 1));
+    }
+
+    initialise();
+}
+
+LowDiscrepancyRealGenerator::~LowDiscrepancyRealGenerator()
+{}
+
+double LowDiscrepancyRealGenerator::getNumber()
+{
+    auto number = m_sequence == Sequence::sobol ? getSobolNumber()
+                                                : getHaltonNumber();
+    return m_range.first + number * (m_range.second - m_range.first);
+}
+
+void LowDiscrepancyRealGenerator::setDistribution(double rangeStart,
+                                                  double rangeEnd)
+{
+    m_range = std::make_pair(rangeStart, rangeEnd);
+}
+
+std::pair<double, double> LowDiscrepancyRealGenerator::getDistribution()
+{
+    return m_range;
+}
+
+void LowDiscrepancyRealGenerator::skip(int count)
+{
+    if(count < 0) {
+        ErrorChecker::throwInvalidArgument("The count must be 0 or greater");
+    }
+
+    m_index += static_cast<uint32_t>(count);
+    if(m_sequence == Sequence::sobol) {
+        m_point = getSobolPoint(m_index);
+    }
+}
+
+uint32_t LowDiscrepancyRealGenerator::getIndex()
+{
+    return m_index;
+}
+
+LowDiscrepancyRealGenerator::Sequence
+LowDiscrepancyRealGenerator::getSequence()
+{
+    return m_sequence;
+}
+
+int LowDiscrepancyRealGenerator::getDimension()
+{
+    return m_dimension;
+}
+
+// Private methods
+void LowDiscrepancyRealGenerator::initialise()
+{
+    Engine engine;
+    auto &random = engine.getEngine();
+
+    if(m_sequence == Sequence::sobol) {
+        m_directions.resize(bits);
+        if(m_dimension == 0) {
+            for(int i = 0; i < bits; i++) {
+                m_directions[i] = uint32_t(1) << (bits - 1 - i);
+            }
+        } else {
+            auto &polynomial = sobolDimensions[m_dimension - 1];
+            auto degree = polynomial.degree;
+            for(int i = 0; i < degree; i++) {
+                m_directions[i] = polynomial.initial[i] << (bits - 1 - i);
+            }
+            for(int i = degree; i < bits; i++) {
+                auto direction = m_directions[i - degree] ^
+                                 (m_directions[i - degree] >> degree);
+                for(int k = 1; k < degree; k++) {
+                    if((polynomial.coefficients >> (degree - 1 - k)) & 1) {
+                        direction ^= m_directions[i - k];
+                    }
+                }
+                m_directions[i] = direction;
+            }
+        }
+        m_seed = random();
+        m_point = getSobolPoint(m_index);
+        return;
+    }
+
+    // Enough digits to distinguish every index
+    m_base = primes[m_dimension];
+    int digits = 0;
+    for(uint64_t reach = 1; reach <= UINT32_MAX; reach *= m_base) {
+        digits++;
+    }
+    m_permutations.assign(digits, std::vector<int>(m_base));
+    for(auto &&permutation : m_permutations) {
+        std::iota(permutation.begin(), permutation.end(), 0);
+        std::shuffle(permutation.begin(), permutation.end(), random);
+    }
+}
+
+double LowDiscrepancyRealGenerator::getSobolNumber()
+{
+    auto point = reverseBits(
+        hashTowardsHigherBits(reverseBits(m_point), m_seed));
+
+    // Moving along the sequence in Gray code order changes one bit of the
+    // index, so the next point differs from this one by a single direction
+    m_index++;
+    auto direction = BitOperations::countTrailingZeros(m_index);
+    m_point = m_index == 0 ? 0 : m_point ^ m_directions[direction];
+
+    return point * (1.0 / 4294967296.0);
+}
+
+double LowDiscrepancyRealGenerator::getHaltonNumber()
+{
+    auto index = m_index++;
+    auto number = 0.0;
+    auto scale = 1.0 / m_base;
+    for(auto &&permutation : m_permutations) {
+        number += permutation[index % m_base] * scale;
+        index /= m_base;
+        scale /= m_base;
+    }
+    return number;
+}
+
+uint32_t LowDiscrepancyRealGenerator::getSobolPoint(uint32_t index)
+{
+    uint32_t point = 0;
+    auto gray = index ^ (index >> 1);
+    for(int i = 0; gray != 0; i++, gray >>= 1) {
+        if(gray & 1) {
+            point ^= m_directions[i];
+        }
+    }
+    return point;
+}
+} // namespace aleatoric
@@ -0,0 +1,112 @@
+#ifndef LowDiscrepancyRealGenerator_hpp
+#define LowDiscrepancyRealGenerator_hpp
+
+#include "IUniformRealGenerator.hpp"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace aleatoric {
+/*!
+@brief Implementation class for generating numbers that cover a range evenly,
+from a scrambled low-discrepancy sequence
+
+Rather than being independent of one another, successive numbers fill the gaps
+left by those before them. The first 2^k numbers of a Sobol sequence, and the
+first b^k numbers of a Halton sequence in base b, fall one into each of the
+2^k (or b^k) equal parts of the range, so a range is covered evenly after far
+fewer numbers than a uniform random generator needs. Over many numbers the
+distribution is uniform, as it is for UniformRealGenerator.
+
+The sequence is one of:
+- sobol: the Sobol sequence, with the direction numbers of Joe and Kuo. Each
+number is scrambled with a nested uniform (Owen) scramble, computed with a hash
+as described by Laine and Karras, and costs a few integer operations.
+- halton: the Halton sequence, in the base of the dimension's prime. Each digit
+position is scrambled with its own random permutation of the digits.
+
+Scrambling is random, so each instance produces a different sequence with the
+same even coverage.
+
+Generators with the same sequence and different dimensions, drawn in step with
+one another, cover a space of several dimensions evenly, such as when two
+protocols sweep pitch and duration together. There are 16 dimensions,
+numbered from 0.
+*/
+class LowDiscrepancyRealGenerator : public IUniformRealGenerator {
+  public:
+    enum class Sequence { sobol, halton };
+
+    static constexpr int numberOfDimensions = 16;
+
+    /*!
+     * @brief Constructor
+     *
+     * Creates a generator with a range of 0 to 1.
+     *
+     * @param sequence the low-discrepancy sequence to use
+     * @param dimension the dimension of the sequence. Must be between 0 and
+     * 15.
+     */
+    LowDiscrepancyRealGenerator(Sequence sequence, int dimension = 0);
+
+    /*!
+     * @brief Constructor
+     *
+     * @param sequence the low-discrepancy sequence to use
+     * @param dimension the dimension of the sequence. Must be between 0 and
+     * 15.
+     * @param rangeStart start value for the distribution
+     * @param rangeEnd end value for the distribution
+     */
+    LowDiscrepancyRealGenerator(Sequence sequence,
+                                int dimension,
+                                double rangeStart,
+                                double rangeEnd);
+
+    ~LowDiscrepancyRealGenerator();
+
+    double getNumber() override;
+
+    /*! @brief Sets the range of the distribution. The position in the
+     * sequence is unaffected. */
+    void setDistribution(double rangeStart, double rangeEnd) override;
+
+    std::pair<double, double> getDistribution() override;
+
+    /*!
+     * @brief Moves count numbers along the sequence, as if they had been
+     * drawn, at the cost of drawing one. Useful for giving several generators
+     * separate parts of the same sequence.
+     *
+     * @param count Must be 0 or greater.
+     */
+    void skip(int count);
+
+    /*! @return the position in the sequence of the next number, which wraps
+     * around after 2^32 numbers */
+    uint32_t getIndex();
+
+    Sequence getSequence();
+
+    int getDimension();
+
+  private:
+    Sequence m_sequence;
+    int m_dimension;
+    std::pair<double, double> m_range;
+    uint32_t m_index;
+    uint32_t m_point;
+    uint32_t m_seed;
+    std::vector<uint32_t> m_directions;
+    int m_base;
+    std::vector<std::vector<int>> m_permutations;
+    void initialise();
+    double getSobolNumber();
+    double getHaltonNumber();
+    uint32_t getSobolPoint(uint32_t index);
+};
+} // namespace aleatoric
+
+#endif /* LowDiscrepancyRealGenerator_hpp */
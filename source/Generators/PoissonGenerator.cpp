@@ -0,0 +1,115 @@
+#include "PoissonGenerator.hpp"
+
+#include "Engine.hpp"
+#include "ErrorChecker.hpp"
+#include "Ziggurat.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace aleatoric {
+namespace {
+// Numbers whose probability falls below this are left out of the table
+const double negligibleProbability = 1e-16;
+const double maxMean = 100000000.0;
+} // namespace
+
+PoissonGenerator::PoissonGenerator() : m_engine(std::make_unique<Engine>())
+{
+    setDistribution(1.0);
+}
+
+PoissonGenerator::PoissonGenerator(double mean)
+: m_engine(std::make_unique<Engine>())
+{
+    setDistribution(mean);
+}
+
+PoissonGenerator::~PoissonGenerator()
+{}
+
+int PoissonGenerator::getNumber()
+{
+    auto uniform = Ziggurat::getUniform(m_engine->getEngine());
+    auto index = m_guide[static_cast<int>(uniform * m_guide.size())];
+
+    while(m_cumulativeProbabilities[index] < uniform) {
+        index++;
+    }
+
+    return m_tableStart + index;
+}
+
+void PoissonGenerator::getNumbers(int *output, int size)
+{
+    for(int i = 0; i < size; i++) {
+        output[i] = getNumber();
+    }
+}
+
+std::vector<int> PoissonGenerator::getNumbers(int size)
+{
+    std::vector<int> numbers(std::max(size, 0));
+    getNumbers(numbers.data(), size);
+    return numbers;
+}
+
+void PoissonGenerator::setDistribution(double mean)
+{
+    if(!(mean > 0.0) || mean > maxMean) {
+        ErrorChecker::throwInvalidArgument(
+            "The mean must be greater than 0 and no greater than 100000000");
+    }
+
+    m_mean = mean;
+
+    // Probabilities are worked out in log space from the mode outwards, so
+    // that large means neither overflow nor underflow
+    auto mode = std::floor(mean);
+    auto logMean = std::log(mean);
+    auto getProbability = [&](double number) {
+        return std::exp(number * logMean - mean - std::lgamma(number + 1.0) -
+                        (mode * logMean - mean - std::lgamma(mode + 1.0)));
+    };
+
+    auto start = mode;
+    while(start > 0.0 && getProbability(start - 1.0) > negligibleProbability) {
+        start--;
+    }
+    auto end = mode;
+    while(getProbability(end + 1.0) > negligibleProbability) {
+        end++;
+    }
+
+    m_tableStart = static_cast<int>(start);
+    auto tableSize = static_cast<int>(end - start) + 1;
+
+    m_cumulativeProbabilities.resize(tableSize);
+    auto total = 0.0;
+    for(int i = 0; i < tableSize; i++) {
+        total += getProbability(start + i);
+        m_cumulativeProbabilities[i] = total;
+    }
+    for(auto &&probability : m_cumulativeProbabilities) {
+        probability /= total;
+    }
+    m_cumulativeProbabilities.back() = 1.0;
+
+    // Each guide entry holds the first index whose cumulative probability
+    // reaches the start of its slice of the unit interval
+    m_guide.resize(tableSize);
+    int index = 0;
+    for(int i = 0; i < tableSize; i++) {
+        auto sliceStart = static_cast<double>(i) / tableSize;
+        while(m_cumulativeProbabilities[index] < sliceStart) {
+            index++;
+        }
+        m_guide[i] = index;
+    }
+}
+
+double PoissonGenerator::getDistribution()
+{
+    return m_mean;
+}
+} // namespace aleatoric
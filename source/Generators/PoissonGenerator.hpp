@@ -0,0 +1,66 @@
+#ifndef PoissonGenerator_hpp
+#define PoissonGenerator_hpp
+
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+class Engine;
+/*!
+@brief Implementation class for generating numbers from a Poisson
+distribution
+
+Uses a [Permuted Congruential Generator -
+PCG](https://github.com/imneme/pcg-cpp) engine. Numbers are produced by
+inversion through a table of the cumulative distribution, which is rebuilt
+whenever the mean is set. A guide table indexes the cumulative table so that
+most draws take one lookup and no search. The table covers the numbers around
+the mean whose probability is not negligible, so its size grows with the square
+root of the mean.
+*/
+class PoissonGenerator {
+  public:
+    /*!
+     * @brief Constructor
+     *
+     * Creates a generator with a mean of 1.
+     */
+    PoissonGenerator();
+
+    /*!
+     * @brief Constructor
+     *
+     * @param mean the mean of the distribution. Must be greater than 0 and no
+     * greater than 100000000.
+     */
+    PoissonGenerator(double mean);
+
+    ~PoissonGenerator();
+
+    int getNumber();
+
+    /*!
+     * @brief Fills output with size numbers. Cheaper per number than calling
+     * getNumber() repeatedly.
+     */
+    void getNumbers(int *output, int size);
+
+    std::vector<int> getNumbers(int size);
+
+    void setDistribution(double mean);
+
+    /*!
+     * @return the mean
+     */
+    double getDistribution();
+
+  private:
+    std::unique_ptr<Engine> m_engine;
+    double m_mean;
+    int m_tableStart;
+    std::vector<double> m_cumulativeProbabilities;
+    std::vector<int> m_guide;
+};
+} // namespace aleatoric
+
+#endif /* PoissonGenerator_hpp */
@@ -1,20 +1,22 @@
 #ifndef UniformRealGenerator_hpp
 #define UniformRealGenerator_hpp
 
+#include "IUniformRealGenerator.hpp"
+
 #include <memory>
 #include <random>
 
 namespace aleatoric {
 class Engine;
-class UniformRealGenerator {
+class UniformRealGenerator : public IUniformRealGenerator {
   public:
     UniformRealGenerator();
     UniformRealGenerator(double rangeStart, double rangeEnd);
     ~UniformRealGenerator();
 
-    double getNumber();
-    void setDistribution(double rangeStart, double rangeEnd);
-    std::pair<double, double> getDistribution();
+    double getNumber() override;
+    void setDistribution(double rangeStart, double rangeEnd) override;
+    std::pair<double, double> getDistribution() override;
 
   private:
     std::unique_ptr<Engine> m_engine;
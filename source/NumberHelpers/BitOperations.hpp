@@ -0,0 +1,61 @@
+#ifndef BitOperations_hpp
+#define BitOperations_hpp
+
+#include <cstdint>
+
+namespace aleatoric {
+/*!
+ * @brief Bit counting on 32 and 64-bit words, for the bit sets and direction
+ * numbers used elsewhere in the library
+ *
+ * Bits are counted in parallel within the word, which needs no hardware or
+ * compiler support. Defined in the header so that they can be inlined into the
+ * loops that use them.
+ */
+class BitOperations {
+  public:
+    /*! @return The number of set bits */
+    static int countBits(uint32_t word)
+    {
+        word -= (word >> 1) & 0x55555555;
+        word = (word & 0x33333333) + ((word >> 2) & 0x33333333);
+        word = (word + (word >> 4)) & 0x0f0f0f0f;
+        return static_cast<int>((word * 0x01010101) >> 24);
+    }
+
+    static int countBits(uint64_t word)
+    {
+        word -= (word >> 1) & 0x5555555555555555;
+        word =
+            (word & 0x3333333333333333) + ((word >> 2) & 0x3333333333333333);
+        word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0f;
+        return static_cast<int>((word * 0x0101010101010101) >> 56);
+    }
+
+    /*! @return The index of the lowest set bit, or the size of the word if
+     * none is set */
+    static int countTrailingZeros(uint32_t word)
+    {
+        return countBits((word & (~word + 1)) - 1);
+    }
+
+    static int countTrailingZeros(uint64_t word)
+    {
+        return countBits((word & (~word + 1)) - 1);
+    }
+
+    /*! @return The index of the highest set bit, or -1 if none is set */
+    static int getHighestBit(uint64_t word)
+    {
+        word |= word >> 1;
+        word |= word >> 2;
+        word |= word >> 4;
+        word |= word >> 8;
+        word |= word >> 16;
+        word |= word >> 32;
+        return countBits(word) - 1;
+    }
+};
+} // namespace aleatoric
+
+#endif /* BitOperations_hpp */
@@ -0,0 +1,57 @@
+#include "EngineBank.hpp"
+
+#include "Engine.hpp"
+
+namespace aleatoric {
+namespace {
+const uint64_t multiplier = 6364136223846793005ULL;
+}
+
+EngineBank::EngineBank() : m_seeder(std::make_unique<Engine>())
+{}
+
+EngineBank::~EngineBank()
+{}
+
+void EngineBank::setSize(int size)
+{
+    auto previousSize = m_states.size();
+    m_states.resize(size);
+    m_increments.resize(size);
+
+    auto &seeder = m_seeder->getEngine();
+    for(size_t i = previousSize; i < m_states.size(); i++) {
+        uint64_t seed = (uint64_t(seeder()) << 32) | seeder();
+        uint64_t stream = (uint64_t(seeder()) << 32) | seeder();
+
+        // as per pcg32's own seeding: the increment must be odd
+        m_increments[i] = (stream << 1) | 1;
+        m_states[i] = (m_increments[i] + seed) * multiplier + m_increments[i];
+    }
+}
+
+int EngineBank::getSize()
+{
+    return static_cast<int>(m_states.size());
+}
+
+void EngineBank::getNumbers(uint32_t *output)
+{
+    auto size = m_states.size();
+    auto states = m_states.data();
+    auto increments = m_increments.data();
+
+    // pcg32 (XSH RR) for every engine. Kept free of branches and calls so the
+    // loop can be vectorised.
+    for(size_t i = 0; i < size; i++) {
+        auto oldState = states[i];
+        states[i] = oldState * multiplier + increments[i];
+
+        auto xorShifted =
+            static_cast<uint32_t>(((oldState >> 18u) ^ oldState) >> 27u);
+        auto rotation = static_cast<uint32_t>(oldState >> 59u);
+        output[i] = (xorShifted >> rotation) |
+                    (xorShifted << ((~rotation + 1u) & 31u));
+    }
+}
+} // namespace aleatoric
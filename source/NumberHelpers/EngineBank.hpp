@@ -0,0 +1,44 @@
+#ifndef EngineBank_hpp
+#define EngineBank_hpp
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+class Engine;
+
+/*!
+ * @brief A collection of independent pcg32 engines held as structure of
+ * arrays, so that every engine can be advanced in a single loop which the
+ * compiler is able to vectorise.
+ *
+ * Each engine is seeded from an Engine and runs on its own stream.
+ */
+class EngineBank {
+  public:
+    EngineBank();
+    ~EngineBank();
+
+    /*!
+     * @brief Sets the number of engines. Existing engines keep their state
+     * and any added engines are newly seeded.
+     */
+    void setSize(int size);
+
+    int getSize();
+
+    /*!
+     * @brief Advances every engine one step, writing each engine's output to
+     * the same index in output, which must hold at least getSize() items.
+     */
+    void getNumbers(uint32_t *output);
+
+  private:
+    std::unique_ptr<Engine> m_seeder;
+    std::vector<uint64_t> m_states;
+    std::vector<uint64_t> m_increments;
+};
+} // namespace aleatoric
+
+#endif /* EngineBank_hpp */
@@ -0,0 +1,68 @@
+#include "FeistelPermutation.hpp"
+
+#include <limits>
+
+namespace aleatoric {
+FeistelPermutation::FeistelPermutation()
+: m_keys {}, m_size(1), m_halfWidth(1), m_halfMask(1)
+{}
+
+FeistelPermutation::~FeistelPermutation()
+{}
+
+void FeistelPermutation::setSize(int size)
+{
+    m_size = static_cast<uint32_t>(size);
+
+    // the network needs an even number of bits, split into two halves,
+    // enough to hold every index from 0 to size - 1
+    m_halfWidth = 1;
+    while((uint64_t(1) << (m_halfWidth * 2)) < m_size) {
+        m_halfWidth++;
+    }
+    m_halfMask = (uint32_t(1) << m_halfWidth) - 1;
+}
+
+void FeistelPermutation::reseed(std::unique_ptr<IUniformGenerator> &generator)
+{
+    generator->setDistribution(0, std::numeric_limits<int>::max());
+    for(auto &&key : m_keys) {
+        key = static_cast<uint32_t>(generator->getNumber());
+    }
+}
+
+int FeistelPermutation::getIndex(int position)
+{
+    auto index = encrypt(static_cast<uint32_t>(position));
+    while(index >= m_size) {
+        index = encrypt(index);
+    }
+    return static_cast<int>(index);
+}
+
+// Private methods
+uint32_t FeistelPermutation::encrypt(uint32_t value)
+{
+    auto left = value >> m_halfWidth;
+    auto right = value & m_halfMask;
+
+    for(auto &&key : m_keys) {
+        auto nextRight = left ^ (mix(right ^ key) & m_halfMask);
+        left = right;
+        right = nextRight;
+    }
+
+    return (left << m_halfWidth) | right;
+}
+
+uint32_t FeistelPermutation::mix(uint32_t value)
+{
+    // integer hash with good avalanche behaviour (Chris Wellons' lowbias32)
+    value ^= value >> 16;
+    value *= 0x7feb352dU;
+    value ^= value >> 15;
+    value *= 0x846ca68bU;
+    value ^= value >> 16;
+    return value;
+}
+} // namespace aleatoric
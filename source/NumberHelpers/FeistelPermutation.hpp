@@ -0,0 +1,52 @@
+#ifndef FeistelPermutation_hpp
+#define FeistelPermutation_hpp
+
+#include "IUniformGenerator.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+namespace aleatoric {
+/*!
+ * @brief A pseudo-random permutation of the indices 0 to size - 1, computed
+ * on demand
+ *
+ * A balanced Feistel network over the smallest even number of bits that can
+ * hold every index is a bijection on that bit width. Indices it maps outside
+ * the permutation's size are fed back through the network ("cycle-walking")
+ * until they land inside it, which keeps the mapping a bijection on the
+ * indices themselves. Memory use is constant and each lookup takes, on
+ * average, fewer than four passes through the network, whatever the size.
+ */
+class FeistelPermutation {
+  public:
+    FeistelPermutation();
+    ~FeistelPermutation();
+
+    void setSize(int size);
+
+    /*!
+     * @brief Draws new round keys from the generator, producing a new
+     * permutation of the same size.
+     */
+    void reseed(std::unique_ptr<IUniformGenerator> &generator);
+
+    /*!
+     * @brief Returns the index at the given position in the permutation.
+     * Position must be in the range 0 to size - 1.
+     */
+    int getIndex(int position);
+
+  private:
+    static const int numberOfRounds = 4;
+    std::array<uint32_t, numberOfRounds> m_keys;
+    uint32_t m_size;
+    int m_halfWidth;
+    uint32_t m_halfMask;
+    uint32_t encrypt(uint32_t value);
+    static uint32_t mix(uint32_t value);
+};
+} // namespace aleatoric
+
+#endif /* FeistelPermutation_hpp */
@@ -0,0 +1,66 @@
+#include "FenwickTree.hpp"
+
+namespace aleatoric {
+FenwickTree::FenwickTree() : m_total(0), m_highestPowerOfTwo(0)
+{}
+
+FenwickTree::~FenwickTree()
+{}
+
+void FenwickTree::setCounts(const std::vector<int> &counts)
+{
+    // the tree is 1-based, so element 0 is unused
+    m_tree.assign(counts.size() + 1, 0);
+    m_total = 0;
+
+    // linear time construction: each node passes its sum up to its parent
+    int treeSize = static_cast<int>(m_tree.size());
+    for(int i = 1; i < treeSize; i++) {
+        m_tree[i] += counts[i - 1];
+        m_total += counts[i - 1];
+
+        int parent = i + (i & -i);
+        if(parent < treeSize) {
+            m_tree[parent] += m_tree[i];
+        }
+    }
+
+    m_highestPowerOfTwo = 1;
+    while(m_highestPowerOfTwo * 2 < static_cast<int>(m_tree.size())) {
+        m_highestPowerOfTwo *= 2;
+    }
+}
+
+void FenwickTree::add(int index, int delta)
+{
+    m_total += delta;
+
+    for(int i = index + 1; i < static_cast<int>(m_tree.size()); i += i & -i) {
+        m_tree[i] += delta;
+    }
+}
+
+int FenwickTree::getTotal()
+{
+    return m_total;
+}
+
+int FenwickTree::findIndex(int position)
+{
+    // descend from the largest power of two, skipping every node whose
+    // cumulative count does not yet reach past the position
+    int index = 0;
+    for(int step = m_highestPowerOfTwo; step > 0; step /= 2) {
+        int next = index + step;
+        if(next < static_cast<int>(m_tree.size()) &&
+           m_tree[next] <= position) {
+            index = next;
+            position -= m_tree[next];
+        }
+    }
+
+    // index is the 1-based position of the last node passed over, which is
+    // the 0-based index of the node containing the position
+    return index;
+}
+} // namespace aleatoric
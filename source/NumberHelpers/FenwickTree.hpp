@@ -0,0 +1,45 @@
+#ifndef FenwickTree_hpp
+#define FenwickTree_hpp
+
+#include <vector>
+
+namespace aleatoric {
+/*!
+ * @brief A binary indexed tree holding a count for each of a set of indices.
+ * Counts can be updated, and the index that a number falls within when the
+ * counts are laid end to end can be found, in O(log n) time.
+ */
+class FenwickTree {
+  public:
+    FenwickTree();
+    ~FenwickTree();
+
+    /*!
+     * @brief Replaces all counts held with those supplied.
+     */
+    void setCounts(const std::vector<int> &counts);
+
+    /*!
+     * @brief Adds delta (which may be negative) to the count at the index.
+     */
+    void add(int index, int delta);
+
+    /*!
+     * @brief The sum of all counts held.
+     */
+    int getTotal();
+
+    /*!
+     * @brief Finds the index whose share of the cumulative counts contains
+     * the position supplied. Position must be in the range 0 to total - 1.
+     */
+    int findIndex(int position);
+
+  private:
+    std::vector<int> m_tree;
+    int m_total;
+    int m_highestPowerOfTwo;
+};
+} // namespace aleatoric
+
+#endif /* FenwickTree_hpp */
@@ -0,0 +1,157 @@
+#include "Ziggurat.hpp"
+
+#include <cmath>
+
+namespace aleatoric {
+namespace {
+// The right-hand edge of the base layer and the area of each layer, from
+// Marsaglia and Tsang (2000), "The Ziggurat Method for Generating Random
+// Variables".
+const double normalEdge = 3.442619855899;
+const double normalArea = 9.91256303526217e-3;
+const double exponentialEdge = 7.697117470131487;
+const double exponentialArea = 3.949659822581572e-3;
+
+// The magnitude taken from each engine output has 24 bits
+const double magnitudeScale = 16777216.0;
+} // namespace
+
+void Ziggurat::getNormals(pcg32 &engine, double *output, int size)
+{
+    const auto &tables = getTables();
+
+    for(int i = 0; i < size; i++) {
+        output[i] = getNormal(engine, tables);
+    }
+}
+
+void Ziggurat::getExponentials(pcg32 &engine, double *output, int size)
+{
+    const auto &tables = getTables();
+
+    for(int i = 0; i < size; i++) {
+        output[i] = getExponential(engine, tables);
+    }
+}
+
+// Private methods
+Ziggurat::Tables::Tables()
+{
+    auto edge = normalEdge;
+    auto previousEdge = edge;
+    auto base = normalArea / std::exp(-0.5 * edge * edge);
+
+    normalLimits[0] = static_cast<uint32_t>((edge / base) * magnitudeScale);
+    normalLimits[1] = 0;
+    normalWidths[0] = base / magnitudeScale;
+    normalWidths[127] = edge / magnitudeScale;
+    normalHeights[0] = 1.0;
+    normalHeights[127] = std::exp(-0.5 * edge * edge);
+
+    for(int i = 126; i >= 1; i--) {
+        edge = std::sqrt(
+            -2.0 * std::log(normalArea / edge + std::exp(-0.5 * edge * edge)));
+        normalLimits[i + 1] =
+            static_cast<uint32_t>((edge / previousEdge) * magnitudeScale);
+        previousEdge = edge;
+        normalHeights[i] = std::exp(-0.5 * edge * edge);
+        normalWidths[i] = edge / magnitudeScale;
+    }
+
+    edge = exponentialEdge;
+    previousEdge = edge;
+    base = exponentialArea / std::exp(-edge);
+
+    exponentialLimits[0] =
+        static_cast<uint32_t>((edge / base) * magnitudeScale);
+    exponentialLimits[1] = 0;
+    exponentialWidths[0] = base / magnitudeScale;
+    exponentialWidths[255] = edge / magnitudeScale;
+    exponentialHeights[0] = 1.0;
+    exponentialHeights[255] = std::exp(-edge);
+
+    for(int i = 254; i >= 1; i--) {
+        edge = -std::log(exponentialArea / edge + std::exp(-edge));
+        exponentialLimits[i + 1] =
+            static_cast<uint32_t>((edge / previousEdge) * magnitudeScale);
+        previousEdge = edge;
+        exponentialHeights[i] = std::exp(-edge);
+        exponentialWidths[i] = edge / magnitudeScale;
+    }
+}
+
+const Ziggurat::Tables &Ziggurat::getTables()
+{
+    static const Tables tables;
+    return tables;
+}
+
+double Ziggurat::getNormalSlowPath(pcg32 &engine,
+                                   const Tables &tables,
+                                   uint32_t random)
+{
+    while(true) {
+        auto layer = random & 127;
+        auto number = (random >> 8) * tables.normalWidths[layer];
+
+        if(layer == 0) {
+            // The tail beyond the base layer, sampled by Marsaglia's method
+            double x;
+            double y;
+            do {
+                x = -std::log(getUniform(engine)) / normalEdge;
+                y = -std::log(getUniform(engine));
+            } while(y + y < x * x);
+
+            number = normalEdge + x;
+            return (random & 128) ? -number : number;
+        }
+
+        auto height = tables.normalHeights[layer] +
+                      getUniform(engine) * (tables.normalHeights[layer - 1] -
+                                            tables.normalHeights[layer]);
+
+        if(height < std::exp(-0.5 * number * number)) {
+            return (random & 128) ? -number : number;
+        }
+
+        random = engine();
+        layer = random & 127;
+        if((random >> 8) < tables.normalLimits[layer]) {
+            number = (random >> 8) * tables.normalWidths[layer];
+            return (random & 128) ? -number : number;
+        }
+    }
+}
+
+double Ziggurat::getExponentialSlowPath(pcg32 &engine,
+                                        const Tables &tables,
+                                        uint32_t random)
+{
+    while(true) {
+        auto layer = random & 255;
+
+        if(layer == 0) {
+            // The exponential distribution is memoryless, so the tail is the
+            // edge plus a fresh draw
+            return exponentialEdge - std::log(getUniform(engine));
+        }
+
+        auto number = (random >> 8) * tables.exponentialWidths[layer];
+        auto height =
+            tables.exponentialHeights[layer] +
+            getUniform(engine) * (tables.exponentialHeights[layer - 1] -
+                                  tables.exponentialHeights[layer]);
+
+        if(height < std::exp(-number)) {
+            return number;
+        }
+
+        random = engine();
+        layer = random & 255;
+        if((random >> 8) < tables.exponentialLimits[layer]) {
+            return (random >> 8) * tables.exponentialWidths[layer];
+        }
+    }
+}
+} // namespace aleatoric
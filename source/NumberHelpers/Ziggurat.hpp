@@ -0,0 +1,114 @@
+#ifndef Ziggurat_hpp
+#define Ziggurat_hpp
+
+#include "Engine.hpp"
+
+#include <cstdint>
+
+namespace aleatoric {
+/*!
+ * @brief Draws standard normal and standard exponential numbers from a pcg32
+ * engine using the ziggurat method of Marsaglia and Tsang.
+ *
+ * Each 32-bit engine output supplies a layer index from its lowest bits and a
+ * 24-bit magnitude from its highest bits, so the two are independent. Most
+ * draws are a table lookup, a comparison and a multiplication; only the rare
+ * draws falling outside the rectangle of a layer take the slow path.
+ *
+ * The tables are built once and shared by all callers.
+ */
+class Ziggurat {
+  public:
+    /*!
+     * @brief A number from the normal distribution with mean 0 and standard
+     * deviation 1.
+     */
+    static double getNormal(pcg32 &engine);
+
+    /*!
+     * @brief A number from the exponential distribution with rate 1.
+     */
+    static double getExponential(pcg32 &engine);
+
+    /*!
+     * @brief A number from the open interval (0, 1).
+     */
+    static double getUniform(pcg32 &engine);
+
+    /*!
+     * @brief Fills output with size numbers from getNormal().
+     */
+    static void getNormals(pcg32 &engine, double *output, int size);
+
+    /*!
+     * @brief Fills output with size numbers from getExponential().
+     */
+    static void getExponentials(pcg32 &engine, double *output, int size);
+
+  private:
+    struct Tables {
+        Tables();
+        uint32_t normalLimits[128];
+        double normalWidths[128];
+        double normalHeights[128];
+        uint32_t exponentialLimits[256];
+        double exponentialWidths[256];
+        double exponentialHeights[256];
+    };
+
+    static const Tables &getTables();
+
+    static double getNormal(pcg32 &engine, const Tables &tables);
+    static double getExponential(pcg32 &engine, const Tables &tables);
+    static double getNormalSlowPath(pcg32 &engine,
+                                    const Tables &tables,
+                                    uint32_t random);
+    static double getExponentialSlowPath(pcg32 &engine,
+                                         const Tables &tables,
+                                         uint32_t random);
+};
+
+inline double Ziggurat::getUniform(pcg32 &engine)
+{
+    return ((engine() >> 8) + 0.5) * (1.0 / 16777216.0);
+}
+
+inline double Ziggurat::getNormal(pcg32 &engine, const Tables &tables)
+{
+    auto random = engine();
+    auto layer = random & 127;
+    auto magnitude = random >> 8;
+
+    if(magnitude < tables.normalLimits[layer]) {
+        auto number = magnitude * tables.normalWidths[layer];
+        return (random & 128) ? -number : number;
+    }
+
+    return getNormalSlowPath(engine, tables, random);
+}
+
+inline double Ziggurat::getExponential(pcg32 &engine, const Tables &tables)
+{
+    auto random = engine();
+    auto layer = random & 255;
+    auto magnitude = random >> 8;
+
+    if(magnitude < tables.exponentialLimits[layer]) {
+        return magnitude * tables.exponentialWidths[layer];
+    }
+
+    return getExponentialSlowPath(engine, tables, random);
+}
+
+inline double Ziggurat::getNormal(pcg32 &engine)
+{
+    return getNormal(engine, getTables());
+}
+
+inline double Ziggurat::getExponential(pcg32 &engine)
+{
+    return getExponential(engine, getTables());
+}
+} // namespace aleatoric
+
+#endif /* Ziggurat_hpp */
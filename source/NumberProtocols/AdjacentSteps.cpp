@@ -3,21 +3,21 @@
 #include "ErrorChecker.hpp"
 
 namespace aleatoric {
-AdjacentSteps::AdjacentSteps(std::unique_ptr<IDiscreteGenerator> generator)
+AdjacentSteps::AdjacentSteps(std::unique_ptr<IUniformGenerator> generator)
 : m_generator(std::move(generator)),
   m_range(Range(0, 1)),
   m_haveRequestedFirstNumber(false)
 {
-    m_generator->setDistributionVector(m_range.size, 1.0);
+    m_generator->setDistribution(m_range.start, m_range.end);
 }
 
-AdjacentSteps::AdjacentSteps(std::unique_ptr<IDiscreteGenerator> generator,
+AdjacentSteps::AdjacentSteps(std::unique_ptr<IUniformGenerator> generator,
                              Range range)
 : m_generator(std::move(generator)),
   m_range(range),
   m_haveRequestedFirstNumber(false)
 {
-    m_generator->setDistributionVector(m_range.size, 1.0);
+    m_generator->setDistribution(m_range.start, m_range.end);
 }
 
 AdjacentSteps::~AdjacentSteps()
@@ -25,13 +25,17 @@ AdjacentSteps::~AdjacentSteps()
 
 int AdjacentSteps::getIntegerNumber()
 {
-    auto generatedNumber = m_generator->getNumber();
-    m_lastReturnedNumber = generatedNumber + m_range.offset;
+    if(canStepFromLastNumber()) {
+        m_lastReturnedNumber = getAdjacentNumber(m_lastReturnedNumber);
+    } else {
+        m_lastReturnedNumber = m_generator->getNumber();
 
-    m_haveRequestedFirstNumber = true;
+        // from here on the generator is only used to flip a coin between
+        // stepping down (0) or up (1)
+        m_generator->setDistribution(0, 1);
+    }
 
-    // step configuring in preparation for next call
-    prepareStepBasedDistribution(m_lastReturnedNumber);
+    m_haveRequestedFirstNumber = true;
 
     return m_lastReturnedNumber;
 }
@@ -44,11 +48,11 @@ double AdjacentSteps::getDecimalNumber()
 void AdjacentSteps::setParams(NumberProtocolConfig newParams)
 {
     m_range = newParams.getRange();
-    m_generator->setDistributionVector(m_range.size, 1.0);
 
-    if(m_haveRequestedFirstNumber &&
-       m_range.numberIsInRange(m_lastReturnedNumber)) {
-        prepareStepBasedDistribution(m_lastReturnedNumber);
+    if(canStepFromLastNumber()) {
+        m_generator->setDistribution(0, 1);
+    } else {
+        m_generator->setDistribution(m_range.start, m_range.end);
     }
 }
 
@@ -58,20 +62,23 @@ NumberProtocolConfig AdjacentSteps::getParams()
                                 NumberProtocolParams(AdjacentStepsParams()));
 }
 
-void AdjacentSteps::prepareStepBasedDistribution(int number)
+// Private methods
+int AdjacentSteps::getAdjacentNumber(int number)
 {
-    auto vectorIndex = number - m_range.offset;
-    m_generator->updateDistributionVector(0.0);
-
     if(number == m_range.start) {
-        m_generator->updateDistributionVector(vectorIndex + 1, 1.0);
-
-    } else if(number == m_range.end) {
-        m_generator->updateDistributionVector(vectorIndex - 1, 1.0);
+        return number + 1;
+    }
 
-    } else {
-        m_generator->updateDistributionVector(vectorIndex + 1, 1.0);
-        m_generator->updateDistributionVector(vectorIndex - 1, 1.0);
+    if(number == m_range.end) {
+        return number - 1;
     }
+
+    return m_generator->getNumber() == 0 ? number - 1 : number + 1;
+}
+
+bool AdjacentSteps::canStepFromLastNumber()
+{
+    return m_haveRequestedFirstNumber &&
+           m_range.numberIsInRange(m_lastReturnedNumber);
 }
 } // namespace aleatoric
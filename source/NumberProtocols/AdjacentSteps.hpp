@@ -1,7 +1,7 @@
 #ifndef AdjacentSteps_hpp
 #define AdjacentSteps_hpp
 
-#include "IDiscreteGenerator.hpp"
+#include "IUniformGenerator.hpp"
 #include "NumberProtocol.hpp"
 #include "NumberProtocolParameters.hpp"
 #include "Range.hpp"
@@ -41,20 +41,25 @@ namespace aleatoric {
  * number. If an initial number is not provided, the first call to get a number
  * will pick one from the range at random (equal probability / uniform
  * distribution).
+ *
+ * As only the last selected number is relevant, a step is a coin flip between
+ * the two neighbours of that number (or no draw at all at either end of the
+ * range). The cost of producing a number is therefore independent of the size
+ * of the range.
  */
 class AdjacentSteps : public NumberProtocol {
   public:
-    AdjacentSteps(std::unique_ptr<IDiscreteGenerator> generator);
+    AdjacentSteps(std::unique_ptr<IUniformGenerator> generator);
 
-    /*! @brief Takes a DiscreteGenerator derived from the IDiscreteGenerator,
+    /*! @brief Takes a UniformGenerator derived from the IUniformGenerator,
      * and a Range
      *
-     * @param generator Should be an instance of DiscreteGenerator. Default
+     * @param generator Should be an instance of UniformGenerator. Default
      * construction is fine.
      *
      * @param range The range within which to producde numbers.
      */
-    AdjacentSteps(std::unique_ptr<IDiscreteGenerator> generator, Range range);
+    AdjacentSteps(std::unique_ptr<IUniformGenerator> generator, Range range);
 
     ~AdjacentSteps();
 
@@ -71,9 +76,10 @@ class AdjacentSteps : public NumberProtocol {
     NumberProtocolConfig getParams() override;
 
   private:
-    std::unique_ptr<IDiscreteGenerator> m_generator;
+    std::unique_ptr<IUniformGenerator> m_generator;
     Range m_range;
-    void prepareStepBasedDistribution(int number);
+    int getAdjacentNumber(int number);
+    bool canStepFromLastNumber();
     bool m_haveRequestedFirstNumber;
     int m_lastReturnedNumber;
 };
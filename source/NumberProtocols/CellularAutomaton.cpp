@@ -0,0 +1,261 @@
+#include "CellularAutomaton.hpp"
+
+#include "BitOperations.hpp"
+#include "ErrorChecker.hpp"
+
+#include <utility>
+
+namespace aleatoric {
+namespace {
+const int wordSize = 64;
+
+// Takes the bits of a where the mask is set and the bits of b elsewhere
+uint64_t select(uint64_t mask, uint64_t a, uint64_t b)
+{
+    return (mask & a) | (~mask & b);
+}
+} // namespace
+
+CellularAutomaton::CellularAutomaton() : m_range(0, 1)
+{
+    initialise(m_range, 30, CellularAutomatonParams::Output::population, 0, {});
+}
+
+CellularAutomaton::CellularAutomaton(Range range,
+                                     int rule,
+                                     CellularAutomatonParams::Output output,
+                                     int liveCellIndex,
+                                     std::vector<int> initialCells)
+: m_range(range)
+{
+    initialise(range, rule, output, liveCellIndex, initialCells);
+}
+
+CellularAutomaton::~CellularAutomaton()
+{}
+
+int CellularAutomaton::getIntegerNumber()
+{
+    switch(m_output) {
+    case CellularAutomatonParams::Output::population: {
+        advance();
+        // Scales 0 to size live cells onto the size numbers of the range
+        auto index = static_cast<long long>(getPopulation()) *
+                     (m_range.size - 1) / m_range.size;
+        return static_cast<int>(index) + m_range.offset;
+    }
+    case CellularAutomatonParams::Output::liveCell:
+        advance();
+        return getLiveCell() + m_range.offset;
+    case CellularAutomatonParams::Output::row:
+    default:
+        return getNextCell() + m_range.offset;
+    }
+}
+
+double CellularAutomaton::getDecimalNumber()
+{
+    if(m_output != CellularAutomatonParams::Output::population) {
+        return static_cast<double>(getIntegerNumber());
+    }
+
+    advance();
+    return m_range.start + (m_range.end - m_range.start) *
+                               static_cast<double>(getPopulation()) /
+                               m_range.size;
+}
+
+void CellularAutomaton::setParams(NumberProtocolConfig newParams)
+{
+    auto params = newParams.protocols.getCellularAutomaton();
+    auto range = newParams.getRange();
+    initialise(range,
+               params.getRule(),
+               params.getOutput(),
+               params.getLiveCellIndex(),
+               params.getInitialCells());
+    m_range = range;
+}
+
+NumberProtocolConfig CellularAutomaton::getParams()
+{
+    return NumberProtocolConfig(
+        m_range,
+        NumberProtocolParams(CellularAutomatonParams(
+            m_rule, m_output, m_liveCellIndex, m_initialCells)));
+}
+
+std::vector<int> CellularAutomaton::getRow()
+{
+    std::vector<int> numbers;
+    for(int word = 0; word < static_cast<int>(m_row.size()); word++) {
+        auto bits = m_row[word];
+        while(bits != 0) {
+            numbers.push_back(word * wordSize +
+                              BitOperations::countTrailingZeros(bits) +
+                              m_range.offset);
+            bits &= bits - 1;
+        }
+    }
+    return numbers;
+}
+
+// Private methods
+int CellularAutomaton::getNextCell()
+{
+    auto words = static_cast<int>(m_row.size());
+
+    // Each row starts from its first cell once the previous row is used up
+    for(int attempt = 0; attempt < 2; attempt++) {
+        auto word = m_nextCell / wordSize;
+        if(word < words) {
+            auto bits = m_row[word] & (~uint64_t(0) << (m_nextCell % wordSize));
+            while(bits == 0 && ++word < words) {
+                bits = m_row[word];
+            }
+            if(bits != 0) {
+                auto cell =
+                    word * wordSize + BitOperations::countTrailingZeros(bits);
+                m_nextCell = cell + 1;
+                return cell;
+            }
+        }
+        m_rowIsUsed = true;
+        advance();
+        m_nextCell = 0;
+    }
+
+    // Unreachable: advance() never leaves an empty row in this output mode
+    return 0;
+}
+
+int CellularAutomaton::getLiveCell()
+{
+    auto remaining = m_liveCellIndex % getPopulation();
+    for(int word = 0; word < static_cast<int>(m_row.size()); word++) {
+        auto bits = m_row[word];
+        auto count = BitOperations::countBits(bits);
+        if(remaining < count) {
+            for(int i = 0; i < remaining; i++) {
+                bits &= bits - 1;
+            }
+            return word * wordSize + BitOperations::countTrailingZeros(bits);
+        }
+        remaining -= count;
+    }
+
+    return 0;
+}
+
+int CellularAutomaton::getPopulation()
+{
+    int population = 0;
+    for(auto &&word : m_row) {
+        population += BitOperations::countBits(word);
+    }
+    return population;
+}
+
+void CellularAutomaton::advance()
+{
+    if(!m_rowIsUsed) {
+        m_rowIsUsed = true;
+        return;
+    }
+
+    step();
+
+    if(m_output == CellularAutomatonParams::Output::population) {
+        return;
+    }
+
+    for(auto &&word : m_row) {
+        if(word != 0) {
+            return;
+        }
+    }
+    m_row = m_initialRow;
+}
+
+void CellularAutomaton::step()
+{
+    auto words = m_row.size();
+    auto lastBit = (m_range.size - 1) % wordSize;
+    auto firstCell = m_row.front() & 1;
+
+    // The left neighbour of the first cell is the last cell, and vice versa
+    auto carry = (m_row.back() >> lastBit) & 1;
+    for(size_t word = 0; word < words; word++) {
+        auto centre = m_row[word];
+        auto left = (centre << 1) | carry;
+        auto right = centre >> 1;
+        if(word + 1 < words) {
+            right |= m_row[word + 1] << (wordSize - 1);
+        } else {
+            right |= firstCell << lastBit;
+        }
+        carry = centre >> (wordSize - 1);
+
+        // Looks up the rule bit for each neighbourhood, 4 * left + 2 * centre
+        // + right, across all 64 cells at once
+        auto low = select(centre,
+                          select(right, m_ruleMasks[3], m_ruleMasks[2]),
+                          select(right, m_ruleMasks[1], m_ruleMasks[0]));
+        auto high = select(centre,
+                           select(right, m_ruleMasks[7], m_ruleMasks[6]),
+                           select(right, m_ruleMasks[5], m_ruleMasks[4]));
+        m_nextRow[word] = select(left, high, low);
+    }
+
+    // Clear the bits beyond the last cell
+    m_nextRow.back() &= ~uint64_t(0) >> (wordSize - 1 - lastBit);
+    std::swap(m_row, m_nextRow);
+}
+
+void CellularAutomaton::initialise(Range range,
+                                   int rule,
+                                   CellularAutomatonParams::Output output,
+                                   int liveCellIndex,
+                                   std::vector<int> initialCells)
+{
+    if(rule < 0 || rule > 255) {
+        ErrorChecker::throwInvalidArgument(
+            "The rule must be between 0 and 255");
+    }
+
+    if(liveCellIndex < 0) {
+        ErrorChecker::throwInvalidArgument(
+            "The live cell index must be 0 or greater");
+    }
+
+    for(auto &&cell : initialCells) {
+        if(!range.numberIsInRange(cell)) {
+            ErrorChecker::throwInvalidArgument(
+                "The initial cells must be within the range");
+        }
+    }
+
+    std::vector<uint64_t> row((range.size + wordSize - 1) / wordSize, 0);
+    if(initialCells.empty()) {
+        auto centre = range.size / 2;
+        row[centre / wordSize] |= uint64_t(1) << (centre % wordSize);
+    }
+    for(auto &&number : initialCells) {
+        auto cell = number - range.offset;
+        row[cell / wordSize] |= uint64_t(1) << (cell % wordSize);
+    }
+
+    m_rule = rule;
+    m_output = output;
+    m_liveCellIndex = liveCellIndex;
+    m_initialCells = initialCells;
+    for(int pattern = 0; pattern < 8; pattern++) {
+        m_ruleMasks[pattern] = ((rule >> pattern) & 1) ? ~uint64_t(0) : 0;
+    }
+    m_initialRow = row;
+    m_row = row;
+    m_nextRow.assign(row.size(), 0);
+    m_rowIsUsed = false;
+    m_nextCell = 0;
+}
+} // namespace aleatoric
@@ -0,0 +1,104 @@
+#ifndef CellularAutomaton_hpp
+#define CellularAutomaton_hpp
+
+#include "NumberProtocol.hpp"
+#include "NumberProtocolParameters.hpp"
+#include "Range.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace aleatoric {
+/*!
+ * @brief A protocol for producing numbers from a cellular automaton
+ *
+ * A concrete implementation of the Protocol interface which forms part of a
+ * [Strategy](https://en.wikipedia.org/wiki/Strategy_pattern) design pattern
+ * (see Protocol for more information).
+ *
+ * Runs a one dimensional elementary cellular automaton with one cell for each
+ * number in the range, and turns each row (generation) into numbers. The
+ * output can be the population of the row, the live cell at a given index
+ * within the row, or every live cell of the row in turn, making the row a
+ * subset of the range. Rules such as 30 give disordered textures, 90 gives
+ * nested self-similar patterns, and 184 gives traffic-like movement.
+ *
+ * Totalistic rules with the three cell neighbourhood are the elementary rules
+ * whose outcome depends only on the number of live cells (e.g. 22, 126, 150),
+ * so are covered by the rule number.
+ *
+ * __Further detail__: The row wraps around, so the neighbours of the cells at
+ * either end of the range are each other. The cells are packed 64 to a word
+ * and the rule is applied to whole words at a time, so a new row costs a
+ * handful of bitwise operations per 64 cells.
+ *
+ * The first number is produced from the initial row. When the output is a
+ * live cell or the row, a row that dies out is replaced by the initial row so
+ * that there are always numbers to produce.
+ */
+class CellularAutomaton : public NumberProtocol {
+  public:
+    CellularAutomaton();
+
+    /*!
+     * @param range The range within which to produce numbers. There is one
+     * cell for each number in the range.
+     *
+     * @param rule The elementary rule in Wolfram numbering. Must be between 0
+     * and 255.
+     *
+     * @param output How each row is turned into numbers.
+     *
+     * @param liveCellIndex The index of the live cell produced from each row
+     * when the output is CellularAutomatonParams::Output::liveCell. Must be 0
+     * or greater.
+     *
+     * @param initialCells The numbers which are live in the initial row. Each
+     * must be within the range. When empty, only the number at the centre of
+     * the range is live.
+     */
+    CellularAutomaton(Range range,
+                      int rule,
+                      CellularAutomatonParams::Output output,
+                      int liveCellIndex = 0,
+                      std::vector<int> initialCells = {});
+
+    ~CellularAutomaton();
+
+    int getIntegerNumber() override;
+
+    double getDecimalNumber() override;
+
+    void setParams(NumberProtocolConfig newParams) override;
+
+    NumberProtocolConfig getParams() override;
+
+    /*! @brief Returns the numbers whose cells are live in the current row */
+    std::vector<int> getRow();
+
+  private:
+    Range m_range;
+    int m_rule;
+    CellularAutomatonParams::Output m_output;
+    int m_liveCellIndex;
+    std::vector<int> m_initialCells;
+    uint64_t m_ruleMasks[8];
+    std::vector<uint64_t> m_initialRow;
+    std::vector<uint64_t> m_row;
+    std::vector<uint64_t> m_nextRow;
+    bool m_rowIsUsed;
+    int m_nextCell;
+    int getNextCell();
+    int getLiveCell();
+    int getPopulation();
+    void advance();
+    void step();
+    void initialise(Range range,
+                    int rule,
+                    CellularAutomatonParams::Output output,
+                    int liveCellIndex,
+                    std::vector<int> initialCells);
+};
+} // namespace aleatoric
+
+#endif /* CellularAutomaton_hpp */
@@ -0,0 +1,468 @@
+#include "Constrained.hpp"
+
+#include "ErrorChecker.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <map>
+
+namespace aleatoric {
+namespace {
+// The number of searches for a first phrase before the params are rejected
+const int firstPhraseAttempts = 16;
+
+void checkParamsAreValid(const Range &range, int length, const Constraints &c)
+{
+    if(length < 1) {
+        ErrorChecker::throwInvalidArgument("The length must be 1 or greater");
+    }
+
+    if(c.maxRun < 0) {
+        ErrorChecker::throwInvalidArgument(
+            "The maximum run must be 0 or greater");
+    }
+
+    for(auto &&interval : c.intervals) {
+        if(interval < 0) {
+            ErrorChecker::throwInvalidArgument(
+                "Intervals must be 0 or greater");
+        }
+    }
+
+    auto isUsable = [&range](int interval) { return interval < range.size; };
+    if(!c.intervals.empty() &&
+       std::none_of(c.intervals.begin(), c.intervals.end(), isUsable)) {
+        ErrorChecker::throwInvalidArgument(
+            "At least one interval must be smaller than the size of the range");
+    }
+
+    if((c.fixFirst && !range.numberIsInRange(c.first)) ||
+       (c.fixLast && !range.numberIsInRange(c.last))) {
+        ErrorChecker::throwInvalidArgument(
+            "The first and last numbers must be within the range");
+    }
+
+    if(c.minSum > c.maxSum) {
+        ErrorChecker::throwInvalidArgument(
+            "The minimum sum must not be greater than the maximum sum");
+    }
+
+    long long least = static_cast<long long>(length) * range.start;
+    long long most = static_cast<long long>(length) * range.end;
+    if(c.fixFirst) {
+        least += c.first - range.start;
+        most += c.first - range.end;
+    }
+    if(c.fixLast && length > 1) {
+        least += c.last - range.start;
+        most += c.last - range.end;
+    }
+
+    if(least > c.maxSum || most < c.minSum ||
+       (length == 1 && c.fixFirst && c.fixLast && c.first != c.last)) {
+        ErrorChecker::throwInvalidArgument(
+            "The constraints cannot be satisfied");
+    }
+}
+
+// The sum of min(a + j * step, cap) for j from 0 to count - 1, where no more
+// than maxRun numbers in succession may equal cap (0 for no limit)
+long long getSumOfLesser(
+    long long a, long long step, long long count, long long cap, int maxRun)
+{
+    if(count <= 0) {
+        return 0;
+    }
+
+    auto belowCap = a >= cap ? 0 : std::min(count, (cap - a) / step + 1);
+    auto atCap = count - belowCap;
+    auto sum = belowCap * a + step * belowCap * (belowCap - 1) / 2 +
+               atCap * cap;
+
+    // Runs at the cap must be broken by numbers at least 1 below it
+    if(maxRun > 0) {
+        sum -= atCap / (maxRun + 1);
+    }
+    return sum;
+}
+
+// The greatest possible sum of the count numbers following from, when each
+// number is at most step from the one before and no greater than cap, and, if
+// fixLast, the final number is last
+long long getGreatestSum(long long from,
+                         long long last,
+                         bool fixLast,
+                         long long count,
+                         long long step,
+                         long long cap,
+                         int maxRun)
+{
+    if(step == 0) {
+        return count * std::min(from, cap);
+    }
+
+    if(!fixLast) {
+        return getSumOfLesser(from + step, step, count, cap, maxRun);
+    }
+
+    // Numbers rise from the first until they must fall towards the last
+    auto rising = (last - from + count * step) / (2 * step);
+    rising = std::max(0LL, std::min(count, rising));
+    return getSumOfLesser(from + step, step, rising, cap, maxRun) +
+           getSumOfLesser(last, step, count - rising, cap, maxRun);
+}
+} // namespace
+
+Constrained::Constrained(std::unique_ptr<NumberProtocol> source,
+                         std::unique_ptr<IUniformRealGenerator> generator)
+: m_source(std::move(source)), m_generator(std::move(generator)), m_range(0, 1)
+{
+    m_generator->setDistribution(0.0, 1.0);
+    ConstrainedParams params(16, Constraints {});
+    initialise(m_range, params);
+}
+
+Constrained::Constrained(std::unique_ptr<NumberProtocol> source,
+                         std::unique_ptr<IUniformRealGenerator> generator,
+                         Range range,
+                         ConstrainedParams params)
+: m_source(std::move(source)), m_generator(std::move(generator)), m_range(range)
+{
+    m_generator->setDistribution(0.0, 1.0);
+    initialise(range, params);
+}
+
+Constrained::~Constrained()
+{}
+
+int Constrained::getIntegerNumber()
+{
+    if(m_position == m_length) {
+        producePhrase();
+    }
+
+    auto number = m_phrase[m_position];
+    m_position++;
+    return number;
+}
+
+double Constrained::getDecimalNumber()
+{
+    return static_cast<double>(getIntegerNumber());
+}
+
+void Constrained::setParams(NumberProtocolConfig newParams)
+{
+    auto range = newParams.getRange();
+    auto params = newParams.protocols.getConstrained();
+    checkParamsAreValid(range, params.getLength(), params.getConstraints());
+
+    // If no phrase can obey the new constraints, the current params and
+    // phrase are restored before throwing
+    auto previousRange = m_range;
+    ConstrainedParams previousParams(m_length, m_constraints);
+    auto phrase = m_phrase;
+    auto position = m_position;
+
+    configure(range, params);
+    auto search = searchForFirstPhrase();
+    if(search != Search::found) {
+        configure(previousRange, previousParams);
+        m_phrase = phrase;
+        m_position = position;
+    }
+    checkPhraseWasFound(search);
+    m_lastPhraseFound = m_phrase;
+}
+
+NumberProtocolConfig Constrained::getParams()
+{
+    return NumberProtocolConfig(
+        m_range,
+        NumberProtocolParams(ConstrainedParams(m_length, m_constraints)));
+}
+
+// Private methods
+void Constrained::producePhrase()
+{
+    // The params were accepted because a phrase was found, so a search that
+    // reaches the backtracking limit repeats the last phrase found rather
+    // than failing part way through the numbers
+    if(searchForPhrase() == Search::found) {
+        m_lastPhraseFound = m_phrase;
+    } else {
+        m_phrase = m_lastPhraseFound;
+        m_position = 0;
+    }
+}
+
+Constrained::Search Constrained::searchForPhrase()
+{
+    std::vector<int> proposals(m_length);
+    auto maxBacktracks = static_cast<long long>(m_length) * m_range.size;
+    long long backtracks = 0;
+    bool isBacktracking = false;
+    int index = 0;
+
+    while(index < m_length) {
+        if(!isBacktracking) {
+            proposals[index] = m_source->getIntegerNumber();
+            m_excluded[index].clear();
+        }
+
+        int number;
+        if(selectNumber(index, proposals[index], number)) {
+            m_phrase[index] = number;
+            m_sums[index + 1] = m_sums[index] + number;
+            m_runs[index] = index > 0 && m_phrase[index - 1] == number
+                                ? m_runs[index - 1] + 1
+                                : 1;
+            index++;
+            isBacktracking = false;
+            continue;
+        }
+
+        // Every candidate for the first number has been tried, so the search
+        // is exhausted
+        if(index == 0) {
+            return Search::exhausted;
+        }
+
+        backtracks++;
+        if(backtracks > maxBacktracks) {
+            return Search::abandoned;
+        }
+
+        index--;
+        m_excluded[index].push_back(m_phrase[index]);
+        isBacktracking = true;
+    }
+
+    m_position = 0;
+    return Search::found;
+}
+
+Constrained::Search Constrained::searchForFirstPhrase()
+{
+    // A search can reach the backtracking limit by chance, so it is retried
+    // with fresh proposals before constraints that a phrase can obey are
+    // rejected
+    auto search = searchForPhrase();
+    for(int attempt = 1;
+        attempt < firstPhraseAttempts && search == Search::abandoned;
+        attempt++) {
+        search = searchForPhrase();
+    }
+    return search;
+}
+
+void Constrained::checkPhraseWasFound(Search search)
+{
+    if(search == Search::exhausted) {
+        ErrorChecker::throwInvalidArgument(
+            "The constraints cannot be satisfied");
+    }
+
+    if(search == Search::abandoned) {
+        ErrorChecker::throwInvalidArgument(
+            "No phrase obeying the constraints was found within the "
+            "backtracking limit");
+    }
+}
+
+bool Constrained::selectNumber(int index, int proposal, int &number)
+{
+    if(m_range.numberIsInRange(proposal) && isCandidate(index, proposal)) {
+        number = proposal;
+        return true;
+    }
+
+    double total = 0.0;
+    for(int i = 0; i < m_range.size; i++) {
+        auto candidate = i + m_range.offset;
+        double weight = 0.0;
+        if(isCandidate(index, candidate)) {
+            // Halve the weight with each step from the proposal, stopping
+            // before distant candidates underflow to 0
+            auto distance = std::llabs(static_cast<long long>(candidate) -
+                                       static_cast<long long>(proposal));
+            auto exponent = static_cast<int>(std::min(distance, 60LL));
+            weight = std::ldexp(1.0, -exponent);
+        }
+        m_weights[i] = weight;
+        total += weight;
+    }
+
+    if(total == 0.0) {
+        return false;
+    }
+
+    auto target = m_generator->getNumber() * total;
+    for(int i = 0; i < m_range.size; i++) {
+        if(m_weights[i] > 0.0) {
+            number = i + m_range.offset;
+            target -= m_weights[i];
+            if(target < 0.0) {
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+bool Constrained::isCandidate(int index, int number)
+{
+    if(index == 0 && m_constraints.fixFirst && number != m_constraints.first) {
+        return false;
+    }
+
+    auto remaining = m_length - 1 - index;
+    if(remaining == 0 && m_constraints.fixLast &&
+       number != m_constraints.last) {
+        return false;
+    }
+
+    if(index > 0) {
+        auto previous = m_phrase[index - 1];
+        if(!m_permittedIntervals.empty() &&
+           !m_permittedIntervals[std::abs(number - previous)]) {
+            return false;
+        }
+
+        if(m_constraints.maxRun > 0 && number == previous &&
+           m_runs[index - 1] >= m_constraints.maxRun) {
+            return false;
+        }
+    }
+
+    // The sum so far must leave room for the numbers still to come, each of
+    // which can move no further than the largest interval from the one before
+    // and must leave the last number within reach
+    auto most = getGreatestSum(number,
+                               m_constraints.last,
+                               m_constraints.fixLast,
+                               remaining,
+                               m_largestInterval,
+                               m_range.end,
+                               m_constraints.maxRun);
+    auto least = -getGreatestSum(-number,
+                                 -m_constraints.last,
+                                 m_constraints.fixLast,
+                                 remaining,
+                                 m_largestInterval,
+                                 -m_range.start,
+                                 m_constraints.maxRun);
+    auto sum = m_sums[index] + number;
+    if(sum + least > m_constraints.maxSum ||
+       sum + most < m_constraints.minSum) {
+        return false;
+    }
+
+    if(m_constraints.fixLast &&
+       !getReachesLast(remaining)[number - m_range.offset]) {
+        return false;
+    }
+
+    for(auto &&excluded : m_excluded[index]) {
+        if(excluded == number) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+const std::vector<bool> &Constrained::getReachesLast(int steps)
+{
+    auto computed = static_cast<int>(m_reachesLast.size());
+    if(steps < computed) {
+        return m_reachesLast[steps];
+    }
+
+    auto period = computed - m_reachPeriodStart;
+    return m_reachesLast[m_reachPeriodStart +
+                         (steps - m_reachPeriodStart) % period];
+}
+
+void Constrained::initialise(Range range, ConstrainedParams &params)
+{
+    checkParamsAreValid(range, params.getLength(), params.getConstraints());
+    configure(range, params);
+
+    // The first phrase is produced up front, so that constraints no phrase can
+    // obey are reported on construction rather than by getIntegerNumber()
+    checkPhraseWasFound(searchForFirstPhrase());
+    m_lastPhraseFound = m_phrase;
+}
+
+void Constrained::configure(Range range, ConstrainedParams &params)
+{
+    auto length = params.getLength();
+    auto constraints = params.getConstraints();
+
+    m_range = range;
+    m_length = length;
+    m_constraints = constraints;
+
+    std::vector<int> intervals;
+    m_permittedIntervals.clear();
+    m_largestInterval = range.size - 1;
+    if(!constraints.intervals.empty()) {
+        m_permittedIntervals.assign(range.size, false);
+        m_largestInterval = 0;
+        for(auto &&interval : constraints.intervals) {
+            if(interval < range.size && !m_permittedIntervals[interval]) {
+                m_permittedIntervals[interval] = true;
+                intervals.push_back(interval);
+                m_largestInterval = std::max(m_largestInterval, interval);
+            }
+        }
+    }
+
+    // The numbers from which the last number can be reached in exactly n
+    // steps, for n from 0. Each set follows from the one before, so once a set
+    // recurs the sets repeat with a fixed period
+    m_reachesLast.clear();
+    m_reachPeriodStart = 0;
+    if(constraints.fixLast) {
+        std::map<std::vector<bool>, int> seen;
+        std::vector<bool> reaches(range.size, false);
+        reaches[constraints.last - range.offset] = true;
+
+        for(int steps = 0; steps < length; steps++) {
+            auto recurrence = seen.find(reaches);
+            if(recurrence != seen.end()) {
+                m_reachPeriodStart = recurrence->second;
+                break;
+            }
+            seen[reaches] = steps;
+            m_reachesLast.push_back(reaches);
+
+            // Any number can reach any other when all intervals are permitted
+            std::vector<bool> previous(range.size, intervals.empty());
+            for(int to = 0; to < range.size; to++) {
+                if(!reaches[to]) {
+                    continue;
+                }
+                for(auto &&interval : intervals) {
+                    if(to - interval >= 0) {
+                        previous[to - interval] = true;
+                    }
+                    if(to + interval < range.size) {
+                        previous[to + interval] = true;
+                    }
+                }
+            }
+            reaches = previous;
+        }
+    }
+
+    m_phrase.assign(length, 0);
+    m_sums.assign(length + 1, 0);
+    m_runs.assign(length, 0);
+    m_excluded.assign(length, {});
+    m_weights.assign(range.size, 0.0);
+    m_position = length;
+}
+} // namespace aleatoric
@@ -0,0 +1,129 @@
+#ifndef Constrained_hpp
+#define Constrained_hpp
+
+#include "IUniformRealGenerator.hpp"
+#include "NumberProtocol.hpp"
+#include "NumberProtocolParameters.hpp"
+#include "Range.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+/*!
+ * @brief A protocol for producing numbers from another protocol that obey a
+ * set of constraints
+ *
+ * A concrete implementation of the Protocol interface which forms part of a
+ * [Strategy](https://en.wikipedia.org/wiki/Strategy_pattern) design pattern
+ * (see Protocol for more information).
+ *
+ * Wraps any other protocol (the source) and produces phrases of a given
+ * length, each of which obeys the constraints (see Constraints): a limit on
+ * how many times a number may occur in succession, a set of permitted
+ * intervals between successive numbers, bounds on the sum of the phrase, and a
+ * fixed first and last number. Phrases follow one another without a break,
+ * and the constraints apply to each phrase on its own.
+ *
+ * Each number of a phrase is proposed by the source. If the proposal can be
+ * followed by a phrase that obeys the constraints, it is used. If not, a
+ * number is selected at random from those that can, weighted towards the
+ * proposal: each step further from the proposal halves the likelihood of a
+ * number being selected. A source whose numbers already obey the constraints
+ * is therefore passed through untouched, and one that does not is bent as
+ * little as possible.
+ *
+ * __Further detail__: Rather than producing phrases and rejecting those that
+ * fail, each number is checked against the constraints before it is
+ * selected (forward checking). This takes account of the numbers still to
+ * come: the sum of the phrase so far must leave room for the remaining
+ * numbers, and when the last number is fixed, it must be reachable from the
+ * candidate using the permitted intervals in exactly the number of steps
+ * remaining. If a dead end is nevertheless reached, the previous number is
+ * replaced by another candidate (backtracking). The number of backtracks is
+ * bounded, so producing a phrase takes bounded time. Should a search reach
+ * the bound, the last phrase found is repeated, so once the params have been
+ * accepted getting a number never fails.
+ *
+ * Numbers are always integers: getDecimalNumber() returns the same numbers as
+ * getIntegerNumber().
+ */
+class Constrained : public NumberProtocol {
+  public:
+    /*!
+     * @param source The protocol proposing numbers. Its range and params
+     * should be set before it is passed in.
+     *
+     * @param generator Should be an instance of UniformRealGenerator. Default
+     * construction is fine.
+     */
+    Constrained(std::unique_ptr<NumberProtocol> source,
+                std::unique_ptr<IUniformRealGenerator> generator);
+
+    /*!
+     * @param source The protocol proposing numbers. Its range and params
+     * should be set before it is passed in.
+     *
+     * @param generator Should be an instance of UniformRealGenerator. Default
+     * construction is fine.
+     *
+     * @param range The range within which to produce numbers.
+     *
+     * @param params The phrase length and constraints. See ConstrainedParams.
+     *
+     * @exception std::invalid_argument if the params are invalid or no phrase
+     * can obey the constraints.
+     */
+    Constrained(std::unique_ptr<NumberProtocol> source,
+                std::unique_ptr<IUniformRealGenerator> generator,
+                Range range,
+                ConstrainedParams params);
+
+    ~Constrained();
+
+    int getIntegerNumber() override;
+
+    double getDecimalNumber() override;
+
+    /*!
+     * @brief Sets the range, phrase length and constraints, and starts a new
+     * phrase. The source is left as it is.
+     *
+     * @exception std::invalid_argument if the params are invalid or no phrase
+     * can obey the constraints, in which case the object is left unchanged.
+     */
+    void setParams(NumberProtocolConfig newParams) override;
+
+    NumberProtocolConfig getParams() override;
+
+  private:
+    std::unique_ptr<NumberProtocol> m_source;
+    std::unique_ptr<IUniformRealGenerator> m_generator;
+    Range m_range;
+    int m_length;
+    Constraints m_constraints;
+    std::vector<bool> m_permittedIntervals;
+    int m_largestInterval;
+    std::vector<std::vector<bool>> m_reachesLast;
+    int m_reachPeriodStart;
+    std::vector<int> m_phrase;
+    std::vector<int> m_lastPhraseFound;
+    std::vector<long long> m_sums;
+    std::vector<int> m_runs;
+    std::vector<std::vector<int>> m_excluded;
+    std::vector<double> m_weights;
+    int m_position;
+    enum class Search { found, exhausted, abandoned };
+    void producePhrase();
+    Search searchForPhrase();
+    Search searchForFirstPhrase();
+    void checkPhraseWasFound(Search search);
+    bool selectNumber(int index, int proposal, int &number);
+    bool isCandidate(int index, int number);
+    const std::vector<bool> &getReachesLast(int steps);
+    void initialise(Range range, ConstrainedParams &params);
+    void configure(Range range, ConstrainedParams &params);
+};
+} // namespace aleatoric
+
+#endif /* Constrained_hpp */
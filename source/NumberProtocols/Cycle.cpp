@@ -1,33 +1,40 @@
 #include "Cycle.hpp"
 
-#include "CycleStates.hpp"
 #include "ErrorChecker.hpp"
 
+#include <algorithm>
+
 namespace aleatoric {
+// NB: All three forms of cycle are described by a phase within a period:
+// - unidirectional: the period is the range size and the phase is the
+// distance from the start (forward) or the end (reverse) of the range.
+// - bidirectional: the period is the number of steps for an ascent and a
+// descent of the range. Phases up to (size - 1) ascend from the start of the
+// range, the rest descend from the end. Cycling in reverse is the same
+// sequence starting at the end of the range, i.e. at phase (size - 1).
 Cycle::Cycle()
 : m_range(0, 1),
   m_bidirectional(false),
   m_reverseDirection(false),
+  m_nextStep(0),
   m_haveRequestedFirstNumber(false)
-{
-    initialise();
-}
+{}
 
 Cycle::Cycle(Range range, bool bidirectional, bool reverseDirection)
 : m_range(range),
   m_bidirectional(bidirectional),
   m_reverseDirection(reverseDirection),
+  m_nextStep(0),
   m_haveRequestedFirstNumber(false)
-{
-    initialise();
-}
+{}
 
 Cycle::~Cycle()
 {}
 
 int Cycle::getIntegerNumber()
 {
-    m_lastPosition = m_state->getPosition(m_nextPosition, m_range);
+    m_lastPosition = valueAt(m_nextStep);
+    m_nextStep++;
     m_haveRequestedFirstNumber = true;
     return m_lastPosition;
 }
@@ -37,14 +44,61 @@ double Cycle::getDecimalNumber()
     return static_cast<double>(getIntegerNumber());
 }
 
+std::vector<int> Cycle::getIntegerCollection(int size)
+{
+    std::vector<int> collection(std::max(size, 0));
+
+    auto period = getPeriod();
+    auto phase = getPhase(m_nextStep);
+    // phases before the turn produce ascending runs, except when cycling
+    // unidirectionally in reverse. Phases after the turn (bidirectional only)
+    // produce descending runs.
+    auto turn = m_bidirectional ? m_range.size - 1 : period;
+    int ascentDirection = !m_bidirectional && m_reverseDirection ? -1 : 1;
+    auto out = collection.begin();
+
+    while(out != collection.end()) {
+        auto remaining = collection.end() - out;
+        auto runEnd = phase < turn ? turn : period;
+        auto run = std::min<long long>(remaining, runEnd - phase);
+        int direction = phase < turn ? ascentDirection : -1;
+        int first = getPosition(phase);
+
+        for(int i = 0; i < static_cast<int>(run); i++) {
+            out[i] = first + direction * i;
+        }
+
+        out += run;
+        phase += run;
+
+        if(phase == period) {
+            phase = 0;
+        }
+    }
+
+    if(!collection.empty()) {
+        m_nextStep += static_cast<long long>(collection.size());
+        m_lastPosition = collection.back();
+        m_haveRequestedFirstNumber = true;
+    }
+
+    return collection;
+}
+
+std::vector<double> Cycle::getDecimalCollection(int size)
+{
+    auto integers = getIntegerCollection(size);
+    return std::vector<double>(integers.begin(), integers.end());
+}
+
 void Cycle::setParams(NumberProtocolConfig newParams)
 {
     auto cycleParams = newParams.protocols.getCycle();
     m_bidirectional = cycleParams.getBidirectional();
     m_reverseDirection = cycleParams.getReverseDirection();
+    m_range = newParams.getRange();
 
-    setState();
-    setRange(newParams.getRange());
+    setNextStepForNewRange();
 }
 
 NumberProtocolConfig Cycle::getParams()
@@ -54,38 +108,92 @@ NumberProtocolConfig Cycle::getParams()
         NumberProtocolParams(CycleParams(m_bidirectional, m_reverseDirection)));
 }
 
+int Cycle::valueAt(long long step)
+{
+    return getPosition(getPhase(step));
+}
+
+void Cycle::seek(long long step)
+{
+    m_nextStep = step;
+}
+
 // Private methods
-void Cycle::setState()
+long long Cycle::getPeriod()
 {
-    if(m_bidirectional) {
-        m_state = std::make_unique<Bidirectional>(m_reverseDirection);
-    }
+    return m_bidirectional ? 2LL * (m_range.size - 1) : m_range.size;
+}
 
-    if(!m_bidirectional && m_reverseDirection) {
-        m_state = std::make_unique<UniReverse>();
-    }
+long long Cycle::getPhase(long long step)
+{
+    auto origin = m_bidirectional && m_reverseDirection ? m_range.size - 1 : 0;
+    return wrap(step + origin, getPeriod());
+}
 
-    if(!m_bidirectional && !m_reverseDirection) {
-        m_state = std::make_unique<UniForward>();
+int Cycle::getPosition(long long phase)
+{
+    if(!m_bidirectional) {
+        return m_reverseDirection ? m_range.end - static_cast<int>(phase)
+                                  : m_range.start + static_cast<int>(phase);
     }
+
+    auto distanceFromStart = phase < m_range.size ? phase : getPeriod() - phase;
+    return m_range.start + static_cast<int>(distanceFromStart);
 }
 
-void Cycle::setRange(Range newRange)
+long long Cycle::getStepForPosition(int position, bool descending)
 {
-    m_range = newRange;
+    long long phase = 0;
+
+    if(!m_bidirectional) {
+        phase = m_reverseDirection ? m_range.end - position
+                                   : position - m_range.start;
+    } else {
+        long long distanceFromStart = position - m_range.start;
+        phase = descending ? getPeriod() - distanceFromStart
+                           : distanceFromStart;
+    }
 
-    m_state->setRange(m_lastPosition,
-                      m_nextPosition,
-                      m_range,
-                      m_haveRequestedFirstNumber);
+    auto origin = m_bidirectional && m_reverseDirection ? m_range.size - 1 : 0;
+    return wrap(phase - origin, getPeriod());
 }
 
-void Cycle::initialise()
+void Cycle::setNextStepForNewRange()
 {
-    setState();
+    m_nextStep = 0;
+
+    if(!m_haveRequestedFirstNumber ||
+       !m_range.numberIsInRange(m_lastPosition)) {
+        return;
+    }
+
+    if(!m_bidirectional) {
+        auto lastIsEndOfCycle = m_reverseDirection
+                                    ? m_lastPosition == m_range.start
+                                    : m_lastPosition == m_range.end;
+        if(!lastIsEndOfCycle) {
+            m_nextStep = getStepForPosition(m_lastPosition, false) + 1;
+        }
+        return;
+    }
 
-    m_reverseDirection ? m_nextPosition = m_range.end
-                       : m_nextPosition = m_range.start;
+    // at either end of the range the direction is turned, otherwise the
+    // cycle continues in the direction set by the params
+    if(m_lastPosition == m_range.end) {
+        m_nextStep = getStepForPosition(m_range.end - 1, true);
+    } else if(m_lastPosition == m_range.start) {
+        m_nextStep = getStepForPosition(m_range.start + 1, false);
+    } else if(m_reverseDirection) {
+        m_nextStep = getStepForPosition(m_lastPosition - 1, true);
+    } else {
+        m_nextStep = getStepForPosition(m_lastPosition + 1, false);
+    }
+}
+
+long long Cycle::wrap(long long value, long long period)
+{
+    auto remainder = value % period;
+    return remainder < 0 ? remainder + period : remainder;
 }
 
 } // namespace aleatoric
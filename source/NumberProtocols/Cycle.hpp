@@ -5,11 +5,21 @@
 #include "NumberProtocolParameters.hpp"
 #include "Range.hpp"
 
-#include <memory>
+#include <vector>
 
 namespace aleatoric {
-class CycleState;
-
+/*!
+ * @brief A protocol for producing numbers by cycling through a range
+ *
+ * The output is a pure function of the step within the cycle, the range and
+ * the direction (unidirectional forward, unidirectional reverse or
+ * bidirectional), so any step of the cycle can be calculated directly and the
+ * cycle can be moved to any step without stepping through those in between.
+ *
+ * Step 0 is the first number of the cycle for the current params: the start
+ * of the range when cycling forwards and the end of the range when cycling in
+ * reverse.
+ */
 class Cycle : public NumberProtocol {
   public:
     Cycle();
@@ -24,21 +34,37 @@ class Cycle : public NumberProtocol {
 
     double getDecimalNumber() override;
 
+    /*! @brief Returns the next numbers of the cycle, calculated in runs of
+     * consecutive numbers rather than one number at a time */
+    std::vector<int> getIntegerCollection(int size) override;
+
+    std::vector<double> getDecimalCollection(int size) override;
+
     void setParams(NumberProtocolConfig newParams) override;
 
     NumberProtocolConfig getParams() override;
 
+    /*! @brief Returns the number at the given step of the cycle without
+     * altering the state of the protocol */
+    int valueAt(long long step);
+
+    /*! @brief Moves the cycle so that the next number returned is the one at
+     * the given step */
+    void seek(long long step);
+
   private:
     Range m_range;
     bool m_bidirectional;
     bool m_reverseDirection;
-    std::unique_ptr<CycleState> m_state;
-    void setState();
-    void setRange(Range newRange);
-    void initialise();
-    int m_nextPosition;
+    long long m_nextStep;
     int m_lastPosition;
     bool m_haveRequestedFirstNumber;
+    long long getPeriod();
+    long long getPhase(long long step);
+    int getPosition(long long phase);
+    long long getStepForPosition(int position, bool descending);
+    void setNextStepForNewRange();
+    static long long wrap(long long value, long long period);
 };
 } // namespace aleatoric
 
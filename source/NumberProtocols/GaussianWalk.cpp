@@ -0,0 +1,113 @@
+#include "GaussianWalk.hpp"
+
+#include "ErrorChecker.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace aleatoric {
+GaussianWalk::GaussianWalk(std::unique_ptr<IGaussianGenerator> generator)
+: m_generator(std::move(generator)), m_range(0, 1), m_deviationFactor(0.1)
+{
+    m_generator->setDistribution(0.0, 1.0);
+    setStandardDeviation();
+    m_position = (m_range.start + m_range.end) / 2.0;
+}
+
+GaussianWalk::GaussianWalk(std::unique_ptr<IGaussianGenerator> generator,
+                           Range range,
+                           double deviationFactor)
+: m_generator(std::move(generator)),
+  m_range(range),
+  m_deviationFactor(deviationFactor)
+{
+    ErrorChecker::checkValueWithinUnitInterval(m_deviationFactor,
+                                               "deviationFactor");
+
+    m_generator->setDistribution(0.0, 1.0);
+    setStandardDeviation();
+    m_position = (m_range.start + m_range.end) / 2.0;
+}
+
+GaussianWalk::~GaussianWalk()
+{}
+
+int GaussianWalk::getIntegerNumber()
+{
+    return static_cast<int>(std::lround(getDecimalNumber()));
+}
+
+double GaussianWalk::getDecimalNumber()
+{
+    return takeStep(m_generator->getNumber());
+}
+
+std::vector<int> GaussianWalk::getIntegerCollection(int size)
+{
+    auto decimals = getDecimalCollection(size);
+
+    std::vector<int> collection(decimals.size());
+    for(int i = 0; i < static_cast<int>(collection.size()); i++) {
+        collection[i] = static_cast<int>(std::lround(decimals[i]));
+    }
+
+    return collection;
+}
+
+std::vector<double> GaussianWalk::getDecimalCollection(int size)
+{
+    std::vector<double> collection(std::max(size, 0));
+    m_generator->getNumbers(collection.data(), size);
+
+    for(auto &&step : collection) {
+        step = takeStep(step);
+    }
+
+    return collection;
+}
+
+void GaussianWalk::setParams(NumberProtocolConfig newParams)
+{
+    auto gaussianWalkParams = newParams.protocols.getGaussianWalk();
+
+    ErrorChecker::checkValueWithinUnitInterval(
+        gaussianWalkParams.getDeviationFactor(),
+        "deviationFactor");
+
+    m_deviationFactor = gaussianWalkParams.getDeviationFactor();
+    m_range = newParams.getRange();
+    setStandardDeviation();
+
+    if(!m_range.floatingPointIsInRange(m_position)) {
+        m_position = (m_range.start + m_range.end) / 2.0;
+    }
+}
+
+NumberProtocolConfig GaussianWalk::getParams()
+{
+    return NumberProtocolConfig(
+        m_range,
+        NumberProtocolParams(GaussianWalkParams(m_deviationFactor)));
+}
+
+// Private methods
+void GaussianWalk::setStandardDeviation()
+{
+    m_standardDeviation = (m_range.end - m_range.start) * m_deviationFactor;
+}
+
+double GaussianWalk::takeStep(double step)
+{
+    auto start = static_cast<double>(m_range.start);
+    auto end = static_cast<double>(m_range.end);
+    auto position = m_position + step * m_standardDeviation;
+
+    while(position < start || position > end) {
+        position = position < start ? 2.0 * start - position
+                                    : 2.0 * end - position;
+    }
+
+    m_position = position;
+    return m_position;
+}
+} // namespace aleatoric
@@ -0,0 +1,80 @@
+#ifndef GaussianWalk_hpp
+#define GaussianWalk_hpp
+
+#include "IGaussianGenerator.hpp"
+#include "NumberProtocol.hpp"
+#include "NumberProtocolParameters.hpp"
+#include "Range.hpp"
+
+#include <memory>
+
+namespace aleatoric {
+/*!
+ * @brief A protocol for producing random numbers
+ *
+ * A concrete implementation of the Protocol interface which forms part of a
+ * [Strategy](https://en.wikipedia.org/wiki/Strategy_pattern) design pattern
+ * (see Protocol for more information).
+ *
+ * Produces a walk through the range in which each step is drawn from a normal
+ * (Gaussian) distribution centred on the last number. Small steps are
+ * therefore common and large leaps rare, unlike GranularWalk in which every
+ * step up to the maximum is equally likely. This is the Brownian motion used
+ * by Xenakis for glissando and pitch cloud textures.
+ *
+ * The standard deviation of each step is given as a _deviation factor_: a
+ * fraction of the whole range.
+ *
+ * A step that would leave the range is reflected back into it from the
+ * boundary it crossed, so numbers gather neither at the edges (as they would if
+ * clamped) nor wrap around.
+ *
+ * The walk begins at the centre of the range; the first number returned is
+ * the first step from there. Integer numbers are the walk rounded to the
+ * nearest integer, and collections are produced with the steps drawn in bulk.
+ */
+class GaussianWalk : public NumberProtocol {
+  public:
+    GaussianWalk(std::unique_ptr<IGaussianGenerator> generator);
+
+    /*!
+     * @brief Construct a new GaussianWalk object
+     *
+     * @param generator An instance of GaussianGenerator, derived from
+     * IGaussianGenerator. Default construction is fine.
+     *
+     * @param range The range within which to produce numbers.
+     *
+     * @param deviationFactor The standard deviation of each step as a fraction
+     * of the range. Must be between 0.0 and 1.0 (inclusive).
+     */
+    GaussianWalk(std::unique_ptr<IGaussianGenerator> generator,
+                 Range range,
+                 double deviationFactor);
+
+    ~GaussianWalk();
+
+    int getIntegerNumber() override;
+
+    double getDecimalNumber() override;
+
+    std::vector<int> getIntegerCollection(int size) override;
+
+    std::vector<double> getDecimalCollection(int size) override;
+
+    void setParams(NumberProtocolConfig newParams) override;
+
+    NumberProtocolConfig getParams() override;
+
+  private:
+    std::unique_ptr<IGaussianGenerator> m_generator;
+    Range m_range;
+    double m_deviationFactor;
+    double m_standardDeviation;
+    double m_position;
+    void setStandardDeviation();
+    double takeStep(double step);
+};
+} // namespace aleatoric
+
+#endif /* GaussianWalk_hpp */
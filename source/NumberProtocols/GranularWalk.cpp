@@ -5,7 +5,7 @@
 #include <math.h>
 
 namespace aleatoric {
-GranularWalk::GranularWalk(std::unique_ptr<UniformRealGenerator> generator)
+GranularWalk::GranularWalk(std::unique_ptr<IUniformRealGenerator> generator)
 : m_generator(std::move(generator)),
   m_range(0, 1),
   m_deviationFactor(1.0),
@@ -14,7 +14,7 @@ GranularWalk::GranularWalk(std::unique_ptr<UniformRealGenerator> generator)
     initialise();
 }
 
-GranularWalk::GranularWalk(std::unique_ptr<UniformRealGenerator> generator,
+GranularWalk::GranularWalk(std::unique_ptr<IUniformRealGenerator> generator,
                            Range range,
                            double deviationFactor)
 : m_generator(std::move(generator)),
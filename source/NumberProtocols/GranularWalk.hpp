@@ -1,10 +1,10 @@
 #ifndef GranularWalk_hpp
 #define GranularWalk_hpp
 
+#include "IUniformRealGenerator.hpp"
 #include "NumberProtocol.hpp"
 #include "NumberProtocolParameters.hpp"
 #include "Range.hpp"
-#include "UniformRealGenerator.hpp"
 
 #include <memory>
 
@@ -73,13 +73,14 @@ namespace aleatoric {
  */
 class GranularWalk : public NumberProtocol {
   public:
-    GranularWalk(std::unique_ptr<UniformRealGenerator> generator);
+    GranularWalk(std::unique_ptr<IUniformRealGenerator> generator);
 
     /*!
      * @brief Construct a new GranularWalk object
      *
-     * @param generator An instance of UniformGenerator. Default
-     * construction is fine.
+     * @param generator An instance of UniformRealGenerator. Default
+     * construction is fine. A LowDiscrepancyRealGenerator covers the range
+     * more evenly.
      *
      * @param range The range within which to produce numbers.
      *
@@ -90,7 +91,7 @@ class GranularWalk : public NumberProtocol {
      * use of the maximum step and sub-ranges, see above. Note that the
      * value provided must be between 0.0 and 1.0 (inclusive).
      */
-    GranularWalk(std::unique_ptr<UniformRealGenerator> generator,
+    GranularWalk(std::unique_ptr<IUniformRealGenerator> generator,
                  Range range,
                  double deviationFactor);
 
@@ -109,7 +110,7 @@ class GranularWalk : public NumberProtocol {
     NumberProtocolConfig getParams() override;
 
   private:
-    std::unique_ptr<UniformRealGenerator> m_generator;
+    std::unique_ptr<IUniformRealGenerator> m_generator;
     Range m_range;
     double m_deviationFactor;
     double m_maxStep;
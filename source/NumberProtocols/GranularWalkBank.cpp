@@ -0,0 +1,131 @@
+#include "GranularWalkBank.hpp"
+
+#include "EngineBank.hpp"
+#include "ErrorChecker.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace aleatoric {
+GranularWalkBank::GranularWalkBank(int numberOfVoices)
+: GranularWalkBank(numberOfVoices, Range(0, 1), 1.0)
+{}
+
+GranularWalkBank::GranularWalkBank(int numberOfVoices,
+                                   Range range,
+                                   double deviationFactor)
+: m_engines(std::make_unique<EngineBank>())
+{
+    if(numberOfVoices < 1) {
+        ErrorChecker::throwInvalidArgument(
+            "The number of voices must be greater than 0");
+    }
+
+    ErrorChecker::checkValueWithinUnitInterval(deviationFactor,
+                                               "deviationFactor");
+
+    auto rangeStart = static_cast<double>(range.start);
+    auto rangeEnd = static_cast<double>(range.end);
+
+    m_engines->setSize(numberOfVoices);
+    m_randomNumbers.resize(numberOfVoices);
+    m_deviationFactors.assign(numberOfVoices, deviationFactor);
+    m_rangeStarts.assign(numberOfVoices, rangeStart);
+    m_rangeEnds.assign(numberOfVoices, rangeEnd);
+    m_maxSteps.assign(numberOfVoices,
+                      (rangeEnd - rangeStart) * deviationFactor);
+    m_haveRequestedFirstNumber.assign(numberOfVoices, 0);
+    m_lastReturnedNumbers.assign(numberOfVoices, rangeStart);
+}
+
+GranularWalkBank::~GranularWalkBank()
+{}
+
+int GranularWalkBank::getNumberOfVoices()
+{
+    return static_cast<int>(m_lastReturnedNumbers.size());
+}
+
+void GranularWalkBank::step()
+{
+    m_engines->getNumbers(m_randomNumbers.data());
+
+    auto size = m_lastReturnedNumbers.size();
+    auto randomNumbers = m_randomNumbers.data();
+    auto rangeStarts = m_rangeStarts.data();
+    auto rangeEnds = m_rangeEnds.data();
+    auto maxSteps = m_maxSteps.data();
+    auto haveRequestedFirstNumber = m_haveRequestedFirstNumber.data();
+    auto lastNumbers = m_lastReturnedNumbers.data();
+
+    // 2^-32, for scaling the 32 bit random numbers to the unit interval
+    const double unitScale = 1.0 / 4294967296.0;
+
+    // Free of branches so the loop can be vectorised
+    for(size_t i = 0; i < size; i++) {
+        auto started = haveRequestedFirstNumber[i] != 0;
+        auto stepStart = std::max(rangeStarts[i], lastNumbers[i] - maxSteps[i]);
+        auto stepEnd = std::min(rangeEnds[i], lastNumbers[i] + maxSteps[i]);
+        auto subRangeStart = started ? stepStart : rangeStarts[i];
+        auto subRangeEnd = started ? stepEnd : rangeEnds[i];
+
+        auto unit = randomNumbers[i] * unitScale;
+        lastNumbers[i] = subRangeStart + unit * (subRangeEnd - subRangeStart);
+        haveRequestedFirstNumber[i] = 1;
+    }
+}
+
+const std::vector<double> &GranularWalkBank::getDecimalNumbers()
+{
+    return m_lastReturnedNumbers;
+}
+
+void GranularWalkBank::setParams(int voice, NumberProtocolConfig newParams)
+{
+    checkVoiceIsValid(voice);
+
+    auto deviationFactor =
+        newParams.protocols.getGranularWalk().getDeviationFactor();
+    ErrorChecker::checkValueWithinUnitInterval(deviationFactor,
+                                               "deviationFactor");
+
+    auto newRange = newParams.getRange();
+    auto rangeStart = static_cast<double>(newRange.start);
+    auto rangeEnd = static_cast<double>(newRange.end);
+
+    m_deviationFactors[voice] = deviationFactor;
+    m_rangeStarts[voice] = rangeStart;
+    m_rangeEnds[voice] = rangeEnd;
+    m_maxSteps[voice] = (rangeEnd - rangeStart) * deviationFactor;
+
+    // As with GranularWalk, the walk continues from the last number if it is
+    // within the new range, otherwise the next step selects from the whole
+    // range
+    if(!newRange.floatingPointIsInRange(m_lastReturnedNumbers[voice])) {
+        m_haveRequestedFirstNumber[voice] = 0;
+    }
+}
+
+NumberProtocolConfig GranularWalkBank::getParams(int voice)
+{
+    checkVoiceIsValid(voice);
+
+    // The range bounds are held as doubles for the step loop, but were set
+    // from integers, so converting back is exact
+    return NumberProtocolConfig(
+        Range(static_cast<int>(m_rangeStarts[voice]),
+              static_cast<int>(m_rangeEnds[voice])),
+        NumberProtocolParams(GranularWalkParams(m_deviationFactors[voice])));
+}
+
+// Private methods
+void GranularWalkBank::checkVoiceIsValid(int voice)
+{
+    if(voice < 0 || voice >= getNumberOfVoices()) {
+        ErrorChecker::throwInvalidArgument(
+            "The voice must be between 0 and " +
+            std::to_string(getNumberOfVoices() - 1));
+    }
+}
+
+} // namespace aleatoric
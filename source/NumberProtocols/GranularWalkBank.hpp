@@ -0,0 +1,72 @@
+#ifndef GranularWalkBank_hpp
+#define GranularWalkBank_hpp
+
+#include "NumberProtocolParameters.hpp"
+#include "Range.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+class EngineBank;
+
+/*!
+ * @brief Many independent GranularWalk voices, advanced together
+ *
+ * Each voice follows the GranularWalk protocol (see GranularWalk) with its own
+ * range, deviation factor and random number engine. The state of every voice is
+ * held in contiguous arrays, so that a single call to step() advances all
+ * voices in loops the compiler is able to vectorise.
+ *
+ * The range and GranularWalkParams of each voice can be set individually.
+ */
+class GranularWalkBank {
+  public:
+    GranularWalkBank(int numberOfVoices);
+
+    /*!
+     * @param numberOfVoices The number of independent walks. Must be at least
+     * 1.
+     *
+     * @param range The range every voice starts with.
+     *
+     * @param deviationFactor The deviation factor every voice starts with.
+     * Must be between 0.0 and 1.0 (inclusive).
+     */
+    GranularWalkBank(int numberOfVoices, Range range, double deviationFactor);
+
+    ~GranularWalkBank();
+
+    int getNumberOfVoices();
+
+    /*!
+     * @brief Advances every voice one step of its walk. As with GranularWalk,
+     * the first step of a voice selects from its whole range.
+     */
+    void step();
+
+    /*!
+     * @return the number each voice selected at the last step, indexed by
+     * voice.
+     */
+    const std::vector<double> &getDecimalNumbers();
+
+    void setParams(int voice, NumberProtocolConfig newParams);
+
+    NumberProtocolConfig getParams(int voice);
+
+  private:
+    std::unique_ptr<EngineBank> m_engines;
+    std::vector<uint32_t> m_randomNumbers;
+    std::vector<double> m_deviationFactors;
+    std::vector<double> m_rangeStarts;
+    std::vector<double> m_rangeEnds;
+    std::vector<double> m_maxSteps;
+    std::vector<int> m_haveRequestedFirstNumber;
+    std::vector<double> m_lastReturnedNumbers;
+    void checkVoiceIsValid(int voice);
+};
+} // namespace aleatoric
+
+#endif /* GranularWalkBank_hpp */
@@ -2,6 +2,8 @@
 
 #include "SeriesPrinciple.hpp"
 
+#include <algorithm>
+
 namespace aleatoric {
 GroupedRepetition::GroupedRepetition(
     std::unique_ptr<IDiscreteGenerator> numberGenerator,
@@ -34,20 +36,8 @@ GroupedRepetition::~GroupedRepetition()
 
 int GroupedRepetition::getIntegerNumber()
 {
-    if(m_seriesPrinciple->seriesIsComplete(m_groupingGenerator)) {
-        m_seriesPrinciple->resetSeries(m_groupingGenerator);
-    }
-
-    if(m_seriesPrinciple->seriesIsComplete(m_numberGenerator)) {
-        m_seriesPrinciple->resetSeries(m_numberGenerator);
-    }
-
     if(m_groupingCount == 0) {
-        auto groupingIndex = m_seriesPrinciple->getNumber(m_groupingGenerator);
-        m_groupingCount = m_groupings[groupingIndex];
-
-        m_currentReturnableNumber =
-            m_seriesPrinciple->getNumber(m_numberGenerator) + m_range.offset;
+        startNewGroup();
     }
 
     m_groupingCount--;
@@ -71,6 +61,44 @@ void GroupedRepetition::setParams(NumberProtocolConfig newParams)
     m_groupingCount = 0;
 }
 
+GroupedRepetition::Group GroupedRepetition::getGroup()
+{
+    if(m_groupingCount == 0) {
+        startNewGroup();
+    }
+
+    Group group {m_currentReturnableNumber, m_groupingCount};
+    m_groupingCount = 0;
+
+    return group;
+}
+
+std::vector<int> GroupedRepetition::getIntegerCollection(int size)
+{
+    std::vector<int> collection(std::max(size, 0));
+
+    // Write whole groupings at a time, so the generators and series are only
+    // consulted once per grouping rather than once per number
+    auto out = collection.begin();
+    while(out != collection.end()) {
+        if(m_groupingCount == 0) {
+            startNewGroup();
+        }
+
+        auto run = std::min<long long>(m_groupingCount, collection.end() - out);
+        out = std::fill_n(out, run, m_currentReturnableNumber);
+        m_groupingCount -= static_cast<int>(run);
+    }
+
+    return collection;
+}
+
+std::vector<double> GroupedRepetition::getDecimalCollection(int size)
+{
+    auto integers = getIntegerCollection(size);
+    return std::vector<double>(integers.begin(), integers.end());
+}
+
 NumberProtocolConfig GroupedRepetition::getParams()
 {
     return NumberProtocolConfig(
@@ -86,4 +114,21 @@ void GroupedRepetition::initialise()
     m_groupingCount = 0;
 }
 
+void GroupedRepetition::startNewGroup()
+{
+    if(m_seriesPrinciple->seriesIsComplete(m_groupingGenerator)) {
+        m_seriesPrinciple->resetSeries(m_groupingGenerator);
+    }
+
+    if(m_seriesPrinciple->seriesIsComplete(m_numberGenerator)) {
+        m_seriesPrinciple->resetSeries(m_numberGenerator);
+    }
+
+    auto groupingIndex = m_seriesPrinciple->getNumber(m_groupingGenerator);
+    m_groupingCount = m_groupings[groupingIndex];
+
+    m_currentReturnableNumber =
+        m_seriesPrinciple->getNumber(m_numberGenerator) + m_range.offset;
+}
+
 } // namespace aleatoric
@@ -7,12 +7,19 @@
 #include "Range.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace aleatoric {
 class SeriesPrinciple;
 
 class GroupedRepetition : public NumberProtocol {
   public:
+    /*! @brief A number and the count of times it is to be repeated */
+    struct Group {
+        int number;
+        int count;
+    };
+
     GroupedRepetition(std::unique_ptr<IDiscreteGenerator> numberGenerator,
                       std::unique_ptr<IDiscreteGenerator> groupingGenerator);
 
@@ -27,6 +34,19 @@ class GroupedRepetition : public NumberProtocol {
 
     double getDecimalNumber() override;
 
+    /*! @brief Returns the current grouping as a whole, rather than one number
+     * at a time
+     *
+     * If numbers have already been requested from the current grouping, only
+     * the remainder of it is returned. Either way, the grouping is consumed and
+     * the next request for a number or group starts a new grouping.
+     */
+    Group getGroup();
+
+    std::vector<int> getIntegerCollection(int size) override;
+
+    std::vector<double> getDecimalCollection(int size) override;
+
     void setParams(NumberProtocolConfig newParams) override;
 
     NumberProtocolConfig getParams() override;
@@ -40,6 +60,7 @@ class GroupedRepetition : public NumberProtocol {
     int m_groupingCount;
     int m_currentReturnableNumber;
     void initialise();
+    void startNewGroup();
 };
 } // namespace aleatoric
 #endif /* GroupedRepetition */
@@ -0,0 +1,162 @@
+#include "LSystem.hpp"
+
+#include "ErrorChecker.hpp"
+
+namespace aleatoric {
+LSystem::LSystem(std::unique_ptr<IDiscreteGenerator> generator)
+: m_generator(std::move(generator)), m_range(0, 1)
+{
+    LSystemParams params({0}, {{0, {0, 1}, 1.0}, {1, {0}, 1.0}}, 8);
+    initialise(m_range, params);
+}
+
+LSystem::LSystem(std::unique_ptr<IDiscreteGenerator> generator,
+                 Range range,
+                 LSystemParams params)
+: m_generator(std::move(generator)), m_range(range)
+{
+    initialise(range, params);
+}
+
+LSystem::~LSystem()
+{}
+
+int LSystem::getIntegerNumber()
+{
+    while(true) {
+        if(m_stack.empty()) {
+            m_stack.push_back({&m_axiom, 0});
+        }
+
+        auto &frame = m_stack.back();
+        if(frame.position == frame.symbols->size()) {
+            m_stack.pop_back();
+            continue;
+        }
+
+        auto symbol = (*frame.symbols)[frame.position];
+        frame.position++;
+
+        auto index = symbol - m_range.offset;
+        auto generation = static_cast<int>(m_stack.size()) - 1;
+        if(generation == m_generations ||
+           m_productionOffsets[index] == m_productionOffsets[index + 1]) {
+            return symbol;
+        }
+
+        m_stack.push_back({&getSuccessor(symbol), 0});
+    }
+}
+
+double LSystem::getDecimalNumber()
+{
+    return static_cast<double>(getIntegerNumber());
+}
+
+void LSystem::setParams(NumberProtocolConfig newParams)
+{
+    auto params = newParams.protocols.getLSystem();
+    auto range = newParams.getRange();
+    initialise(range, params);
+    m_range = range;
+}
+
+NumberProtocolConfig LSystem::getParams()
+{
+    return NumberProtocolConfig(
+        m_range,
+        NumberProtocolParams(
+            LSystemParams(m_axiom, m_productions, m_generations)));
+}
+
+// Private methods
+const std::vector<int> &LSystem::getSuccessor(int symbol)
+{
+    auto index = symbol - m_range.offset;
+    auto first = m_productionOffsets[index];
+    auto last = m_productionOffsets[index + 1];
+
+    if(last - first == 1) {
+        return m_productions[m_productionIndices[first]].successor;
+    }
+
+    // Consecutive rewritings of the same symbol keep the distribution in place
+    if(m_distributionSymbol != symbol) {
+        std::vector<double> weights;
+        for(int i = first; i < last; i++) {
+            weights.push_back(m_productions[m_productionIndices[i]].weight);
+        }
+        m_generator->setDistributionVector(weights);
+        m_distributionSymbol = symbol;
+    }
+
+    auto choice = first + m_generator->getNumber();
+    return m_productions[m_productionIndices[choice]].successor;
+}
+
+void LSystem::initialise(Range range, LSystemParams &params)
+{
+    auto axiom = params.getAxiom();
+    auto productions = params.getProductions();
+    auto generations = params.getGenerations();
+
+    if(axiom.empty()) {
+        ErrorChecker::throwInvalidArgument(
+            "The axiom must contain at least one symbol");
+    }
+
+    if(generations < 0) {
+        ErrorChecker::throwInvalidArgument(
+            "The number of generations must be 0 or greater");
+    }
+
+    bool symbolsInRange = true;
+    for(auto &&symbol : axiom) {
+        symbolsInRange &= range.numberIsInRange(symbol);
+    }
+
+    for(auto &&production : productions) {
+        if(production.successor.empty()) {
+            ErrorChecker::throwInvalidArgument(
+                "Successors must contain at least one symbol");
+        }
+
+        if(production.weight <= 0.0) {
+            ErrorChecker::throwInvalidArgument(
+                "Production weights must be greater than 0");
+        }
+
+        symbolsInRange &= range.numberIsInRange(production.predecessor);
+        for(auto &&symbol : production.successor) {
+            symbolsInRange &= range.numberIsInRange(symbol);
+        }
+    }
+
+    if(!symbolsInRange) {
+        ErrorChecker::throwInvalidArgument("Symbols must be within the range");
+    }
+
+    // Group the productions by predecessor, keeping their order within each
+    std::vector<int> offsets(range.size + 1, 0);
+    for(auto &&production : productions) {
+        offsets[production.predecessor - range.offset + 1]++;
+    }
+    for(int i = 0; i < range.size; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+
+    std::vector<int> indices(productions.size());
+    auto next = offsets;
+    for(int i = 0; i < static_cast<int>(productions.size()); i++) {
+        indices[next[productions[i].predecessor - range.offset]++] = i;
+    }
+
+    m_axiom = axiom;
+    m_productions = productions;
+    m_generations = generations;
+    m_productionOffsets = offsets;
+    m_productionIndices = indices;
+    m_distributionSymbol = range.offset - 1;
+    m_stack.clear();
+}
+} // namespace aleatoric
@@ -0,0 +1,91 @@
+#ifndef LSystem_hpp
+#define LSystem_hpp
+
+#include "IDiscreteGenerator.hpp"
+#include "NumberProtocol.hpp"
+#include "NumberProtocolParameters.hpp"
+#include "Range.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+/*!
+ * @brief A protocol for producing numbers by rewriting a sequence
+ *
+ * A concrete implementation of the Protocol interface which forms part of a
+ * [Strategy](https://en.wikipedia.org/wiki/Strategy_pattern) design pattern
+ * (see Protocol for more information).
+ *
+ * Implements a Lindenmayer system (L-system). Starting from the axiom, every
+ * symbol that has a production is replaced by the production's successor, and
+ * this is repeated for the given number of generations. The symbols of the
+ * resulting sequence are the numbers produced. Symbols are numbers within the
+ * range (see LSystemParams). The self-similar sequences that result lend
+ * themselves to phrase structures and rhythms that recur at several scales.
+ *
+ * Where a symbol has more than one production, the production used is chosen
+ * at random, according to the weights, each time the symbol is rewritten.
+ *
+ * Once the whole sequence has been produced it starts again from the axiom
+ * (with fresh choices of production for stochastic productions).
+ *
+ * __Further detail__: The sequence is never built. Symbols are rewritten only
+ * when they are reached, by walking the tree of rewritings depth first with a
+ * stack holding a position within one successor for each generation. Memory
+ * is therefore proportional to the number of generations rather than the
+ * length of the sequence, which grows exponentially with the generations.
+ */
+class LSystem : public NumberProtocol {
+  public:
+    LSystem(std::unique_ptr<IDiscreteGenerator> generator);
+
+    /*!
+     * @param generator Should be an instance of DiscreteGenerator. Default
+     * construction is fine. Only used where a symbol has more than one
+     * production.
+     *
+     * @param range The range within which to produce numbers.
+     *
+     * @param params The axiom, productions and generations. See LSystemParams.
+     *
+     * @exception std::invalid_argument if the axiom or any successor is empty,
+     * a symbol is not within the range, a weight is not greater than 0 or the
+     * generations are less than 0.
+     */
+    LSystem(std::unique_ptr<IDiscreteGenerator> generator,
+            Range range,
+            LSystemParams params);
+
+    ~LSystem();
+
+    int getIntegerNumber() override;
+
+    double getDecimalNumber() override;
+
+    void setParams(NumberProtocolConfig newParams) override;
+
+    NumberProtocolConfig getParams() override;
+
+  private:
+    struct Frame {
+        const std::vector<int> *symbols;
+        std::size_t position;
+    };
+
+    std::unique_ptr<IDiscreteGenerator> m_generator;
+    Range m_range;
+    std::vector<int> m_axiom;
+    std::vector<Production> m_productions;
+    int m_generations;
+    std::vector<int> m_productionOffsets;
+    std::vector<int> m_productionIndices;
+    int m_distributionSymbol;
+    std::vector<Frame> m_stack;
+    const std::vector<int> &getSuccessor(int symbol);
+    void initialise(Range range, LSystemParams &params);
+};
+} // namespace aleatoric
+
+#endif /* LSystem_hpp */
@@ -0,0 +1,206 @@
+#include "Markov.hpp"
+
+#include "ErrorChecker.hpp"
+
+#include <algorithm>
+
+namespace aleatoric {
+Markov::Markov(std::unique_ptr<IUniformRealGenerator> generator)
+: m_generator(std::move(generator)),
+  m_range(0, 1),
+  m_haveRequestedFirstNumber(false),
+  m_lastState(0)
+{
+    m_generator->setDistribution(0.0, 1.0);
+}
+
+Markov::Markov(std::unique_ptr<IUniformRealGenerator> generator,
+               Range range,
+               MarkovParams transitions)
+: m_generator(std::move(generator)),
+  m_range(range),
+  m_haveRequestedFirstNumber(false),
+  m_lastState(0)
+{
+    checkTransitionsAreValid(transitions, m_range);
+    m_generator->setDistribution(0.0, 1.0);
+    setTransitions(transitions);
+}
+
+Markov::~Markov()
+{}
+
+int Markov::getIntegerNumber()
+{
+    if(m_haveRequestedFirstNumber && stateHasTransitions(m_lastState)) {
+        auto rowStart = m_rowOffsets[m_lastState];
+        auto rowSize = m_rowOffsets[m_lastState + 1] - rowStart;
+
+        // A single draw selects both a column within the row (the integral
+        // part) and whether to keep it or take its alias (the fractional part)
+        auto scaled = m_generator->getNumber() * rowSize;
+        auto column = std::min(static_cast<int>(scaled), rowSize - 1);
+        auto index = rowStart + column;
+
+        m_lastState = scaled - column < m_aliasProbabilities[index]
+                          ? m_columns[index]
+                          : m_aliasColumns[index];
+    } else {
+        auto scaled = m_generator->getNumber() * m_range.size;
+        m_lastState = std::min(static_cast<int>(scaled), m_range.size - 1);
+    }
+
+    m_haveRequestedFirstNumber = true;
+
+    return m_lastState + m_range.offset;
+}
+
+double Markov::getDecimalNumber()
+{
+    return static_cast<double>(getIntegerNumber());
+}
+
+void Markov::setParams(NumberProtocolConfig newParams)
+{
+    auto transitions = newParams.protocols.getMarkov();
+    auto newRange = newParams.getRange();
+    checkTransitionsAreValid(transitions, newRange);
+
+    // continue from the last number if it is within the new range
+    if(m_haveRequestedFirstNumber) {
+        auto lastNumber = m_lastState + m_range.offset;
+        m_haveRequestedFirstNumber = newRange.numberIsInRange(lastNumber);
+        m_lastState = lastNumber - newRange.offset;
+    }
+
+    m_range = newRange;
+    setTransitions(transitions);
+}
+
+NumberProtocolConfig Markov::getParams()
+{
+    return NumberProtocolConfig(
+        m_range,
+        NumberProtocolParams(MarkovParams(m_rowOffsets, m_columns, m_weights)));
+}
+
+// Private methods
+bool Markov::stateHasTransitions(int state)
+{
+    return !m_rowOffsets.empty() &&
+           m_rowOffsets[state + 1] > m_rowOffsets[state];
+}
+
+void Markov::setTransitions(MarkovParams transitions)
+{
+    m_rowOffsets = transitions.getRowOffsets();
+    m_columns = transitions.getColumns();
+    m_weights = transitions.getWeights();
+
+    m_aliasProbabilities.assign(m_columns.size(), 1.0);
+    m_aliasColumns = m_columns;
+
+    for(size_t row = 0; row + 1 < m_rowOffsets.size(); row++) {
+        setAliasTable(m_rowOffsets[row], m_rowOffsets[row + 1]);
+    }
+}
+
+void Markov::setAliasTable(int rowStart, int rowEnd)
+{
+    auto rowSize = rowEnd - rowStart;
+    if(rowSize == 0) {
+        return;
+    }
+
+    double sum = 0.0;
+    for(int i = rowStart; i < rowEnd; i++) {
+        sum += m_weights[i];
+    }
+
+    // Vose's method: scale the weights so they average 1, then repeatedly
+    // top up an under-full column with the excess of an over-full one
+    std::vector<double> scaled(rowSize);
+    std::vector<int> small;
+    std::vector<int> large;
+    for(int i = 0; i < rowSize; i++) {
+        scaled[i] = m_weights[rowStart + i] * rowSize / sum;
+        if(scaled[i] < 1.0) {
+            small.push_back(i);
+        } else {
+            large.push_back(i);
+        }
+    }
+
+    while(!small.empty() && !large.empty()) {
+        auto under = small.back();
+        small.pop_back();
+        auto over = large.back();
+
+        m_aliasProbabilities[rowStart + under] = scaled[under];
+        m_aliasColumns[rowStart + under] = m_columns[rowStart + over];
+
+        scaled[over] -= 1.0 - scaled[under];
+        if(scaled[over] < 1.0) {
+            large.pop_back();
+            small.push_back(over);
+        }
+    }
+
+    // anything left over is full, barring rounding error
+    for(auto &&i : small) {
+        m_aliasProbabilities[rowStart + i] = 1.0;
+    }
+    for(auto &&i : large) {
+        m_aliasProbabilities[rowStart + i] = 1.0;
+    }
+}
+
+void Markov::checkTransitionsAreValid(MarkovParams &transitions,
+                                      const Range &range)
+{
+    auto rowOffsets = transitions.getRowOffsets();
+    auto columns = transitions.getColumns();
+    auto weights = transitions.getWeights();
+
+    if(rowOffsets.empty() && columns.empty() && weights.empty()) {
+        return;
+    }
+
+    if(static_cast<int>(rowOffsets.size()) != range.size + 1 ||
+       rowOffsets.front() != 0 ||
+       rowOffsets.back() != static_cast<int>(columns.size()) ||
+       columns.size() != weights.size()) {
+        ErrorChecker::throwInvalidArgument(
+            "The row offsets must have one more item than the range size, "
+            "start at 0 and end at the number of columns, which must match "
+            "the number of weights");
+    }
+
+    for(int row = 0; row < range.size; row++) {
+        if(rowOffsets[row + 1] < rowOffsets[row]) {
+            ErrorChecker::throwInvalidArgument(
+                "The row offsets must not decrease");
+        }
+
+        double sum = 0.0;
+        for(int i = rowOffsets[row]; i < rowOffsets[row + 1]; i++) {
+            if(columns[i] < 0 || columns[i] >= range.size) {
+                ErrorChecker::throwInvalidArgument(
+                    "Columns must be indices within the range");
+            }
+
+            if(weights[i] < 0.0) {
+                ErrorChecker::throwInvalidArgument(
+                    "Weights must not be negative");
+            }
+
+            sum += weights[i];
+        }
+
+        if(rowOffsets[row + 1] > rowOffsets[row] && sum <= 0.0) {
+            ErrorChecker::throwInvalidArgument(
+                "The weights of a row with transitions must not all be 0");
+        }
+    }
+}
+} // namespace aleatoric
@@ -0,0 +1,83 @@
+#ifndef Markov_hpp
+#define Markov_hpp
+
+#include "IUniformRealGenerator.hpp"
+#include "NumberProtocol.hpp"
+#include "NumberProtocolParameters.hpp"
+#include "Range.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+/*!
+ * @brief A protocol for producing random numbers
+ *
+ * A concrete implementation of the Protocol interface which forms part of a
+ * [Strategy](https://en.wikipedia.org/wiki/Strategy_pattern) design pattern
+ * (see Protocol for more information).
+ *
+ * Selects each number according to a
+ * [Markov chain](https://en.wikipedia.org/wiki/Markov_chain): the likelihood
+ * of each number being selected depends only on the number selected last.
+ * The transitions are supplied as a sparse matrix (see MarkovParams), so only
+ * the transitions that can actually occur are stored.
+ *
+ * __Further detail__:
+ *
+ * The first number is selected from the whole range with equal probability.
+ * Thereafter, the next number is selected from the transitions of the last
+ * number. A number with no transitions is treated like the first: the next
+ * number is selected from the whole range with equal probability.
+ *
+ * Each row of the matrix is converted to an alias table (Vose's method) when
+ * the params are set, so each number costs a single uniform draw and constant
+ * time, however many states there are.
+ */
+class Markov : public NumberProtocol {
+  public:
+    Markov(std::unique_ptr<IUniformRealGenerator> generator);
+
+    /*!
+     * @param generator Should be an instance of UniformRealGenerator. Default
+     * construction is fine.
+     *
+     * @param range The range within which to produce numbers.
+     *
+     * @param transitions The transition matrix. See MarkovParams.
+     */
+    Markov(std::unique_ptr<IUniformRealGenerator> generator,
+           Range range,
+           MarkovParams transitions);
+
+    ~Markov();
+
+    int getIntegerNumber() override;
+
+    double getDecimalNumber() override;
+
+    void setParams(NumberProtocolConfig newParams) override;
+
+    NumberProtocolConfig getParams() override;
+
+  private:
+    std::unique_ptr<IUniformRealGenerator> m_generator;
+    Range m_range;
+    std::vector<int> m_rowOffsets;
+    std::vector<int> m_columns;
+    std::vector<double> m_weights;
+    // Alias tables, stored alongside the columns: the probability of keeping
+    // each column when it is drawn, and the column to use otherwise
+    std::vector<double> m_aliasProbabilities;
+    std::vector<int> m_aliasColumns;
+    bool m_haveRequestedFirstNumber;
+    int m_lastState;
+    bool stateHasTransitions(int state);
+    void setTransitions(MarkovParams transitions);
+    void setAliasTable(int rowStart, int rowEnd);
+    void checkTransitionsAreValid(MarkovParams &transitions,
+                                  const Range &range);
+};
+} // namespace aleatoric
+
+#endif /* Markov_hpp */
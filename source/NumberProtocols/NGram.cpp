@@ -0,0 +1,276 @@
+#include "NGram.hpp"
+
+#include "ErrorChecker.hpp"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+namespace aleatoric {
+namespace {
+const uint64_t emptyContextHash = 14695981039346656037ULL;
+const int maxOrder = 8;
+} // namespace
+
+NGram::NGram(std::unique_ptr<IUniformGenerator> generator)
+: m_generator(std::move(generator)), m_range(0, 1), m_order(1)
+{
+    std::vector<std::vector<int>> emptyCorpus;
+    train(emptyCorpus);
+}
+
+NGram::NGram(std::unique_ptr<IUniformGenerator> generator,
+             Range range,
+             NGramParams params)
+: m_generator(std::move(generator)), m_range(range), m_order(params.getOrder())
+{
+    checkParamsAreValid(params, m_range);
+    auto corpus = params.getCorpus();
+    train(corpus);
+}
+
+NGram::~NGram()
+{}
+
+int NGram::getIntegerNumber()
+{
+    int number;
+
+    if(m_contexts.empty()) {
+        m_generator->setDistribution(0, m_range.size - 1);
+        number = m_generator->getNumber();
+    } else {
+        // hash every length of context up front, most recent number first
+        auto historySize = static_cast<int>(m_history.size());
+        uint64_t hashes[maxOrder + 1];
+        hashes[0] = emptyContextHash;
+        for(int length = 1; length <= historySize; length++) {
+            hashes[length] =
+                addToHash(hashes[length - 1], m_history[historySize - length]);
+        }
+
+        // back off from the longest context until one is found. The empty
+        // context always is.
+        auto contextIndex = -1;
+        for(int length = historySize; contextIndex < 0; length--) {
+            contextIndex = findContext(hashes[length],
+                                       length,
+                                       m_history.data() + historySize);
+        }
+
+        auto &context = m_contexts[contextIndex];
+        auto countsStart =
+            m_cumulativeCounts.begin() + context.continuationsStart;
+        auto countsEnd = m_cumulativeCounts.begin() + context.continuationsEnd;
+
+        m_generator->setDistribution(0, *(countsEnd - 1) - 1);
+        auto selected =
+            std::upper_bound(countsStart, countsEnd, m_generator->getNumber());
+        number = m_continuations[selected - m_cumulativeCounts.begin()];
+    }
+
+    m_history.push_back(number);
+    if(static_cast<int>(m_history.size()) > m_order) {
+        m_history.erase(m_history.begin());
+    }
+
+    return number + m_range.offset;
+}
+
+double NGram::getDecimalNumber()
+{
+    return static_cast<double>(getIntegerNumber());
+}
+
+void NGram::setParams(NumberProtocolConfig newParams)
+{
+    auto params = newParams.protocols.getNGram();
+    auto newRange = newParams.getRange();
+    checkParamsAreValid(params, newRange);
+
+    m_range = newRange;
+    m_order = params.getOrder();
+    auto corpus = params.getCorpus();
+    train(corpus);
+}
+
+NumberProtocolConfig NGram::getParams()
+{
+    std::vector<std::vector<int>> corpus;
+    for(size_t i = 0; i < m_sequenceStarts.size(); i++) {
+        auto start = m_corpus.begin() + m_sequenceStarts[i];
+        auto end = i + 1 < m_sequenceStarts.size()
+                       ? m_corpus.begin() + m_sequenceStarts[i + 1]
+                       : m_corpus.end();
+
+        std::vector<int> sequence;
+        for(auto it = start; it != end; it++) {
+            sequence.push_back(*it + m_range.offset);
+        }
+        corpus.push_back(sequence);
+    }
+
+    return NumberProtocolConfig(
+        m_range,
+        NumberProtocolParams(NGramParams(m_order, corpus)));
+}
+
+// Private methods
+void NGram::train(std::vector<std::vector<int>> &corpus)
+{
+    m_corpus.clear();
+    m_sequenceStarts.clear();
+    m_contexts.clear();
+    m_slots.assign(16, -1);
+    m_continuations.clear();
+    m_cumulativeCounts.clear();
+    m_history.clear();
+
+    for(auto &&sequence : corpus) {
+        m_sequenceStarts.push_back(static_cast<int>(m_corpus.size()));
+        for(auto &&number : sequence) {
+            m_corpus.push_back(number - m_range.offset);
+        }
+    }
+
+    // every (context, following number) pair in the corpus. Contexts do not
+    // cross from one sequence into the next.
+    std::vector<std::pair<int, int>> observations;
+    for(size_t i = 0; i < m_sequenceStarts.size(); i++) {
+        int sequenceStart = m_sequenceStarts[i];
+        int sequenceEnd = i + 1 < m_sequenceStarts.size()
+                              ? m_sequenceStarts[i + 1]
+                              : static_cast<int>(m_corpus.size());
+
+        for(int position = sequenceStart; position < sequenceEnd; position++) {
+            auto hash = emptyContextHash;
+            auto maxLength = std::min(m_order, position - sequenceStart);
+
+            for(int length = 0; length <= maxLength; length++) {
+                if(length > 0) {
+                    hash = addToHash(hash, m_corpus[position - length]);
+                }
+
+                auto contextIndex = findContext(hash,
+                                                length,
+                                                m_corpus.data() + position);
+                if(contextIndex < 0) {
+                    contextIndex = insertContext(hash, length, position);
+                }
+
+                observations.emplace_back(contextIndex, m_corpus[position]);
+            }
+        }
+    }
+
+    // group the observations by context, then by following number, to give
+    // each context's continuations with cumulative counts
+    std::sort(observations.begin(), observations.end());
+
+    auto observation = observations.begin();
+    while(observation != observations.end()) {
+        auto contextIndex = observation->first;
+        m_contexts[contextIndex].continuationsStart =
+            static_cast<int>(m_continuations.size());
+
+        int cumulativeCount = 0;
+        while(observation != observations.end() &&
+              observation->first == contextIndex) {
+            auto number = observation->second;
+            while(observation != observations.end() &&
+                  observation->first == contextIndex &&
+                  observation->second == number) {
+                cumulativeCount++;
+                observation++;
+            }
+
+            m_continuations.push_back(number);
+            m_cumulativeCounts.push_back(cumulativeCount);
+        }
+
+        m_contexts[contextIndex].continuationsEnd =
+            static_cast<int>(m_continuations.size());
+    }
+}
+
+int NGram::findContext(uint64_t hash, int length, const int *contextEnd)
+{
+    auto mask = m_slots.size() - 1;
+    for(auto slot = hash & mask;; slot = (slot + 1) & mask) {
+        auto contextIndex = m_slots[slot];
+        if(contextIndex < 0) {
+            return -1;
+        }
+
+        auto &context = m_contexts[contextIndex];
+        if(context.hash == hash && context.length == length &&
+           std::equal(contextEnd - length,
+                      contextEnd,
+                      m_corpus.begin() + (context.end - length))) {
+            return contextIndex;
+        }
+    }
+}
+
+int NGram::insertContext(uint64_t hash, int length, int end)
+{
+    // keep the table at most half full so probe sequences stay short
+    if((m_contexts.size() + 1) * 2 > m_slots.size()) {
+        growSlots();
+    }
+
+    auto contextIndex = static_cast<int>(m_contexts.size());
+    m_contexts.push_back(Context {hash, end, length, 0, 0});
+
+    auto mask = m_slots.size() - 1;
+    auto slot = hash & mask;
+    while(m_slots[slot] >= 0) {
+        slot = (slot + 1) & mask;
+    }
+    m_slots[slot] = contextIndex;
+
+    return contextIndex;
+}
+
+void NGram::growSlots()
+{
+    m_slots.assign(m_slots.size() * 2, -1);
+    auto mask = m_slots.size() - 1;
+
+    for(size_t i = 0; i < m_contexts.size(); i++) {
+        auto slot = m_contexts[i].hash & mask;
+        while(m_slots[slot] >= 0) {
+            slot = (slot + 1) & mask;
+        }
+        m_slots[slot] = static_cast<int>(i);
+    }
+}
+
+uint64_t NGram::addToHash(uint64_t hash, int number)
+{
+    // FNV-1a style step followed by a finalising mix, so that consecutive
+    // numbers spread across the table's slots
+    hash = (hash ^ static_cast<uint32_t>(number)) * 1099511628211ULL;
+    hash ^= hash >> 29;
+    hash *= 0xbf58476d1ce4e5b9ULL;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+void NGram::checkParamsAreValid(NGramParams &params, const Range &range)
+{
+    if(params.getOrder() < 1 || params.getOrder() > maxOrder) {
+        ErrorChecker::throwInvalidArgument("The order must be between 1 and " +
+                                           std::to_string(maxOrder));
+    }
+
+    for(auto &&sequence : params.getCorpus()) {
+        for(auto &&number : sequence) {
+            if(!range.numberIsInRange(number)) {
+                ErrorChecker::throwInvalidArgument(
+                    "Every number in the corpus must be within the range");
+            }
+        }
+    }
+}
+} // namespace aleatoric
@@ -0,0 +1,97 @@
+#ifndef NGram_hpp
+#define NGram_hpp
+
+#include "IUniformGenerator.hpp"
+#include "NumberProtocol.hpp"
+#include "NumberProtocolParameters.hpp"
+#include "Range.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+/*!
+ * @brief A protocol for producing random numbers
+ *
+ * A concrete implementation of the Protocol interface which forms part of a
+ * [Strategy](https://en.wikipedia.org/wiki/Strategy_pattern) design pattern
+ * (see Protocol for more information).
+ *
+ * Learns from a corpus of existing sequences of numbers (see NGramParams) and
+ * produces numbers that imitate them: each number is selected in proportion to
+ * how often it followed the most recently produced numbers in the corpus.
+ *
+ * __Further detail__:
+ *
+ * The context for selecting a number is the last _order_ numbers produced. If
+ * that context never occurs in the corpus, the protocol _backs off_ to shorter
+ * and shorter contexts until one does. With no context at all, numbers are
+ * selected in proportion to how often they occur in the corpus. With an empty
+ * corpus, numbers are selected from the range with equal probability.
+ *
+ * Only contexts that occur in the corpus are stored, in an open-addressing
+ * hash table keyed by the context's position in the corpus, each with the
+ * cumulative counts of the numbers that followed it. Selecting a number takes
+ * at most order + 1 lookups in the table.
+ */
+class NGram : public NumberProtocol {
+  public:
+    NGram(std::unique_ptr<IUniformGenerator> generator);
+
+    /*!
+     * @param generator Should be an instance of UniformGenerator. Default
+     * construction is fine.
+     *
+     * @param range The range within which to produce numbers.
+     *
+     * @param params The order and corpus. See NGramParams.
+     */
+    NGram(std::unique_ptr<IUniformGenerator> generator,
+          Range range,
+          NGramParams params);
+
+    ~NGram();
+
+    int getIntegerNumber() override;
+
+    double getDecimalNumber() override;
+
+    void setParams(NumberProtocolConfig newParams) override;
+
+    NumberProtocolConfig getParams() override;
+
+  private:
+    struct Context {
+        uint64_t hash;
+        // the context is the length numbers before end in m_corpus
+        int end;
+        int length;
+        // the range of the context's continuations in m_continuations and
+        // m_cumulativeCounts
+        int continuationsStart;
+        int continuationsEnd;
+    };
+
+    std::unique_ptr<IUniformGenerator> m_generator;
+    Range m_range;
+    int m_order;
+    // all sequences laid end to end, as indices into the range
+    std::vector<int> m_corpus;
+    std::vector<int> m_sequenceStarts;
+    std::vector<Context> m_contexts;
+    // open-addressing hash table of indices into m_contexts, -1 when empty
+    std::vector<int> m_slots;
+    std::vector<int> m_continuations;
+    std::vector<int> m_cumulativeCounts;
+    std::vector<int> m_history;
+    void train(std::vector<std::vector<int>> &corpus);
+    int findContext(uint64_t hash, int length, const int *contextEnd);
+    int insertContext(uint64_t hash, int length, int end);
+    void growSlots();
+    static uint64_t addToHash(uint64_t hash, int number);
+    void checkParamsAreValid(NGramParams &params, const Range &range);
+};
+} // namespace aleatoric
+
+#endif /* NGram_hpp */
@@ -0,0 +1,99 @@
+#include "NoRecentRepetition.hpp"
+
+#include "ErrorChecker.hpp"
+
+#include <numeric>
+
+namespace aleatoric {
+NoRecentRepetition::NoRecentRepetition(
+    std::unique_ptr<IUniformGenerator> generator)
+: m_generator(std::move(generator)), m_range(0, 1), m_window(1)
+{
+    initialise();
+}
+
+NoRecentRepetition::NoRecentRepetition(
+    std::unique_ptr<IUniformGenerator> generator, Range range, int window)
+: m_generator(std::move(generator)), m_range(range)
+{
+    checkParams(window, m_range);
+    m_window = window;
+    initialise();
+}
+
+NoRecentRepetition::~NoRecentRepetition()
+{}
+
+int NoRecentRepetition::getIntegerNumber()
+{
+    auto index = m_generator->getNumber();
+    auto number = m_numbers[index];
+
+    if(m_window == 0) {
+        return number + m_range.offset;
+    }
+
+    if(m_numberInWindow < m_window) {
+        // The window grows from the end of the array until it is full, with
+        // the most recent number first
+        m_numberInWindow++;
+        auto newest = m_range.size - m_numberInWindow;
+        m_numbers[index] = m_numbers[newest];
+        m_numbers[newest] = number;
+        m_generator->setDistribution(0, newest - 1);
+        return number + m_range.offset;
+    }
+
+    // Once full, the window runs from the oldest number back towards its
+    // start, wrapping around to the end of the array
+    m_numbers[index] = m_numbers[m_oldestInWindow];
+    m_numbers[m_oldestInWindow] = number;
+    m_oldestInWindow--;
+    if(m_oldestInWindow < m_range.size - m_window) {
+        m_oldestInWindow = m_range.size - 1;
+    }
+
+    return number + m_range.offset;
+}
+
+double NoRecentRepetition::getDecimalNumber()
+{
+    return static_cast<double>(getIntegerNumber());
+}
+
+void NoRecentRepetition::setParams(NumberProtocolConfig newParams)
+{
+    auto window = newParams.protocols.getNoRecentRepetition().getWindow();
+    auto newRange = newParams.getRange();
+    checkParams(window, newRange);
+    m_window = window;
+    m_range = newRange;
+    initialise();
+}
+
+NumberProtocolConfig NoRecentRepetition::getParams()
+{
+    return NumberProtocolConfig(
+        m_range,
+        NumberProtocolParams(NoRecentRepetitionParams(m_window)));
+}
+
+// Private methods
+void NoRecentRepetition::initialise()
+{
+    m_numbers.resize(m_range.size);
+    std::iota(m_numbers.begin(), m_numbers.end(), 0);
+    m_numberInWindow = 0;
+    m_oldestInWindow = m_range.size - 1;
+    m_generator->setDistribution(0, m_range.size - 1);
+}
+
+void NoRecentRepetition::checkParams(int window, const Range &range)
+{
+    if(window < 0 || window >= range.size) {
+        ErrorChecker::throwInvalidArgument(
+            "The window must be between 0 and one less than the size of the "
+            "range");
+    }
+}
+} // namespace aleatoric
@@ -0,0 +1,80 @@
+#ifndef NoRecentRepetition_hpp
+#define NoRecentRepetition_hpp
+
+#include "IUniformGenerator.hpp"
+#include "NumberProtocol.hpp"
+#include "NumberProtocolParameters.hpp"
+#include "Range.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+/*! @brief A protocol for producing random numbers that do not recur within a
+ * window of recent numbers
+ *
+ * A concrete implementation of the Protocol interface which forms part of a
+ * [Strategy](https://en.wikipedia.org/wiki/Strategy_pattern) design pattern
+ * (see Protocol for more information).
+ *
+ * A generalisation of NoRepetition: none of the last _window_ selected numbers
+ * can be selected upon the next call to get a number, whilst all other numbers
+ * in the range have an equal probability of being selected. A window of 1 is
+ * the same as NoRepetition and a window of 0 is the same as Basic. The largest
+ * window, one less than the size of the range, leaves only one number to
+ * select once the window is full, so the first numbers selected repeat in the
+ * same order, like a Serial that never reshuffles. Windows in between sit
+ * between NoRepetition and Serial.
+ *
+ * __Further detail__: The numbers of the range are kept in an array split in
+ * two: the numbers that can be selected, followed by the numbers in the window,
+ * held in the order they were selected. A number is selected from the first
+ * part and swapped with the oldest number in the window, which takes its place
+ * as a number that can be selected. The window is then moved on by one place,
+ * wrapping around within its part of the array. Producing a number therefore
+ * costs the same whatever the size of the range or of the window.
+ */
+class NoRecentRepetition : public NumberProtocol {
+  public:
+    NoRecentRepetition(std::unique_ptr<IUniformGenerator> generator);
+
+    /*!
+     * @param generator should be an instance of UniformGenerator. Default
+     * construction is fine.
+     *
+     * @param range The range within which to produce numbers.
+     *
+     * @param window How many of the most recently selected numbers cannot be
+     * selected. Must be between 0 and one less than the size of the range.
+     */
+    NoRecentRepetition(std::unique_ptr<IUniformGenerator> generator,
+                       Range range,
+                       int window);
+
+    ~NoRecentRepetition();
+
+    int getIntegerNumber() override;
+
+    double getDecimalNumber() override;
+
+    /*!
+     * @brief Sets the range and window, and forgets the numbers selected so
+     * far.
+     */
+    void setParams(NumberProtocolConfig newParams) override;
+
+    NumberProtocolConfig getParams() override;
+
+  private:
+    std::unique_ptr<IUniformGenerator> m_generator;
+    Range m_range;
+    int m_window;
+    std::vector<int> m_numbers;
+    int m_numberInWindow;
+    int m_oldestInWindow;
+    void initialise();
+    void checkParams(int window, const Range &range);
+};
+} // namespace aleatoric
+
+#endif /* NoRecentRepetition_hpp */
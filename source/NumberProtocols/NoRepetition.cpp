@@ -1,21 +1,21 @@
 #include "NoRepetition.hpp"
 
 namespace aleatoric {
-NoRepetition::NoRepetition(std::unique_ptr<IDiscreteGenerator> generator)
+NoRepetition::NoRepetition(std::unique_ptr<IUniformGenerator> generator)
 : m_generator(std::move(generator)),
   m_range(0, 1),
   m_haveRequestedFirstNumber(false)
 {
-    m_generator->setDistributionVector(m_range.size, 1.0);
+    setGeneratorDistribution();
 }
 
-NoRepetition::NoRepetition(std::unique_ptr<IDiscreteGenerator> generator,
+NoRepetition::NoRepetition(std::unique_ptr<IUniformGenerator> generator,
                            Range range)
 : m_generator(std::move(generator)),
   m_range(range),
   m_haveRequestedFirstNumber(false)
 {
-    m_generator->setDistributionVector(m_range.size, 1.0);
+    setGeneratorDistribution();
 }
 
 NoRepetition::~NoRepetition()
@@ -23,13 +23,20 @@ NoRepetition::~NoRepetition()
 
 int NoRepetition::getIntegerNumber()
 {
-    auto generatedNumber = m_generator->getNumber();
-    // reset equal probability
-    m_generator->updateDistributionVector(1.0);
-    // disallow last selected number
-    m_generator->updateDistributionVector(generatedNumber, 0.0);
-    m_lastNumberReturned = generatedNumber + m_range.offset;
-    m_haveRequestedFirstNumber = true;
+    if(canExcludeLastNumber()) {
+        // select from one fewer indices and skip over the index of the last
+        // number, which leaves all other numbers with equal probability
+        auto generatedIndex = m_generator->getNumber();
+        if(generatedIndex >= m_lastNumberReturned - m_range.offset) {
+            generatedIndex++;
+        }
+        m_lastNumberReturned = generatedIndex + m_range.offset;
+    } else {
+        m_lastNumberReturned = m_generator->getNumber();
+        m_haveRequestedFirstNumber = true;
+        setGeneratorDistribution();
+    }
+
     return m_lastNumberReturned;
 }
 
@@ -40,17 +47,8 @@ double NoRepetition::getDecimalNumber()
 
 void NoRepetition::setParams(NumberProtocolConfig newParams)
 {
-    auto newRange = newParams.getRange();
-    m_generator->setDistributionVector(newRange.size, 1.0);
-
-    if(m_haveRequestedFirstNumber &&
-       newRange.numberIsInRange(m_lastNumberReturned)) {
-        m_generator->updateDistributionVector(m_lastNumberReturned -
-                                                  newRange.offset,
-                                              0.0);
-    }
-
-    m_range = newRange;
+    m_range = newParams.getRange();
+    setGeneratorDistribution();
 }
 
 NumberProtocolConfig NoRepetition::getParams()
@@ -59,4 +57,20 @@ NumberProtocolConfig NoRepetition::getParams()
                                 NumberProtocolParams(NoRepetitionParams()));
 }
 
+// Private methods
+bool NoRepetition::canExcludeLastNumber()
+{
+    return m_haveRequestedFirstNumber &&
+           m_range.numberIsInRange(m_lastNumberReturned);
+}
+
+void NoRepetition::setGeneratorDistribution()
+{
+    if(canExcludeLastNumber()) {
+        m_generator->setDistribution(0, m_range.size - 2);
+    } else {
+        m_generator->setDistribution(m_range.start, m_range.end);
+    }
+}
+
 } // namespace aleatoric
@@ -1,7 +1,7 @@
 #ifndef NoRepetition_hpp
 #define NoRepetition_hpp
 
-#include "IDiscreteGenerator.hpp"
+#include "IUniformGenerator.hpp"
 #include "NumberProtocol.hpp"
 #include "NumberProtocolParameters.hpp"
 #include "Range.hpp"
@@ -25,20 +25,24 @@ namespace aleatoric {
  * within the range with equal probability. The next call to get a number will
  * prevent this number from being selected, whilst all other numbers in the
  * range have an equal probability of being selected.
+ *
+ * Rather than reweighting the whole range for each call, a number is drawn
+ * from the range size minus one and shifted past the last selected number,
+ * so the cost of producing a number is independent of the size of the range.
  */
 class NoRepetition : public NumberProtocol {
   public:
-    NoRepetition(std::unique_ptr<IDiscreteGenerator> generator);
+    NoRepetition(std::unique_ptr<IUniformGenerator> generator);
 
-    /*! @brief Takes a DiscreteGenerator derived from the IDiscreteGenerator,
+    /*! @brief Takes a UniformGenerator derived from the IUniformGenerator,
      * and a Range
      *
-     * @param generator should be an instance of DiscreteGenerator. Default
+     * @param generator should be an instance of UniformGenerator. Default
      * construction is fine.
      *
      * @param range The range within which to produce numbers.
      */
-    NoRepetition(std::unique_ptr<IDiscreteGenerator> generator, Range range);
+    NoRepetition(std::unique_ptr<IUniformGenerator> generator, Range range);
 
     ~NoRepetition();
 
@@ -59,10 +63,12 @@ class NoRepetition : public NumberProtocol {
     NumberProtocolConfig getParams() override;
 
   private:
-    std::unique_ptr<IDiscreteGenerator> m_generator;
+    std::unique_ptr<IUniformGenerator> m_generator;
     Range m_range;
     int m_lastNumberReturned;
     bool m_haveRequestedFirstNumber;
+    bool canExcludeLastNumber();
+    void setGeneratorDistribution();
 };
 } // namespace aleatoric
 
@@ -2,59 +2,180 @@
 
 #include "AdjacentSteps.hpp"
 #include "Basic.hpp"
+#include "CellularAutomaton.hpp"
+#include "Constrained.hpp"
 #include "Cycle.hpp"
 #include "DiscreteGenerator.hpp"
+#include "ErrorChecker.hpp"
+#include "GaussianGenerator.hpp"
+#include "GaussianWalk.hpp"
 #include "GranularWalk.hpp"
 #include "GroupedRepetition.hpp"
+#include "LowDiscrepancyGenerator.hpp"
+#include "LowDiscrepancyRealGenerator.hpp"
+#include "LSystem.hpp"
+#include "Markov.hpp"
+#include "NGram.hpp"
+#include "NoRecentRepetition.hpp"
 #include "NoRepetition.hpp"
 #include "Periodic.hpp"
+#include "PinkNoise.hpp"
 #include "Precision.hpp"
 #include "Ratio.hpp"
 #include "Serial.hpp"
 #include "Subset.hpp"
+#include "TendencyMask.hpp"
 #include "UniformGenerator.hpp"
 #include "UniformRealGenerator.hpp"
 #include "Walk.hpp"
+#include "WeightedRoundRobin.hpp"
+#include "WeightedSerial.hpp"
 
 namespace aleatoric {
+namespace {
+std::unique_ptr<IUniformGenerator>
+createUniformGenerator(NumberProtocol::Sampling sampling)
+{
+    switch(sampling) {
+    case NumberProtocol::Sampling::sobol:
+        return std::make_unique<LowDiscrepancyGenerator>(
+            LowDiscrepancyGenerator::Sequence::sobol);
+    case NumberProtocol::Sampling::halton:
+        return std::make_unique<LowDiscrepancyGenerator>(
+            LowDiscrepancyGenerator::Sequence::halton);
+    default:
+        return std::make_unique<UniformGenerator>();
+    }
+}
+
+std::unique_ptr<IUniformRealGenerator>
+createUniformRealGenerator(NumberProtocol::Sampling sampling)
+{
+    switch(sampling) {
+    case NumberProtocol::Sampling::sobol:
+        return std::make_unique<LowDiscrepancyRealGenerator>(
+            LowDiscrepancyRealGenerator::Sequence::sobol);
+    case NumberProtocol::Sampling::halton:
+        return std::make_unique<LowDiscrepancyRealGenerator>(
+            LowDiscrepancyRealGenerator::Sequence::halton);
+    default:
+        return std::make_unique<UniformRealGenerator>();
+    }
+}
+} // namespace
+
+std::vector<int> NumberProtocol::getIntegerCollection(int size)
+{
+    std::vector<int> collection(size);
+
+    for(auto &&it : collection) {
+        it = getIntegerNumber();
+    }
+
+    return collection;
+}
+
+std::vector<double> NumberProtocol::getDecimalCollection(int size)
+{
+    std::vector<double> collection(size);
+
+    for(auto &&it : collection) {
+        it = getDecimalNumber();
+    }
+
+    return collection;
+}
+
 std::unique_ptr<NumberProtocol> NumberProtocol::create(Type type)
 {
+    return create(type, Sampling::pseudoRandom);
+}
+
+std::unique_ptr<NumberProtocol> NumberProtocol::create(Type type,
+                                                       Sampling sampling)
+{
+    // Successive numbers of a low-discrepancy sequence are far from
+    // independent, e.g. a Sobol sequence alternates between the halves of its
+    // range, so a walk would step back and forth. Only protocols that select
+    // independent numbers can use one.
+    if(sampling != Sampling::pseudoRandom && type != Type::basic &&
+       type != Type::granularWalk && type != Type::tendencyMask) {
+        ErrorChecker::throwInvalidArgument(
+            "Only the basic, granularWalk and tendencyMask protocols can use "
+            "sobol or halton sampling");
+    }
+
     switch(type) {
     case Type::adjacentSteps:
         return std::make_unique<AdjacentSteps>(
-            std::make_unique<DiscreteGenerator>());
+            std::make_unique<UniformGenerator>());
     case Type::basic:
-        return std::make_unique<Basic>(std::make_unique<UniformGenerator>());
+        return std::make_unique<Basic>(createUniformGenerator(sampling));
+    case Type::cellularAutomaton:
+        return std::make_unique<CellularAutomaton>();
+    case Type::constrained:
+        return std::make_unique<Constrained>(
+            std::make_unique<Basic>(std::make_unique<UniformGenerator>()),
+            std::make_unique<UniformRealGenerator>());
     case Type::cycle:
         return std::make_unique<Cycle>();
+    case Type::gaussianWalk:
+        return std::make_unique<GaussianWalk>(
+            std::make_unique<GaussianGenerator>());
     case Type::granularWalk:
         return std::make_unique<GranularWalk>(
-            std::make_unique<UniformRealGenerator>());
+            createUniformRealGenerator(sampling));
     case Type::groupedRepetition:
         return std::make_unique<GroupedRepetition>(
             std::make_unique<DiscreteGenerator>(),
             std::make_unique<DiscreteGenerator>());
+    case Type::lSystem:
+        return std::make_unique<LSystem>(std::make_unique<DiscreteGenerator>());
+    case Type::markov:
+        return std::make_unique<Markov>(
+            std::make_unique<UniformRealGenerator>());
+    case Type::nGram:
+        return std::make_unique<NGram>(std::make_unique<UniformGenerator>());
+    case Type::noRecentRepetition:
+        return std::make_unique<NoRecentRepetition>(
+            std::make_unique<UniformGenerator>());
     case Type::noRepetition:
         return std::make_unique<NoRepetition>(
-            std::make_unique<DiscreteGenerator>());
+            std::make_unique<UniformGenerator>());
     case Type::periodic:
         return std::make_unique<Periodic>(
+            std::make_unique<UniformGenerator>(),
             std::make_unique<DiscreteGenerator>());
+    case Type::pinkNoise:
+        return std::make_unique<PinkNoise>(
+            std::make_unique<UniformRealGenerator>());
     case Type::precision:
         return std::make_unique<Precision>(
             std::make_unique<DiscreteGenerator>());
     case Type::ratio:
-        return std::make_unique<Ratio>(std::make_unique<DiscreteGenerator>());
+        return std::make_unique<Ratio>(std::make_unique<UniformGenerator>());
     case Type::serial:
         return std::make_unique<Serial>(std::make_unique<DiscreteGenerator>());
     case Type::subset:
-        return std::make_unique<Subset>(std::make_unique<UniformGenerator>(),
-                                        std::make_unique<DiscreteGenerator>());
+        return std::make_unique<Subset>(std::make_unique<UniformGenerator>());
+    case Type::tendencyMask:
+        // With a deviation factor of 1, GranularWalk selects uniformly from
+        // the whole of its range, as in the original tendency masks
+        return std::make_unique<TendencyMask>(std::make_unique<GranularWalk>(
+            createUniformRealGenerator(sampling),
+            Range(0, 1),
+            1.0));
     case Type::walk:
         return std::make_unique<Walk>(std::make_unique<UniformGenerator>());
+    case Type::weightedRoundRobin:
+        return std::make_unique<WeightedRoundRobin>(
+            std::make_unique<UniformRealGenerator>());
+    case Type::weightedSerial:
+        return std::make_unique<WeightedSerial>(
+            std::make_unique<UniformRealGenerator>());
 
     default:
-        throw std::invalid_argument("Protocol type not recognised");
+        ErrorChecker::throwInvalidArgument("Protocol type not recognised");
     }
 }
 } // namespace aleatoric
@@ -5,6 +5,7 @@
 #include "Range.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace aleatoric {
 struct NumberProtocolConfig; // forward dec preventing circular dep
@@ -25,6 +26,20 @@ class NumberProtocol {
 
     virtual double getDecimalNumber() = 0;
 
+    /*! @brief Returns a collection of numbers produced by the protocol
+     *
+     * The default implementation calls getIntegerNumber() for each item.
+     * Protocols that can produce numbers in bulk more cheaply than one at a
+     * time override it.
+     */
+    virtual std::vector<int> getIntegerCollection(int size);
+
+    /*! @brief Returns a collection of numbers produced by the protocol
+     *
+     * The default implementation calls getDecimalNumber() for each item.
+     */
+    virtual std::vector<double> getDecimalCollection(int size);
+
     virtual void setParams(NumberProtocolConfig newParams) = 0;
 
     virtual NumberProtocolConfig getParams() = 0;
@@ -34,20 +49,47 @@ class NumberProtocol {
     enum class Type {
         adjacentSteps,
         basic,
+        cellularAutomaton,
+        constrained,
         cycle,
+        gaussianWalk,
         granularWalk,
         groupedRepetition,
+        lSystem,
+        markov,
+        nGram,
+        noRecentRepetition,
         noRepetition,
         periodic,
+        pinkNoise,
         precision,
         ratio,
         serial,
         subset,
+        tendencyMask,
         walk,
+        weightedRoundRobin,
+        weightedSerial,
         none
     };
 
+    /*! @brief Where the protocols made by create() get their uniformly
+     * distributed numbers from
+     *
+     * - pseudoRandom: UniformGenerator and UniformRealGenerator
+     * - sobol or halton: LowDiscrepancyGenerator and
+     * LowDiscrepancyRealGenerator with that sequence, so that numbers cover
+     * the range evenly after far fewer of them, e.g. when auditioning a
+     * range. Only basic, granularWalk and tendencyMask, which select
+     * independent numbers, accept these: successive numbers of the sequences
+     * are not independent, so protocols that build each decision on the last
+     * would follow their regularity. create() throws for any other type.
+     */
+    enum class Sampling { pseudoRandom, sobol, halton };
+
     static std::unique_ptr<NumberProtocol> create(Type type);
+
+    static std::unique_ptr<NumberProtocol> create(Type type, Sampling sampling);
 };
 } // namespace aleatoric
 
@@ -25,6 +25,23 @@ NumberProtocolConfig::NumberProtocolConfig(Range newRange)
         i = 1.0 / distribution.size();
     }
     protocols.m_precision = PrecisionParams(distribution);
+
+    protocols.m_weightedRoundRobin =
+        WeightedRoundRobinParams(std::vector<double>(newRange.size, 1.0), 1.0);
+
+    protocols.m_weightedSerial =
+        WeightedSerialParams(std::vector<double>(newRange.size, 1.0));
+
+    // The Fibonacci word over the first two numbers of the range
+    auto first = newRange.start;
+    protocols.m_lSystem = LSystemParams(
+        {first},
+        {{first, {first, first + 1}, 1.0}, {first + 1, {first}, 1.0}},
+        8);
+
+    protocols.m_tendencyMask =
+        TendencyMaskParams({{0, static_cast<double>(newRange.start)}},
+                           {{0, static_cast<double>(newRange.end)}});
 }
 
 Range NumberProtocolConfig::getRange()
@@ -50,12 +67,31 @@ NumberProtocolParams::NumberProtocolParams(BasicParams protocolParams)
     m_basic = protocolParams;
 }
 
+NumberProtocolParams::NumberProtocolParams(
+    CellularAutomatonParams protocolParams)
+{
+    m_activeProtocol = NumberProtocol::Type::cellularAutomaton;
+    m_cellularAutomaton = protocolParams;
+}
+
+NumberProtocolParams::NumberProtocolParams(ConstrainedParams protocolParams)
+{
+    m_activeProtocol = NumberProtocol::Type::constrained;
+    m_constrained = protocolParams;
+}
+
 NumberProtocolParams::NumberProtocolParams(CycleParams protocolParams)
 {
     m_activeProtocol = NumberProtocol::Type::cycle;
     m_cycle = protocolParams;
 }
 
+NumberProtocolParams::NumberProtocolParams(GaussianWalkParams protocolParams)
+{
+    m_activeProtocol = NumberProtocol::Type::gaussianWalk;
+    m_gaussianWalk = protocolParams;
+}
+
 NumberProtocolParams::NumberProtocolParams(GranularWalkParams protocolParams)
 {
     m_activeProtocol = NumberProtocol::Type::granularWalk;
@@ -69,6 +105,31 @@ NumberProtocolParams::NumberProtocolParams(
     m_groupedRepetition = protocolParams;
 }
 
+NumberProtocolParams::NumberProtocolParams(LSystemParams protocolParams)
+{
+    m_activeProtocol = NumberProtocol::Type::lSystem;
+    m_lSystem = protocolParams;
+}
+
+NumberProtocolParams::NumberProtocolParams(MarkovParams protocolParams)
+{
+    m_activeProtocol = NumberProtocol::Type::markov;
+    m_markov = protocolParams;
+}
+
+NumberProtocolParams::NumberProtocolParams(NGramParams protocolParams)
+{
+    m_activeProtocol = NumberProtocol::Type::nGram;
+    m_nGram = protocolParams;
+}
+
+NumberProtocolParams::NumberProtocolParams(
+    NoRecentRepetitionParams protocolParams)
+{
+    m_activeProtocol = NumberProtocol::Type::noRecentRepetition;
+    m_noRecentRepetition = protocolParams;
+}
+
 NumberProtocolParams::NumberProtocolParams(NoRepetitionParams protocolParams)
 {
     m_activeProtocol = NumberProtocol::Type::noRepetition;
@@ -81,6 +142,12 @@ NumberProtocolParams::NumberProtocolParams(PeriodicParams protocolParams)
     m_periodic = protocolParams;
 }
 
+NumberProtocolParams::NumberProtocolParams(PinkNoiseParams protocolParams)
+{
+    m_activeProtocol = NumberProtocol::Type::pinkNoise;
+    m_pinkNoise = protocolParams;
+}
+
 NumberProtocolParams::NumberProtocolParams(PrecisionParams protocolParams)
 {
     m_activeProtocol = NumberProtocol::Type::precision;
@@ -105,12 +172,31 @@ NumberProtocolParams::NumberProtocolParams(SubsetParams protocolParams)
     m_subset = protocolParams;
 }
 
+NumberProtocolParams::NumberProtocolParams(TendencyMaskParams protocolParams)
+{
+    m_activeProtocol = NumberProtocol::Type::tendencyMask;
+    m_tendencyMask = protocolParams;
+}
+
 NumberProtocolParams::NumberProtocolParams(WalkParams protocolParams)
 {
     m_activeProtocol = NumberProtocol::Type::walk;
     m_walk = protocolParams;
 }
 
+NumberProtocolParams::NumberProtocolParams(
+    WeightedRoundRobinParams protocolParams)
+{
+    m_activeProtocol = NumberProtocol::Type::weightedRoundRobin;
+    m_weightedRoundRobin = protocolParams;
+}
+
+NumberProtocolParams::NumberProtocolParams(WeightedSerialParams protocolParams)
+{
+    m_activeProtocol = NumberProtocol::Type::weightedSerial;
+    m_weightedSerial = protocolParams;
+}
+
 // other methods
 
 NumberProtocol::Type NumberProtocolParams::getActiveProtocol()
@@ -128,11 +214,26 @@ BasicParams NumberProtocolParams::getBasic()
     return m_basic;
 }
 
+CellularAutomatonParams NumberProtocolParams::getCellularAutomaton()
+{
+    return m_cellularAutomaton;
+}
+
+ConstrainedParams NumberProtocolParams::getConstrained()
+{
+    return m_constrained;
+}
+
 CycleParams NumberProtocolParams::getCycle()
 {
     return m_cycle;
 }
 
+GaussianWalkParams NumberProtocolParams::getGaussianWalk()
+{
+    return m_gaussianWalk;
+}
+
 GranularWalkParams NumberProtocolParams::getGranularWalk()
 {
     return m_granularWalk;
@@ -143,6 +244,26 @@ GroupedRepetitionParams NumberProtocolParams::getGroupedRepetition()
     return m_groupedRepetition;
 }
 
+LSystemParams NumberProtocolParams::getLSystem()
+{
+    return m_lSystem;
+}
+
+MarkovParams NumberProtocolParams::getMarkov()
+{
+    return m_markov;
+}
+
+NGramParams NumberProtocolParams::getNGram()
+{
+    return m_nGram;
+}
+
+NoRecentRepetitionParams NumberProtocolParams::getNoRecentRepetition()
+{
+    return m_noRecentRepetition;
+}
+
 NoRepetitionParams NumberProtocolParams::getNoRepetition()
 {
     return m_noRepetition;
@@ -153,6 +274,11 @@ PeriodicParams NumberProtocolParams::getPeriodic()
     return m_periodic;
 }
 
+PinkNoiseParams NumberProtocolParams::getPinkNoise()
+{
+    return m_pinkNoise;
+}
+
 PrecisionParams NumberProtocolParams::getPrecision()
 {
     return m_precision;
@@ -173,13 +299,89 @@ SubsetParams NumberProtocolParams::getSubset()
     return m_subset;
 }
 
+TendencyMaskParams NumberProtocolParams::getTendencyMask()
+{
+    return m_tendencyMask;
+}
+
 WalkParams NumberProtocolParams::getWalk()
 {
     return m_walk;
 }
 
+WeightedRoundRobinParams NumberProtocolParams::getWeightedRoundRobin()
+{
+    return m_weightedRoundRobin;
+}
+
+WeightedSerialParams NumberProtocolParams::getWeightedSerial()
+{
+    return m_weightedSerial;
+}
+
 // ===============================================================
 
+// CellularAutomaton
+CellularAutomatonParams::CellularAutomatonParams()
+{}
+
+CellularAutomatonParams::CellularAutomatonParams(int rule, Output output)
+{
+    m_rule = rule;
+    m_output = output;
+}
+
+CellularAutomatonParams::CellularAutomatonParams(int rule,
+                                                 Output output,
+                                                 int liveCellIndex,
+                                                 std::vector<int> initialCells)
+{
+    m_rule = rule;
+    m_output = output;
+    m_liveCellIndex = liveCellIndex;
+    m_initialCells = initialCells;
+}
+
+int CellularAutomatonParams::getRule()
+{
+    return m_rule;
+}
+
+CellularAutomatonParams::Output CellularAutomatonParams::getOutput()
+{
+    return m_output;
+}
+
+int CellularAutomatonParams::getLiveCellIndex()
+{
+    return m_liveCellIndex;
+}
+
+std::vector<int> CellularAutomatonParams::getInitialCells()
+{
+    return m_initialCells;
+}
+
+// Constrained
+ConstrainedParams::ConstrainedParams()
+{}
+
+ConstrainedParams::ConstrainedParams(int length, Constraints constraints)
+{
+    m_length = length;
+    m_constraints = constraints;
+}
+
+int ConstrainedParams::getLength()
+{
+    return m_length;
+}
+
+Constraints ConstrainedParams::getConstraints()
+{
+    return m_constraints;
+}
+
 // Cycle
 CycleParams::CycleParams()
 {}
@@ -200,6 +402,20 @@ bool CycleParams::getReverseDirection()
     return m_reverseDirection;
 }
 
+// GaussianWalk
+GaussianWalkParams::GaussianWalkParams()
+{}
+
+GaussianWalkParams::GaussianWalkParams(double deviationFactor)
+{
+    m_deviationFactor = deviationFactor;
+}
+
+double GaussianWalkParams::getDeviationFactor()
+{
+    return m_deviationFactor;
+}
+
 // GranularWalk
 GranularWalkParams::GranularWalkParams()
 {}
@@ -228,6 +444,96 @@ std::vector<int> GroupedRepetitionParams::getGroupings()
     return m_groupings;
 }
 
+// LSystem
+LSystemParams::LSystemParams()
+{}
+
+LSystemParams::LSystemParams(std::vector<int> axiom,
+                             std::vector<Production> productions,
+                             int generations)
+{
+    m_axiom = axiom;
+    m_productions = productions;
+    m_generations = generations;
+}
+
+std::vector<int> LSystemParams::getAxiom()
+{
+    return m_axiom;
+}
+
+std::vector<Production> LSystemParams::getProductions()
+{
+    return m_productions;
+}
+
+int LSystemParams::getGenerations()
+{
+    return m_generations;
+}
+
+// Markov
+MarkovParams::MarkovParams()
+{}
+
+MarkovParams::MarkovParams(std::vector<int> rowOffsets,
+                           std::vector<int> columns,
+                           std::vector<double> weights)
+{
+    m_rowOffsets = rowOffsets;
+    m_columns = columns;
+    m_weights = weights;
+}
+
+std::vector<int> MarkovParams::getRowOffsets()
+{
+    return m_rowOffsets;
+}
+
+std::vector<int> MarkovParams::getColumns()
+{
+    return m_columns;
+}
+
+std::vector<double> MarkovParams::getWeights()
+{
+    return m_weights;
+}
+
+// NGram
+NGramParams::NGramParams()
+{}
+
+NGramParams::NGramParams(int order, std::vector<std::vector<int>> corpus)
+{
+    m_order = order;
+    m_corpus = corpus;
+}
+
+int NGramParams::getOrder()
+{
+    return m_order;
+}
+
+std::vector<std::vector<int>> NGramParams::getCorpus()
+{
+    return m_corpus;
+}
+
+// NoRecentRepetition
+NoRecentRepetitionParams::NoRecentRepetitionParams()
+{}
+
+NoRecentRepetitionParams::NoRecentRepetitionParams(int window)
+{
+    m_window = window;
+}
+
+int NoRecentRepetitionParams::getWindow()
+{
+    return m_window;
+}
+
 // Periodic
 PeriodicParams::PeriodicParams()
 {}
@@ -242,6 +548,20 @@ double PeriodicParams::getChanceOfRepetition()
     return m_chanceOfRepetition;
 }
 
+// PinkNoise
+PinkNoiseParams::PinkNoiseParams()
+{}
+
+PinkNoiseParams::PinkNoiseParams(int numberOfRows)
+{
+    m_numberOfRows = numberOfRows;
+}
+
+int PinkNoiseParams::getNumberOfRows()
+{
+    return m_numberOfRows;
+}
+
 // Precision
 PrecisionParams::PrecisionParams()
 {}
@@ -290,6 +610,27 @@ int SubsetParams::getMax()
     return m_max;
 }
 
+// TendencyMask
+TendencyMaskParams::TendencyMaskParams()
+{}
+
+TendencyMaskParams::TendencyMaskParams(std::vector<Breakpoint> lowerEnvelope,
+                                       std::vector<Breakpoint> upperEnvelope)
+{
+    m_lowerEnvelope = lowerEnvelope;
+    m_upperEnvelope = upperEnvelope;
+}
+
+std::vector<Breakpoint> TendencyMaskParams::getLowerEnvelope()
+{
+    return m_lowerEnvelope;
+}
+
+std::vector<Breakpoint> TendencyMaskParams::getUpperEnvelope()
+{
+    return m_upperEnvelope;
+}
+
 // Walk
 WalkParams::WalkParams()
 {}
@@ -303,4 +644,39 @@ int WalkParams::getMaxStep()
 {
     return m_maxStep;
 }
+
+// Weighted Round Robin
+WeightedRoundRobinParams::WeightedRoundRobinParams()
+{}
+
+WeightedRoundRobinParams::WeightedRoundRobinParams(std::vector<double> weights,
+                                                   double jitter)
+{
+    m_weights = weights;
+    m_jitter = jitter;
+}
+
+std::vector<double> WeightedRoundRobinParams::getWeights()
+{
+    return m_weights;
+}
+
+double WeightedRoundRobinParams::getJitter()
+{
+    return m_jitter;
+}
+
+// Weighted Serial
+WeightedSerialParams::WeightedSerialParams()
+{}
+
+WeightedSerialParams::WeightedSerialParams(std::vector<double> weights)
+{
+    m_weights = weights;
+}
+
+std::vector<double> WeightedSerialParams::getWeights()
+{
+    return m_weights;
+}
 } // namespace aleatoric
@@ -4,6 +4,7 @@
 #include "NumberProtocol.hpp"
 #include "Range.hpp"
 
+#include <limits>
 #include <vector>
 
 namespace aleatoric {
@@ -15,6 +16,77 @@ struct AdjacentStepsParams {};
 
 struct BasicParams {};
 
+/*! @brief The rule, initial row and output of the CellularAutomaton protocol
+ *
+ * The rule is an elementary cellular automaton rule in Wolfram numbering (0 to
+ * 255). The initial cells are the numbers in the range that are live in the
+ * first row; when empty, only the cell at the centre of the range is live.
+ */
+struct CellularAutomatonParams {
+    /*! @brief How rows of the automaton are turned into numbers */
+    enum class Output {
+        population, /*!< The count of live cells in each row, scaled to the
+                       range */
+        liveCell, /*!< The live cell at liveCellIndex in each row, wrapping
+                     when the row has fewer live cells */
+        row /*!< Every live cell of each row in turn, lowest first */
+    };
+
+    CellularAutomatonParams(int rule, Output output);
+    CellularAutomatonParams(int rule,
+                            Output output,
+                            int liveCellIndex,
+                            std::vector<int> initialCells);
+    friend struct NumberProtocolParams;
+    int getRule();
+    Output getOutput();
+    int getLiveCellIndex();
+    std::vector<int> getInitialCells();
+
+  private:
+    CellularAutomatonParams();
+    int m_rule = 30;
+    Output m_output = Output::population;
+    int m_liveCellIndex = 0;
+    std::vector<int> m_initialCells {};
+};
+
+/*! @brief The rules which each phrase produced by the Constrained protocol
+ * must obey. Members left at their default values apply no rule
+ */
+struct Constraints {
+    /*! The greatest number of times a number may occur in succession, or 0
+     * for no limit */
+    int maxRun = 0;
+    /*! The permitted distances between successive numbers, or empty for any
+     * distance. Distances of the size of the range or more are ignored, but
+     * at least one must be smaller */
+    std::vector<int> intervals {};
+    /*! The least sum of the numbers of a phrase */
+    int minSum = std::numeric_limits<int>::min();
+    /*! The greatest sum of the numbers of a phrase */
+    int maxSum = std::numeric_limits<int>::max();
+    /*! Whether each phrase must start with the first number */
+    bool fixFirst = false;
+    int first = 0;
+    /*! Whether each phrase must end with the last number */
+    bool fixLast = false;
+    int last = 0;
+};
+
+/*! @brief The phrase length and constraints of the Constrained protocol */
+struct ConstrainedParams {
+    ConstrainedParams(int length, Constraints constraints);
+    friend struct NumberProtocolParams;
+    int getLength();
+    Constraints getConstraints();
+
+  private:
+    ConstrainedParams();
+    int m_length = 16;
+    Constraints m_constraints {};
+};
+
 struct CycleParams {
     CycleParams(bool bidirectional, bool reverseDirection);
     friend struct NumberProtocolParams;
@@ -27,6 +99,21 @@ struct CycleParams {
     bool m_reverseDirection = false;
 };
 
+/*! @brief The spread of steps for the GaussianWalk protocol
+ *
+ * The deviation factor is the standard deviation of each step as a fraction of
+ * the range, and must be between 0.0 and 1.0.
+ */
+struct GaussianWalkParams {
+    GaussianWalkParams(double deviationFactor);
+    friend struct NumberProtocolParams;
+    double getDeviationFactor();
+
+  private:
+    GaussianWalkParams();
+    double m_deviationFactor = 0.1;
+};
+
 struct GranularWalkParams {
     GranularWalkParams(double deviationFactor);
     friend struct NumberProtocolParams;
@@ -47,6 +134,97 @@ struct GroupedRepetitionParams {
     std::vector<int> m_groupings {1};
 };
 
+/*! @brief A rewriting rule of the LSystem protocol: each time the predecessor
+ * is expanded it is replaced by the successor. Where a predecessor has more
+ * than one production, one is chosen at random according to the weights
+ */
+struct Production {
+    int predecessor;
+    std::vector<int> successor;
+    double weight;
+};
+
+/*! @brief The axiom, productions and depth of the LSystem protocol
+ *
+ * The symbols of the axiom and productions are numbers within the range.
+ * Symbols with no production are constants and are never rewritten.
+ * Generations is the number of times the axiom is rewritten before its symbols
+ * are produced as numbers.
+ */
+struct LSystemParams {
+    LSystemParams(std::vector<int> axiom,
+                  std::vector<Production> productions,
+                  int generations);
+    friend struct NumberProtocolParams;
+    std::vector<int> getAxiom();
+    std::vector<Production> getProductions();
+    int getGenerations();
+
+  private:
+    LSystemParams();
+    std::vector<int> m_axiom {0};
+    std::vector<Production> m_productions {{0, {0, 1}, 1.0}, {1, {0}, 1.0}};
+    int m_generations = 8;
+};
+
+/*! @brief The transition matrix for the Markov protocol, in compressed sparse
+ * row (CSR) form
+ *
+ * States are indices into the range (0 to range size - 1). The transitions
+ * from state i are at positions rowOffsets[i] to rowOffsets[i + 1] - 1 of
+ * columns (the states transitioned to) and weights (their relative
+ * likelihoods). rowOffsets therefore has one more item than the range size.
+ * Empty collections describe a matrix with no transitions.
+ */
+struct MarkovParams {
+    MarkovParams(std::vector<int> rowOffsets,
+                 std::vector<int> columns,
+                 std::vector<double> weights);
+    friend struct NumberProtocolParams;
+    std::vector<int> getRowOffsets();
+    std::vector<int> getColumns();
+    std::vector<double> getWeights();
+
+  private:
+    MarkovParams();
+    std::vector<int> m_rowOffsets {};
+    std::vector<int> m_columns {};
+    std::vector<double> m_weights {};
+};
+
+/*! @brief The order and training material for the NGram protocol
+ *
+ * The order is the greatest number of preceding numbers used as context when
+ * selecting the next, from 1 to 8. The corpus is a collection of sequences of
+ * numbers, each of which must be within the protocol's range.
+ */
+struct NGramParams {
+    NGramParams(int order, std::vector<std::vector<int>> corpus);
+    friend struct NumberProtocolParams;
+    int getOrder();
+    std::vector<std::vector<int>> getCorpus();
+
+  private:
+    NGramParams();
+    int m_order = 1;
+    std::vector<std::vector<int>> m_corpus {};
+};
+
+/*! @brief The number of most recently selected numbers that the
+ * NoRecentRepetition protocol prevents from being selected
+ *
+ * Must be between 0 and one less than the size of the protocol's range.
+ */
+struct NoRecentRepetitionParams {
+    NoRecentRepetitionParams(int window);
+    friend struct NumberProtocolParams;
+    int getWindow();
+
+  private:
+    NoRecentRepetitionParams();
+    int m_window = 1;
+};
+
 struct NoRepetitionParams {};
 
 struct PeriodicParams {
@@ -59,6 +237,21 @@ struct PeriodicParams {
     double m_chanceOfRepetition = 0.0;
 };
 
+/*! @brief The number of rows (octaves) summed by the PinkNoise protocol
+ *
+ * Must be between 1 and 30. More rows extend the 1/f behaviour to lower
+ * frequencies.
+ */
+struct PinkNoiseParams {
+    PinkNoiseParams(int numberOfRows);
+    friend struct NumberProtocolParams;
+    int getNumberOfRows();
+
+  private:
+    PinkNoiseParams();
+    int m_numberOfRows = 8;
+};
+
 struct PrecisionParams {
     PrecisionParams(std::vector<double> distribution);
     friend struct NumberProtocolParams;
@@ -93,6 +286,33 @@ struct SubsetParams {
     int m_max = 0;
 };
 
+/*! @brief A point on a TendencyMask envelope: the value of the bound at the
+ * step (the count of numbers produced) given
+ */
+struct Breakpoint {
+    int step;
+    double value;
+};
+
+/*! @brief The lower and upper envelopes for the TendencyMask protocol
+ *
+ * Each envelope is a series of breakpoints which must start at step 0 and have
+ * strictly increasing steps. Bounds are interpolated linearly between
+ * breakpoints and hold their last value after the final breakpoint.
+ */
+struct TendencyMaskParams {
+    TendencyMaskParams(std::vector<Breakpoint> lowerEnvelope,
+                       std::vector<Breakpoint> upperEnvelope);
+    friend struct NumberProtocolParams;
+    std::vector<Breakpoint> getLowerEnvelope();
+    std::vector<Breakpoint> getUpperEnvelope();
+
+  private:
+    TendencyMaskParams();
+    std::vector<Breakpoint> m_lowerEnvelope {{0, 0.0}};
+    std::vector<Breakpoint> m_upperEnvelope {{0, 1.0}};
+};
+
 struct WalkParams {
     WalkParams(int maxStep);
     friend struct NumberProtocolParams;
@@ -103,35 +323,79 @@ struct WalkParams {
     int m_maxStep = 1;
 };
 
+struct WeightedRoundRobinParams {
+    WeightedRoundRobinParams(std::vector<double> weights, double jitter);
+    friend struct NumberProtocolParams;
+    std::vector<double> getWeights();
+    double getJitter();
+
+  private:
+    WeightedRoundRobinParams();
+    std::vector<double> m_weights {};
+    double m_jitter = 1.0;
+};
+
+struct WeightedSerialParams {
+    WeightedSerialParams(std::vector<double> weights);
+    friend struct NumberProtocolParams;
+    std::vector<double> getWeights();
+
+  private:
+    WeightedSerialParams();
+    std::vector<double> m_weights {};
+};
+
 struct NumberProtocolParams {
     friend struct NumberProtocolConfig;
 
     NumberProtocolParams(AdjacentStepsParams protocolParams);
     NumberProtocolParams(BasicParams protocolParams);
+    NumberProtocolParams(CellularAutomatonParams protocolParams);
+    NumberProtocolParams(ConstrainedParams protocolParams);
     NumberProtocolParams(CycleParams protocolParams);
+    NumberProtocolParams(GaussianWalkParams protocolParams);
     NumberProtocolParams(GranularWalkParams protocolParams);
     NumberProtocolParams(GroupedRepetitionParams protocolParams);
+    NumberProtocolParams(LSystemParams protocolParams);
+    NumberProtocolParams(MarkovParams protocolParams);
+    NumberProtocolParams(NGramParams protocolParams);
+    NumberProtocolParams(NoRecentRepetitionParams protocolParams);
     NumberProtocolParams(NoRepetitionParams protocolParams);
     NumberProtocolParams(PeriodicParams protocolParams);
+    NumberProtocolParams(PinkNoiseParams protocolParams);
     NumberProtocolParams(PrecisionParams protocolParams);
     NumberProtocolParams(RatioParams protocolParams);
     NumberProtocolParams(SerialParams protocolParams);
     NumberProtocolParams(SubsetParams protocolParams);
+    NumberProtocolParams(TendencyMaskParams protocolParams);
     NumberProtocolParams(WalkParams protocolParams);
+    NumberProtocolParams(WeightedRoundRobinParams protocolParams);
+    NumberProtocolParams(WeightedSerialParams protocolParams);
 
     NumberProtocol::Type getActiveProtocol();
     AdjacentStepsParams getAdjacentSteps();
     BasicParams getBasic();
+    CellularAutomatonParams getCellularAutomaton();
+    ConstrainedParams getConstrained();
     CycleParams getCycle();
+    GaussianWalkParams getGaussianWalk();
     GranularWalkParams getGranularWalk();
     GroupedRepetitionParams getGroupedRepetition();
+    LSystemParams getLSystem();
+    MarkovParams getMarkov();
+    NGramParams getNGram();
+    NoRecentRepetitionParams getNoRecentRepetition();
     NoRepetitionParams getNoRepetition();
     PeriodicParams getPeriodic();
+    PinkNoiseParams getPinkNoise();
     PrecisionParams getPrecision();
     RatioParams getRatio();
     SerialParams getSerial();
     SubsetParams getSubset();
+    TendencyMaskParams getTendencyMask();
     WalkParams getWalk();
+    WeightedRoundRobinParams getWeightedRoundRobin();
+    WeightedSerialParams getWeightedSerial();
 
   private:
     NumberProtocolParams();
@@ -139,16 +403,27 @@ struct NumberProtocolParams {
 
     AdjacentStepsParams m_adjacentSteps;
     BasicParams m_basic;
+    CellularAutomatonParams m_cellularAutomaton;
+    ConstrainedParams m_constrained;
     CycleParams m_cycle;
+    GaussianWalkParams m_gaussianWalk;
     GranularWalkParams m_granularWalk;
     GroupedRepetitionParams m_groupedRepetition;
+    LSystemParams m_lSystem;
+    MarkovParams m_markov;
+    NGramParams m_nGram;
+    NoRecentRepetitionParams m_noRecentRepetition;
     NoRepetitionParams m_noRepetition;
     PeriodicParams m_periodic;
+    PinkNoiseParams m_pinkNoise;
     PrecisionParams m_precision;
     RatioParams m_ratio;
     SerialParams m_serial;
     SubsetParams m_subset;
+    TendencyMaskParams m_tendencyMask;
     WalkParams m_walk;
+    WeightedRoundRobinParams m_weightedRoundRobin;
+    WeightedSerialParams m_weightedSerial;
 };
 
 struct NumberProtocolConfig {
@@ -1,32 +1,38 @@
 #include "Periodic.hpp"
 
-#include <stdexcept>
+#include "ErrorChecker.hpp"
 
 namespace aleatoric {
-Periodic::Periodic(std::unique_ptr<IDiscreteGenerator> generator)
-: m_generator(std::move(generator)),
+Periodic::Periodic(std::unique_ptr<IUniformGenerator> uniformGenerator,
+                   std::unique_ptr<IDiscreteGenerator> discreteGenerator)
+: m_uniformGenerator(std::move(uniformGenerator)),
+  m_discreteGenerator(std::move(discreteGenerator)),
   m_range(0, 1),
   m_periodicity(0.0),
   m_haveRequestedFirstNumber(false)
 {
-    m_generator->setDistributionVector(m_range.size, 1.0);
+    setRepetitionDistribution();
+    setUniformDistribution();
 }
 
-Periodic::Periodic(std::unique_ptr<IDiscreteGenerator> generator,
+Periodic::Periodic(std::unique_ptr<IUniformGenerator> uniformGenerator,
+                   std::unique_ptr<IDiscreteGenerator> discreteGenerator,
                    Range range,
                    double chanceOfRepetition)
-: m_generator(std::move(generator)),
+: m_uniformGenerator(std::move(uniformGenerator)),
+  m_discreteGenerator(std::move(discreteGenerator)),
   m_range(range),
   m_periodicity(chanceOfRepetition),
   m_haveRequestedFirstNumber(false)
 {
     if(chanceOfRepetition < 0.0 || chanceOfRepetition > 1.0) {
-        throw std::invalid_argument(
+        ErrorChecker::throwInvalidArgument(
             "The value passed as argument for chanceOfRepetition must be "
             "within the range of 0.0 - 1.0");
     }
 
-    m_generator->setDistributionVector(m_range.size, 1.0);
+    setRepetitionDistribution();
+    setUniformDistribution();
 }
 
 Periodic::~Periodic()
@@ -34,10 +40,26 @@ Periodic::~Periodic()
 
 int Periodic::getIntegerNumber()
 {
-    auto generatedNumber = m_generator->getNumber();
-    setPeriodicDistribution(generatedNumber);
-    m_lastReturnedNumber = generatedNumber + m_range.offset;
-    m_haveRequestedFirstNumber = true;
+    if(!canRepeatLastNumber()) {
+        m_lastReturnedNumber = m_uniformGenerator->getNumber();
+        m_haveRequestedFirstNumber = true;
+        setUniformDistribution();
+        return m_lastReturnedNumber;
+    }
+
+    // index 1 of the repetition distribution holds the periodicity
+    if(m_discreteGenerator->getNumber() == 1) {
+        return m_lastReturnedNumber;
+    }
+
+    // The remainder of 1.0 - periodicity is shared equally amongst the other
+    // numbers in the range: select from one fewer indices and skip over the
+    // index of the last number.
+    auto generatedIndex = m_uniformGenerator->getNumber();
+    if(generatedIndex >= m_lastReturnedNumber - m_range.offset) {
+        generatedIndex++;
+    }
+    m_lastReturnedNumber = generatedIndex + m_range.offset;
     return m_lastReturnedNumber;
 }
 
@@ -59,67 +81,38 @@ void Periodic::setParams(NumberProtocolConfig params)
         params.protocols.getPeriodic().getChanceOfRepetition();
 
     if(chanceOfRepetition < 0.0 || chanceOfRepetition > 1.0) {
-        throw std::invalid_argument(
+        ErrorChecker::throwInvalidArgument(
             "The value passed as argument for chanceOfRepetition must be "
             "within the range of 0.0 - 1.0");
     }
 
-    // NB: order is important here. Periodicity must be set before range in
-    // order for recalculation of distibution to be done using the new
-    // periodicity
     m_periodicity = chanceOfRepetition;
-    setRange(params.getRange());
+    m_range = params.getRange();
+    setRepetitionDistribution();
+    setUniformDistribution();
 }
 
 // Private methods
-double Periodic::calculateRemainerAllocation()
+bool Periodic::canRepeatLastNumber()
 {
-    auto vectorSize = m_generator->getDistributionVector().size();
-    return (1.0 - m_periodicity) / (vectorSize - 1.0);
+    return m_haveRequestedFirstNumber &&
+           m_range.numberIsInRange(m_lastReturnedNumber);
 }
 
-void Periodic::setPeriodicDistribution(int selectedIndex)
+void Periodic::setUniformDistribution()
 {
-    // The sum of all values in the vector must equal 1.0 (see caveat below).
-    // The value at the index of the last selected number
-    // must have the value of the periodicity (chanceOfRepetition).
-    // The remainder of 1.0 - periodicity is shared equally amongst
-    // the remaining vector indices.
-
-    // NB: The sum of all values may not always be precisely 1.0. This is due to
-    // how floating point calculations work. It doesn't mean the calculation is
-    // broken. Carefully chosen numbers in the tests demonstrate that the
-    // calculation is fundamentally correct, i.e. selection of numbers that do
-    // not have imprecise floating-point representations.
-    // See:https://randomascii.wordpress.com/2012/02/25/comparing-floating-point-numbers-2012-edition/
-    // and
-    // https://blog.reverberate.org/2014/09/what-every-computer-programmer-should.html
-    // and
-    // https://www.boost.org/doc/libs/1_63_0/libs/math/doc/html/math_toolkit/float_comparison.html
-
-    auto distributionVector = m_generator->getDistributionVector();
-    auto remainderAllocation = calculateRemainerAllocation();
-
-    for(size_t i = 0; i < distributionVector.size(); i++) {
-        auto newVectorValue = static_cast<int>(i) == selectedIndex
-                                  ? m_periodicity
-                                  : remainderAllocation;
-        distributionVector[i] = newVectorValue;
+    if(canRepeatLastNumber()) {
+        m_uniformGenerator->setDistribution(0, m_range.size - 2);
+    } else {
+        m_uniformGenerator->setDistribution(m_range.start, m_range.end);
     }
-
-    m_generator->setDistributionVector(distributionVector);
 }
 
-void Periodic::setRange(Range newRange)
+void Periodic::setRepetitionDistribution()
 {
-    m_range = newRange;
-
-    m_generator->setDistributionVector(m_range.size, 1.0);
-
-    if(m_haveRequestedFirstNumber &&
-       m_range.numberIsInRange(m_lastReturnedNumber)) {
-        setPeriodicDistribution(m_lastReturnedNumber - m_range.offset);
-    }
+    // index 0: select another number, index 1: repeat the last number
+    m_discreteGenerator->setDistributionVector(
+        std::vector<double> {1.0 - m_periodicity, m_periodicity});
 }
 
 } // namespace aleatoric
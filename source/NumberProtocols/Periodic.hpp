@@ -2,6 +2,7 @@
 #define Periodic_hpp
 
 #include "IDiscreteGenerator.hpp"
+#include "IUniformGenerator.hpp"
 #include "NumberProtocol.hpp"
 #include "NumberProtocolParameters.hpp"
 #include "Range.hpp"
@@ -51,16 +52,26 @@ namespace aleatoric {
  * next call. If an initial number is not provided, the first call to get a
  * number will pick one from the range at random (equal probability / uniform
  * distribution).
+ *
+ * Rather than reweighting the whole range for each call, a number is produced
+ * by first deciding whether to repeat the last selected number (a weighted
+ * coin flip according to the periodicity) and, if not, selecting with equal
+ * probability from the rest of the range. The cost of producing a number is
+ * therefore independent of the size of the range.
  */
 class Periodic : public NumberProtocol {
   public:
-    Periodic(std::unique_ptr<IDiscreteGenerator> generator);
+    Periodic(std::unique_ptr<IUniformGenerator> uniformGenerator,
+             std::unique_ptr<IDiscreteGenerator> discreteGenerator);
 
-    /*! @brief Takes a DiscreteGenerator derived from IDiscreteGenerator and
-     * a Range
+    /*! @brief Takes a UniformGenerator derived from IUniformGenerator, a
+     * DiscreteGenerator derived from IDiscreteGenerator and a Range
+     *
+     * @param uniformGenerator Should be an instance of UniformGenerator.
+     * Default construction is fine.
      *
-     * @param generator Should be an instance of DiscreteGenerator. Default
-     * construction is fine.
+     * @param discreteGenerator Should be an instance of DiscreteGenerator.
+     * Default construction is fine.
      *
      * @param range The range within which to produce numbers.
      *
@@ -69,7 +80,8 @@ class Periodic : public NumberProtocol {
      * selected number being selected again upon another call to
      * getNumber(). See detailed description for more details.
      */
-    Periodic(std::unique_ptr<IDiscreteGenerator> generator,
+    Periodic(std::unique_ptr<IUniformGenerator> uniformGenerator,
+             std::unique_ptr<IDiscreteGenerator> discreteGenerator,
              Range range,
              double chanceOfRepetition);
 
@@ -88,14 +100,15 @@ class Periodic : public NumberProtocol {
     NumberProtocolConfig getParams() override;
 
   private:
-    std::unique_ptr<IDiscreteGenerator> m_generator;
+    std::unique_ptr<IUniformGenerator> m_uniformGenerator;
+    std::unique_ptr<IDiscreteGenerator> m_discreteGenerator;
     Range m_range;
     double m_periodicity;
-    void setPeriodicDistribution(int selectedIndex);
-    double calculateRemainerAllocation();
-    void setRange(Range newRange);
     bool m_haveRequestedFirstNumber;
     int m_lastReturnedNumber;
+    bool canRepeatLastNumber();
+    void setUniformDistribution();
+    void setRepetitionDistribution();
 };
 } // namespace aleatoric
 
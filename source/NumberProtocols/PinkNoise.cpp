@@ -0,0 +1,92 @@
+#include "PinkNoise.hpp"
+
+#include "ErrorChecker.hpp"
+
+#include <algorithm>
+
+namespace aleatoric {
+PinkNoise::PinkNoise(std::unique_ptr<IUniformRealGenerator> generator)
+: m_generator(std::move(generator)), m_range(0, 1)
+{
+    m_generator->setDistribution(0.0, 1.0);
+    setRows(8);
+}
+
+PinkNoise::PinkNoise(std::unique_ptr<IUniformRealGenerator> generator,
+                     Range range,
+                     int numberOfRows)
+: m_generator(std::move(generator)), m_range(range)
+{
+    m_generator->setDistribution(0.0, 1.0);
+    setRows(numberOfRows);
+}
+
+PinkNoise::~PinkNoise()
+{}
+
+int PinkNoise::getIntegerNumber()
+{
+    auto index = static_cast<int>(getNextSum() * m_range.size);
+    return std::min(index, m_range.size - 1) + m_range.offset;
+}
+
+double PinkNoise::getDecimalNumber()
+{
+    return m_range.start + getNextSum() * (m_range.end - m_range.start);
+}
+
+void PinkNoise::setParams(NumberProtocolConfig newParams)
+{
+    auto numberOfRows = newParams.protocols.getPinkNoise().getNumberOfRows();
+
+    if(numberOfRows != static_cast<int>(m_rows.size())) {
+        setRows(numberOfRows);
+    }
+
+    m_range = newParams.getRange();
+}
+
+NumberProtocolConfig PinkNoise::getParams()
+{
+    return NumberProtocolConfig(
+        m_range,
+        NumberProtocolParams(PinkNoiseParams(static_cast<int>(m_rows.size()))));
+}
+
+// Private methods
+double PinkNoise::getNextSum()
+{
+    auto numberOfRows = static_cast<int>(m_rows.size());
+    m_counter++;
+
+    // The last row also takes the numbers whose counter has more trailing
+    // zeros than there are rows, so every number changes a row
+    int row = 0;
+    while(row < numberOfRows - 1 && ((m_counter >> row) & 1) == 0) {
+        row++;
+    }
+
+    auto value = m_generator->getNumber();
+    m_sum += value - m_rows[row];
+    m_rows[row] = value;
+
+    // Keep rounding errors in the running sum from leaving the unit interval
+    return std::min(std::max(m_sum / numberOfRows, 0.0), 1.0);
+}
+
+void PinkNoise::setRows(int numberOfRows)
+{
+    if(numberOfRows < 1 || numberOfRows > 30) {
+        ErrorChecker::throwInvalidArgument(
+            "The number of rows must be between 1 and 30");
+    }
+
+    m_rows.resize(numberOfRows);
+    m_sum = 0.0;
+    for(auto &&row : m_rows) {
+        row = m_generator->getNumber();
+        m_sum += row;
+    }
+    m_counter = 0;
+}
+} // namespace aleatoric
@@ -0,0 +1,75 @@
+#ifndef PinkNoise_hpp
+#define PinkNoise_hpp
+
+#include "IUniformRealGenerator.hpp"
+#include "NumberProtocol.hpp"
+#include "NumberProtocolParameters.hpp"
+#include "Range.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+/*!
+ * @brief A protocol for producing random numbers
+ *
+ * A concrete implementation of the Protocol interface which forms part of a
+ * [Strategy](https://en.wikipedia.org/wiki/Strategy_pattern) design pattern
+ * (see Protocol for more information).
+ *
+ * Produces 1/f (pink) noise: a sequence in which slow and fast changes are
+ * equally prominent, lying between the independence of Basic (white noise) and
+ * the drift of Walk and GranularWalk (Brownian, 1/f² noise). This is the
+ * generator Voss and Clarke found to resemble the fluctuations of music.
+ *
+ * __Further detail__: Numbers are the sum of a set of rows, each holding a
+ * random value. Following the Voss-McCartney algorithm, a counter is
+ * incremented with each number and the row updated is given by the number of
+ * trailing zeros in the counter, so the first row changes every second number,
+ * the next every fourth, and so on. The last row also takes the numbers left
+ * over, so it changes as often as the row before it and every number changes
+ * exactly one row (with a single row, every number). Each number therefore
+ * costs a single random draw, however many rows there are.
+ *
+ * The sum is mapped onto the range, so numbers gather towards the centre of
+ * the range the more rows are used.
+ */
+class PinkNoise : public NumberProtocol {
+  public:
+    PinkNoise(std::unique_ptr<IUniformRealGenerator> generator);
+
+    /*!
+     * @param generator Should be an instance of UniformRealGenerator. Default
+     * construction is fine.
+     *
+     * @param range The range within which to produce numbers.
+     *
+     * @param numberOfRows The number of rows summed. Must be between 1 and 30.
+     */
+    PinkNoise(std::unique_ptr<IUniformRealGenerator> generator,
+              Range range,
+              int numberOfRows);
+
+    ~PinkNoise();
+
+    int getIntegerNumber() override;
+
+    double getDecimalNumber() override;
+
+    void setParams(NumberProtocolConfig newParams) override;
+
+    NumberProtocolConfig getParams() override;
+
+  private:
+    std::unique_ptr<IUniformRealGenerator> m_generator;
+    Range m_range;
+    std::vector<double> m_rows;
+    double m_sum;
+    uint32_t m_counter;
+    double getNextSum();
+    void setRows(int numberOfRows);
+};
+} // namespace aleatoric
+
+#endif /* PinkNoise_hpp */
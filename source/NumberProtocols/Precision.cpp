@@ -1,6 +1,6 @@
 #include "Precision.hpp"
 
-#include <stdexcept>
+#include "ErrorChecker.hpp"
 
 namespace aleatoric {
 Precision::Precision(std::unique_ptr<IDiscreteGenerator> generator)
@@ -52,8 +52,9 @@ void Precision::checkDistributionMatchesRange(
     const std::vector<double> &distribution, const Range &range)
 {
     if(static_cast<int>(distribution.size()) != range.size) {
-        throw std::invalid_argument("The vector size for the distribution must "
-                                    "match the size of the provided range");
+        ErrorChecker::throwInvalidArgument(
+            "The vector size for the distribution must "
+            "match the size of the provided range");
     }
 }
 } // namespace aleatoric
@@ -1,29 +1,30 @@
 #include "Ratio.hpp"
 
-#include "SeriesPrinciple.hpp"
+#include "ErrorChecker.hpp"
+#include "FenwickTree.hpp"
 
-#include <stdexcept>
+#include <algorithm>
 
 namespace aleatoric {
-Ratio::Ratio(std::unique_ptr<IDiscreteGenerator> generator)
+Ratio::Ratio(std::unique_ptr<IUniformGenerator> generator)
 : m_generator(std::move(generator)),
   m_range(0, 1),
   m_ratios(std::vector<int> {1, 1}),
-  m_seriesPrinciple(std::make_unique<SeriesPrinciple>())
+  m_remainingCounts(std::make_unique<FenwickTree>())
 {
-    initialise();
+    resetSeries();
 }
 
-Ratio::Ratio(std::unique_ptr<IDiscreteGenerator> generator,
+Ratio::Ratio(std::unique_ptr<IUniformGenerator> generator,
              Range range,
              std::vector<int> ratios)
 : m_generator(std::move(generator)),
   m_range(range),
   m_ratios(ratios),
-  m_seriesPrinciple(std::make_unique<SeriesPrinciple>())
+  m_remainingCounts(std::make_unique<FenwickTree>())
 {
     checkRangeAndRatiosMatch(m_range, m_ratios);
-    initialise();
+    resetSeries();
 }
 
 Ratio::~Ratio()
@@ -31,12 +32,17 @@ Ratio::~Ratio()
 
 int Ratio::getIntegerNumber()
 {
-    if(m_seriesPrinciple->seriesIsComplete(m_generator)) {
-        m_seriesPrinciple->resetSeries(m_generator);
+    if(m_remainingCounts->getTotal() == 0) {
+        resetSeries();
     }
 
-    auto index = m_seriesPrinciple->getNumber(m_generator);
-    return m_selectables[index];
+    // Each number is selected with probability proportional to the number of
+    // times it can still be selected in the series
+    m_generator->setDistribution(0, m_remainingCounts->getTotal() - 1);
+    auto index = m_remainingCounts->findIndex(m_generator->getNumber());
+    m_remainingCounts->add(index, -1);
+
+    return index + m_range.offset;
 }
 
 double Ratio::getDecimalNumber()
@@ -51,9 +57,7 @@ void Ratio::setParams(NumberProtocolConfig newParams)
     checkRangeAndRatiosMatch(newRange, newRatios);
     m_ratios = newRatios;
     m_range = newRange;
-    m_selectables.clear();
-    setSelectables();
-    m_generator->setDistributionVector(m_selectables.size(), 1.0);
+    resetSeries();
 }
 
 NumberProtocolConfig Ratio::getParams()
@@ -63,28 +67,30 @@ NumberProtocolConfig Ratio::getParams()
 }
 
 // Private methods
-void Ratio::setSelectables()
+void Ratio::resetSeries()
 {
+    // A number with a negative ratio is never selected, as with a ratio of 0
+    std::vector<int> counts(m_ratios.size());
     for(size_t i = 0; i < m_ratios.size(); i++) {
-        for(int ii = 0; ii < m_ratios[i]; ii++) {
-            m_selectables.push_back(m_range.offset + i);
-        }
+        counts[i] = std::max(m_ratios[i], 0);
     }
+    m_remainingCounts->setCounts(counts);
 }
 
 void Ratio::checkRangeAndRatiosMatch(const Range &range,
                                      const std::vector<int> &ratios)
 {
     if(range.size != static_cast<int>(ratios.size())) {
-        throw std::invalid_argument(
+        ErrorChecker::throwInvalidArgument(
             "The size of ratios collection must match the size of the range");
     }
-}
 
-void Ratio::initialise()
-{
-    setSelectables();
-    m_generator->setDistributionVector(m_selectables.size(), 1.0);
+    if(std::none_of(ratios.begin(), ratios.end(), [](int ratio) {
+           return ratio > 0;
+       })) {
+        ErrorChecker::throwInvalidArgument(
+            "At least one ratio must be greater than 0");
+    }
 }
 
 } // namespace aleatoric
@@ -1,21 +1,22 @@
 #ifndef Ratio_hpp
 #define Ratio_hpp
 
-#include "IDiscreteGenerator.hpp"
+#include "IUniformGenerator.hpp"
 #include "NumberProtocol.hpp"
 #include "NumberProtocolParameters.hpp"
 #include "Range.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace aleatoric {
-class SeriesPrinciple;
+class FenwickTree;
 
 class Ratio : public NumberProtocol {
   public:
-    Ratio(std::unique_ptr<IDiscreteGenerator> generator);
+    Ratio(std::unique_ptr<IUniformGenerator> generator);
 
-    Ratio(std::unique_ptr<IDiscreteGenerator> generator,
+    Ratio(std::unique_ptr<IUniformGenerator> generator,
           Range range,
           std::vector<int> ratios);
 
@@ -30,15 +31,16 @@ class Ratio : public NumberProtocol {
     NumberProtocolConfig getParams() override;
 
   private:
-    std::unique_ptr<IDiscreteGenerator> m_generator;
+    std::unique_ptr<IUniformGenerator> m_generator;
     Range m_range;
     std::vector<int> m_ratios;
-    std::vector<int> m_selectables;
-    std::unique_ptr<SeriesPrinciple> m_seriesPrinciple;
-    void setSelectables();
+    // The number of times each number in the range can still be selected in
+    // the current series. Memory is proportional to the size of the range,
+    // not to the magnitude of the ratios.
+    std::unique_ptr<FenwickTree> m_remainingCounts;
+    void resetSeries();
     void checkRangeAndRatiosMatch(const Range &range,
                                   const std::vector<int> &ratios);
-    void initialise();
 };
 } // namespace aleatoric
 
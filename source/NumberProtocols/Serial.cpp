@@ -1,12 +1,14 @@
 #include "Serial.hpp"
 
+#include "FeistelPermutation.hpp"
 #include "SeriesPrinciple.hpp"
 
 namespace aleatoric {
 Serial::Serial(std::unique_ptr<IDiscreteGenerator> generator)
 : m_generator(std::move(generator)),
   m_range(0, 1),
-  m_seriesPrinciple(std::make_unique<SeriesPrinciple>())
+  m_seriesPrinciple(std::make_unique<SeriesPrinciple>()),
+  m_seriesPosition(0)
 {
     m_generator->setDistributionVector(m_range.size, 1.0);
 }
@@ -14,16 +16,41 @@ Serial::Serial(std::unique_ptr<IDiscreteGenerator> generator)
 Serial::Serial(std::unique_ptr<IDiscreteGenerator> generator, Range range)
 : m_generator(std::move(generator)),
   m_range(range),
-  m_seriesPrinciple(std::make_unique<SeriesPrinciple>())
+  m_seriesPrinciple(std::make_unique<SeriesPrinciple>()),
+  m_seriesPosition(0)
 {
     m_generator->setDistributionVector(m_range.size, 1.0);
 }
 
+Serial::Serial(std::unique_ptr<IUniformGenerator> seedGenerator)
+: m_range(0, 1),
+  m_seedGenerator(std::move(seedGenerator)),
+  m_permutation(std::make_unique<FeistelPermutation>())
+{
+    startNewPermutation();
+}
+
+Serial::Serial(std::unique_ptr<IUniformGenerator> seedGenerator, Range range)
+: m_range(range),
+  m_seedGenerator(std::move(seedGenerator)),
+  m_permutation(std::make_unique<FeistelPermutation>())
+{
+    startNewPermutation();
+}
+
 Serial::~Serial()
 {}
 
 int Serial::getIntegerNumber()
 {
+    if(m_permutation) {
+        if(m_seriesPosition == m_range.size) {
+            startNewPermutation();
+        }
+
+        return m_permutation->getIndex(m_seriesPosition++) + m_range.offset;
+    }
+
     if(m_seriesPrinciple->seriesIsComplete(m_generator)) {
         m_seriesPrinciple->resetSeries(m_generator);
     }
@@ -40,6 +67,12 @@ double Serial::getDecimalNumber()
 void Serial::setParams(NumberProtocolConfig newParams)
 {
     m_range = newParams.getRange();
+
+    if(m_permutation) {
+        startNewPermutation();
+        return;
+    }
+
     m_generator->setDistributionVector(m_range.size, 1.0);
 }
 
@@ -48,4 +81,12 @@ NumberProtocolConfig Serial::getParams()
     return NumberProtocolConfig(m_range, NumberProtocolParams(SerialParams()));
 }
 
+// Private methods
+void Serial::startNewPermutation()
+{
+    m_permutation->setSize(m_range.size);
+    m_permutation->reseed(m_seedGenerator);
+    m_seriesPosition = 0;
+}
+
 } // namespace aleatoric
@@ -2,6 +2,7 @@
 #define Serial_hpp
 
 #include "IDiscreteGenerator.hpp"
+#include "IUniformGenerator.hpp"
 #include "NumberProtocol.hpp"
 #include "NumberProtocolParameters.hpp"
 #include "Range.hpp"
@@ -9,6 +10,7 @@
 #include <memory>
 
 namespace aleatoric {
+class FeistelPermutation;
 class SeriesPrinciple;
 /*!
  * @brief A protocol for producing random numbers
@@ -25,6 +27,13 @@ class SeriesPrinciple;
  * from within the range with equal probability. Subsequent calls to get a
  * number will prevent previously selected numbers from being selected again
  * until all other possible numbers in the range have been selected.
+ *
+ * __Permutation mode__: When constructed with a UniformGenerator, rather than
+ * a DiscreteGenerator, each series walks a pseudo-random permutation of the
+ * range instead of keeping track of the numbers already selected. Memory use
+ * and the cost of each number are then constant, whatever the size of the
+ * range, so very large ranges can be serialised. A new permutation is seeded
+ * at the start of each series.
  */
 class Serial : public NumberProtocol {
   public:
@@ -40,6 +49,17 @@ class Serial : public NumberProtocol {
      */
     Serial(std::unique_ptr<IDiscreteGenerator> generator, Range range);
 
+    Serial(std::unique_ptr<IUniformGenerator> seedGenerator);
+
+    /*! @brief Constructs the protocol in permutation mode.
+     *
+     * @param seedGenerator Should be an instance of UniformGenerator. It is
+     * used to seed a new permutation of the range for each series.
+     *
+     * @param range The range within which to produce numbers.
+     */
+    Serial(std::unique_ptr<IUniformGenerator> seedGenerator, Range range);
+
     ~Serial();
 
     /*! @brief returns a random number according the the Serialism approach
@@ -61,6 +81,10 @@ class Serial : public NumberProtocol {
     std::unique_ptr<IDiscreteGenerator> m_generator;
     Range m_range;
     std::unique_ptr<SeriesPrinciple> m_seriesPrinciple;
+    std::unique_ptr<IUniformGenerator> m_seedGenerator;
+    std::unique_ptr<FeistelPermutation> m_permutation;
+    int m_seriesPosition;
+    void startNewPermutation();
 };
 } // namespace aleatoric
 
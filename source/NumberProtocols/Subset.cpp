@@ -1,8 +1,8 @@
 #include "Subset.hpp"
 
-#include "SeriesPrinciple.hpp"
+#include "ErrorChecker.hpp"
 
-#include <stdexcept>
+#include <unordered_set>
 
 namespace aleatoric {
 // NB: The original RTC version of this - choice-rhythm - does not restrict the
@@ -17,32 +17,26 @@ namespace aleatoric {
 // that does that. So this note is here as a reminder about the evolution of
 // this away from the original should there be a desire to change it in the
 // future.
-Subset::Subset(std::unique_ptr<IUniformGenerator> uniformGenerator,
-               std::unique_ptr<IDiscreteGenerator> discreteGenerator)
-: m_uniformGenerator(std::move(uniformGenerator)),
-  m_discreteGenerator(std::move(discreteGenerator)),
+Subset::Subset(std::unique_ptr<IUniformGenerator> generator)
+: m_generator(std::move(generator)),
   m_range(0, 1),
   m_subsetMin(1),
-  m_subsetMax(2),
-  m_seriesPrinciple(std::make_unique<SeriesPrinciple>())
+  m_subsetMax(2)
 {
-    initialise();
+    setSubset();
 }
 
-Subset::Subset(std::unique_ptr<IUniformGenerator> uniformGenerator,
-               std::unique_ptr<IDiscreteGenerator> discreteGenerator,
+Subset::Subset(std::unique_ptr<IUniformGenerator> generator,
                Range range,
                int subsetMin,
                int subsetMax)
-: m_uniformGenerator(std::move(uniformGenerator)),
-  m_discreteGenerator(std::move(discreteGenerator)),
+: m_generator(std::move(generator)),
   m_range(range),
   m_subsetMin(subsetMin),
-  m_subsetMax(subsetMax),
-  m_seriesPrinciple(std::make_unique<SeriesPrinciple>())
+  m_subsetMax(subsetMax)
 {
     checkSubsetValues(m_subsetMin, m_subsetMax, m_range);
-    initialise();
+    setSubset();
 }
 
 Subset::~Subset()
@@ -50,7 +44,7 @@ Subset::~Subset()
 
 int Subset::getIntegerNumber()
 {
-    int index = m_uniformGenerator->getNumber();
+    int index = m_generator->getNumber();
     return m_subset[index];
 }
 
@@ -71,7 +65,6 @@ void Subset::setParams(NumberProtocolConfig newParams)
     m_subsetMin = newMin;
     m_subsetMax = newMax;
     m_range = newRange;
-    m_discreteGenerator->setDistributionVector(m_range.size, 1.0);
     setSubset();
 }
 
@@ -85,17 +78,31 @@ NumberProtocolConfig Subset::getParams()
 // Private methods
 void Subset::setSubset()
 {
-    m_uniformGenerator->setDistribution(m_subsetMin, m_subsetMax);
-
+    m_generator->setDistribution(m_subsetMin, m_subsetMax);
+    int subsetSize = m_generator->getNumber();
+
+    // Floyd's algorithm: for each of the last subsetSize indices of the
+    // range, pick an index up to and including it. If that index has already
+    // been chosen, choose the current one instead, which cannot have been.
+    // Every subset of the range is equally likely.
+    std::unordered_set<int> chosenIndices(subsetSize);
     m_subset.clear();
-    m_subset.resize(m_uniformGenerator->getNumber());
+    m_subset.reserve(subsetSize);
+
+    for(int i = m_range.size - subsetSize; i < m_range.size; i++) {
+        m_generator->setDistribution(0, i);
+        int index = m_generator->getNumber();
+
+        if(!chosenIndices.insert(index).second) {
+            index = i;
+            chosenIndices.insert(index);
+        }
 
-    for(auto &&i : m_subset) {
-        i = m_seriesPrinciple->getNumber(m_discreteGenerator) + m_range.offset;
+        m_subset.push_back(index + m_range.offset);
     }
 
-    // now set the uniformGenerator to pick indices from the subset
-    m_uniformGenerator->setDistribution(0, m_subset.size() - 1);
+    // now set the generator to pick indices from the subset
+    m_generator->setDistribution(0, m_subset.size() - 1);
 }
 
 void Subset::checkSubsetValues(const int &subsetMin,
@@ -103,22 +110,16 @@ void Subset::checkSubsetValues(const int &subsetMin,
                                const Range &range)
 {
     if(subsetMin < 1 || subsetMin > subsetMax) {
-        throw std::invalid_argument(
+        ErrorChecker::throwInvalidArgument(
             "The value passed as argument for subsetMin must be greater than 1 "
             "and less than subsetMin");
     }
 
     if(subsetMax < subsetMin || subsetMax > range.size) {
-        throw std::invalid_argument(
+        ErrorChecker::throwInvalidArgument(
             "The value passed as argument for subsetMax must be greater than "
             "subsetMin and no greater than the range size");
     }
 }
 
-void Subset::initialise()
-{
-    m_discreteGenerator->setDistributionVector(m_range.size, 1.0);
-    setSubset();
-}
-
 } // namespace aleatoric
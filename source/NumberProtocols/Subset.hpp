@@ -1,24 +1,31 @@
 #ifndef Subset_hpp
 #define Subset_hpp
 
-#include "IDiscreteGenerator.hpp"
 #include "IUniformGenerator.hpp"
 #include "NumberProtocol.hpp"
 #include "NumberProtocolParameters.hpp"
 #include "Range.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace aleatoric {
-class SeriesPrinciple;
-
+/*!
+ * @brief A protocol for producing random numbers from a subset of the range
+ *
+ * A subset of non-repeated numbers, of a size between the subset min and max,
+ * is chosen from the range. Numbers are then selected from the subset with
+ * equal probability.
+ *
+ * The subset is chosen with Floyd's algorithm, so choosing it takes time and
+ * memory proportional to the size of the subset only. This makes it suitable
+ * for very large ranges.
+ */
 class Subset : public NumberProtocol {
   public:
-    Subset(std::unique_ptr<IUniformGenerator> uniformGenerator,
-           std::unique_ptr<IDiscreteGenerator> discreteGenerator);
+    Subset(std::unique_ptr<IUniformGenerator> generator);
 
-    Subset(std::unique_ptr<IUniformGenerator> uniformGenerator,
-           std::unique_ptr<IDiscreteGenerator> discreteGenerator,
+    Subset(std::unique_ptr<IUniformGenerator> generator,
            Range range,
            int subsetMin,
            int subsetMax);
@@ -33,18 +40,15 @@ class Subset : public NumberProtocol {
     NumberProtocolConfig getParams() override;
 
   private:
-    std::unique_ptr<IUniformGenerator> m_uniformGenerator;
-    std::unique_ptr<IDiscreteGenerator> m_discreteGenerator;
+    std::unique_ptr<IUniformGenerator> m_generator;
     Range m_range;
     int m_subsetMin;
     int m_subsetMax;
-    std::unique_ptr<SeriesPrinciple> m_seriesPrinciple;
     std::vector<int> m_subset;
     void setSubset();
     void checkSubsetValues(const int &subsetMin,
                            const int &subsetMax,
                            const Range &range);
-    void initialise();
 };
 } // namespace aleatoric
 #endif /* Subset_hpp */
@@ -0,0 +1,204 @@
+#include "TendencyMask.hpp"
+
+#include "ErrorChecker.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace aleatoric {
+namespace {
+double getValueAtStep(const std::vector<Breakpoint> &envelope, int step)
+{
+    auto next = std::upper_bound(
+        envelope.begin(),
+        envelope.end(),
+        step,
+        [](int step, const Breakpoint &breakpoint) {
+            return step < breakpoint.step;
+        });
+
+    if(next == envelope.end()) {
+        return envelope.back().value;
+    }
+
+    auto previous = next - 1;
+    return previous->value + (next->value - previous->value) *
+                                 (step - previous->step) /
+                                 (next->step - previous->step);
+}
+
+void checkEnvelope(const std::vector<Breakpoint> &envelope, const Range &range)
+{
+    if(envelope.empty() || envelope.front().step != 0) {
+        ErrorChecker::throwInvalidArgument("Envelopes must start at step 0");
+    }
+
+    for(size_t i = 0; i < envelope.size(); i++) {
+        if(i > 0 && envelope[i].step <= envelope[i - 1].step) {
+            ErrorChecker::throwInvalidArgument(
+                "Envelope steps must be strictly increasing");
+        }
+
+        if(!range.floatingPointIsInRange(envelope[i].value)) {
+            ErrorChecker::throwInvalidArgument(
+                "Envelope values must be within the range");
+        }
+    }
+}
+} // namespace
+
+TendencyMask::TendencyMask(std::unique_ptr<NumberProtocol> source)
+: m_source(std::move(source)), m_range(0, 1)
+{
+    auto sourceRange = m_source->getParams().getRange();
+    m_sourceStart = sourceRange.start;
+    m_sourceScale = 1.0 / (sourceRange.end - sourceRange.start);
+
+    setEnvelopes(m_range, {{0, 0.0}}, {{0, 1.0}});
+}
+
+TendencyMask::TendencyMask(std::unique_ptr<NumberProtocol> source,
+                           Range range,
+                           std::vector<Breakpoint> lowerEnvelope,
+                           std::vector<Breakpoint> upperEnvelope)
+: m_source(std::move(source)), m_range(range)
+{
+    auto sourceRange = m_source->getParams().getRange();
+    m_sourceStart = sourceRange.start;
+    m_sourceScale = 1.0 / (sourceRange.end - sourceRange.start);
+
+    setEnvelopes(m_range, lowerEnvelope, upperEnvelope);
+}
+
+TendencyMask::~TendencyMask()
+{}
+
+int TendencyMask::getIntegerNumber()
+{
+    return static_cast<int>(std::lround(getDecimalNumber()));
+}
+
+double TendencyMask::getDecimalNumber()
+{
+    return mask(m_source->getDecimalNumber());
+}
+
+std::vector<int> TendencyMask::getIntegerCollection(int size)
+{
+    auto decimals = getDecimalCollection(size);
+
+    std::vector<int> collection(decimals.size());
+    for(size_t i = 0; i < collection.size(); i++) {
+        collection[i] = static_cast<int>(std::lround(decimals[i]));
+    }
+
+    return collection;
+}
+
+std::vector<double> TendencyMask::getDecimalCollection(int size)
+{
+    auto collection = m_source->getDecimalCollection(size);
+
+    for(auto &&number : collection) {
+        number = mask(number);
+    }
+
+    return collection;
+}
+
+void TendencyMask::setParams(NumberProtocolConfig newParams)
+{
+    auto tendencyMaskParams = newParams.protocols.getTendencyMask();
+
+    setEnvelopes(newParams.getRange(),
+                 tendencyMaskParams.getLowerEnvelope(),
+                 tendencyMaskParams.getUpperEnvelope());
+    m_range = newParams.getRange();
+}
+
+NumberProtocolConfig TendencyMask::getParams()
+{
+    return NumberProtocolConfig(
+        m_range,
+        NumberProtocolParams(TendencyMaskParams(m_lowerEnvelope.breakpoints,
+                                                m_upperEnvelope.breakpoints)));
+}
+
+// Private methods
+double TendencyMask::mask(double sourceNumber)
+{
+    auto lower = m_lowerEnvelope.value;
+    auto upper = m_upperEnvelope.value;
+    auto proportion = (sourceNumber - m_sourceStart) * m_sourceScale;
+    auto number = lower + proportion * (upper - lower);
+
+    // Steps beyond the last breakpoint change nothing, so stop counting
+    // rather than overflow
+    if(m_step < std::numeric_limits<int>::max()) {
+        m_step++;
+    }
+    m_lowerEnvelope.advance(m_step);
+    m_upperEnvelope.advance(m_step);
+
+    return number;
+}
+
+void TendencyMask::setEnvelopes(Range range,
+                                std::vector<Breakpoint> lowerEnvelope,
+                                std::vector<Breakpoint> upperEnvelope)
+{
+    checkEnvelope(lowerEnvelope, range);
+    checkEnvelope(upperEnvelope, range);
+
+    // Both envelopes are straight lines between the union of their
+    // breakpoints, so checking those steps checks every step
+    for(const auto &envelope : {lowerEnvelope, upperEnvelope}) {
+        for(const auto &breakpoint : envelope) {
+            if(getValueAtStep(lowerEnvelope, breakpoint.step) >
+               getValueAtStep(upperEnvelope, breakpoint.step)) {
+                ErrorChecker::throwInvalidArgument(
+                    "The lower envelope must not rise above the upper "
+                    "envelope");
+            }
+        }
+    }
+
+    m_lowerEnvelope.breakpoints = lowerEnvelope;
+    m_upperEnvelope.breakpoints = upperEnvelope;
+    m_lowerEnvelope.reset();
+    m_upperEnvelope.reset();
+    m_step = 0;
+}
+
+void TendencyMask::Envelope::reset()
+{
+    setSegment(0);
+}
+
+void TendencyMask::Envelope::advance(int step)
+{
+    auto nextSegment = segment + 1;
+
+    if(nextSegment < static_cast<int>(breakpoints.size()) &&
+       step >= breakpoints[nextSegment].step) {
+        // Land exactly on the breakpoint so that errors do not accumulate
+        setSegment(nextSegment);
+    } else {
+        value += increment;
+    }
+}
+
+void TendencyMask::Envelope::setSegment(int newSegment)
+{
+    segment = newSegment;
+    value = breakpoints[segment].value;
+    increment = 0.0;
+
+    if(segment + 1 < static_cast<int>(breakpoints.size())) {
+        const auto &current = breakpoints[segment];
+        const auto &next = breakpoints[segment + 1];
+        increment = (next.value - current.value) / (next.step - current.step);
+    }
+}
+} // namespace aleatoric
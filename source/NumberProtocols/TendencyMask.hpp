@@ -0,0 +1,102 @@
+#ifndef TendencyMask_hpp
+#define TendencyMask_hpp
+
+#include "NumberProtocol.hpp"
+#include "NumberProtocolParameters.hpp"
+#include "Range.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+/*!
+ * @brief A protocol for producing random numbers
+ *
+ * A concrete implementation of the Protocol interface which forms part of a
+ * [Strategy](https://en.wikipedia.org/wiki/Strategy_pattern) design pattern
+ * (see Protocol for more information).
+ *
+ * Applies a tendency mask, as described by Gottfried Michael Koenig, to the
+ * numbers of another protocol (the source). The lower and upper bounds of the
+ * mask each follow an envelope of breakpoints over the course of the numbers
+ * produced, so the region of the range in which numbers fall can widen,
+ * narrow and move over time.
+ *
+ * __Further detail__: Each number from the source is scaled from the source's
+ * range to lie between the current lower and upper bounds. The source is never
+ * reconfigured, so it keeps its character (a walk remains a walk within the
+ * moving mask). The bounds are interpolated linearly between breakpoints and
+ * are advanced incrementally with each number, which makes collections a
+ * single pass over a bulk collection from the source. After the last
+ * breakpoint of an envelope its bound holds its final value.
+ *
+ * Integer numbers are the decimal numbers rounded to the nearest integer.
+ */
+class TendencyMask : public NumberProtocol {
+  public:
+    /*!
+     * @param source The protocol whose numbers are masked. Its range and
+     * params should be set before it is passed in.
+     */
+    TendencyMask(std::unique_ptr<NumberProtocol> source);
+
+    /*!
+     * @param source The protocol whose numbers are masked. Its range and
+     * params should be set before it is passed in.
+     *
+     * @param range The range which the envelopes must lie within.
+     *
+     * @param lowerEnvelope The breakpoints for the lower bound of the mask.
+     *
+     * @param upperEnvelope The breakpoints for the upper bound of the mask.
+     * Must not fall below the lower envelope.
+     */
+    TendencyMask(std::unique_ptr<NumberProtocol> source,
+                 Range range,
+                 std::vector<Breakpoint> lowerEnvelope,
+                 std::vector<Breakpoint> upperEnvelope);
+
+    ~TendencyMask();
+
+    int getIntegerNumber() override;
+
+    double getDecimalNumber() override;
+
+    std::vector<int> getIntegerCollection(int size) override;
+
+    std::vector<double> getDecimalCollection(int size) override;
+
+    /*!
+     * @brief Sets the range and envelopes and restarts the envelopes from
+     * step 0. The source is left as it is.
+     */
+    void setParams(NumberProtocolConfig newParams) override;
+
+    NumberProtocolConfig getParams() override;
+
+  private:
+    struct Envelope {
+        std::vector<Breakpoint> breakpoints;
+        int segment;
+        double value;
+        double increment;
+        void reset();
+        void advance(int step);
+        void setSegment(int newSegment);
+    };
+
+    std::unique_ptr<NumberProtocol> m_source;
+    Range m_range;
+    double m_sourceStart;
+    double m_sourceScale;
+    Envelope m_lowerEnvelope;
+    Envelope m_upperEnvelope;
+    int m_step;
+    double mask(double sourceNumber);
+    void setEnvelopes(Range range,
+                      std::vector<Breakpoint> lowerEnvelope,
+                      std::vector<Breakpoint> upperEnvelope);
+};
+} // namespace aleatoric
+
+#endif /* TendencyMask_hpp */
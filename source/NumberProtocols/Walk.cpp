@@ -2,9 +2,6 @@
 
 #include "ErrorChecker.hpp"
 
-#include <stdexcept> // std::invalid_argument
-#include <string>
-
 namespace aleatoric {
 Walk::Walk(std::unique_ptr<IUniformGenerator> generator)
 : m_generator(std::move(generator)),
@@ -23,7 +20,7 @@ Walk::Walk(std::unique_ptr<IUniformGenerator> generator,
   m_maxStep(maxStep),
   m_haveRequestedFirstNumber(false)
 {
-    checkMaxStepIsValid(maxStep, m_range);
+    ErrorChecker::checkMaxStepIsValid(maxStep, m_range);
 
     m_generator->setDistribution(m_range.start, m_range.end);
 }
@@ -52,7 +49,7 @@ void Walk::setParams(NumberProtocolConfig newParams)
     auto maxStep = newParams.protocols.getWalk().getMaxStep();
     auto newRange = newParams.getRange();
 
-    checkMaxStepIsValid(maxStep, newRange);
+    ErrorChecker::checkMaxStepIsValid(maxStep, newRange);
 
     m_maxStep = maxStep;
     setRange(newRange);
@@ -80,15 +77,6 @@ void Walk::setForNextStep(int lastSelectedNumber)
     m_generator->setDistribution(newRangeStart, newRangeEnd);
 }
 
-void Walk::checkMaxStepIsValid(int maxStep, Range range)
-{
-    if(maxStep < 1 || maxStep > range.size) {
-        throw std::invalid_argument("The value passed as argument for maxStep "
-                                    "must be less than or equal to " +
-                                    std::to_string(range.size));
-    }
-}
-
 void Walk::setRange(Range newRange)
 {
     m_range = newRange;
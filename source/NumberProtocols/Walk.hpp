@@ -103,7 +103,6 @@ class Walk : public NumberProtocol {
     void setForNextStep(int lastSelectedNumber);
     bool m_haveRequestedFirstNumber;
     int m_lastNumberSelected;
-    void checkMaxStepIsValid(int maxStep, Range range);
     void setRange(Range newRange);
 };
 } // namespace aleatoric
@@ -0,0 +1,116 @@
+#include "WalkBank.hpp"
+
+#include "EngineBank.hpp"
+#include "ErrorChecker.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace aleatoric {
+WalkBank::WalkBank(int numberOfVoices)
+: WalkBank(numberOfVoices, Range(0, 1), 1)
+{}
+
+WalkBank::WalkBank(int numberOfVoices, Range range, int maxStep)
+: m_engines(std::make_unique<EngineBank>())
+{
+    if(numberOfVoices < 1) {
+        ErrorChecker::throwInvalidArgument(
+            "The number of voices must be greater than 0");
+    }
+
+    ErrorChecker::checkMaxStepIsValid(maxStep, range);
+
+    m_engines->setSize(numberOfVoices);
+    m_randomNumbers.resize(numberOfVoices);
+    m_rangeStarts.assign(numberOfVoices, range.start);
+    m_rangeEnds.assign(numberOfVoices, range.end);
+    m_maxSteps.assign(numberOfVoices, maxStep);
+    m_haveRequestedFirstNumber.assign(numberOfVoices, 0);
+    m_lastNumbersSelected.assign(numberOfVoices, range.start);
+}
+
+WalkBank::~WalkBank()
+{}
+
+int WalkBank::getNumberOfVoices()
+{
+    return static_cast<int>(m_lastNumbersSelected.size());
+}
+
+void WalkBank::step()
+{
+    m_engines->getNumbers(m_randomNumbers.data());
+
+    auto size = m_lastNumbersSelected.size();
+    auto randomNumbers = m_randomNumbers.data();
+    auto rangeStarts = m_rangeStarts.data();
+    auto rangeEnds = m_rangeEnds.data();
+    auto maxSteps = m_maxSteps.data();
+    auto haveRequestedFirstNumber = m_haveRequestedFirstNumber.data();
+    auto lastNumbers = m_lastNumbersSelected.data();
+
+    // Selects within the sub-range around each voice's last number, curtailed
+    // to the voice's range (or the whole range for a first step). Free of
+    // branches so the loop can be vectorised.
+    for(size_t i = 0; i < size; i++) {
+        auto started = haveRequestedFirstNumber[i] != 0;
+        auto stepStart = std::max(rangeStarts[i], lastNumbers[i] - maxSteps[i]);
+        auto stepEnd = std::min(rangeEnds[i], lastNumbers[i] + maxSteps[i]);
+        auto subRangeStart = started ? stepStart : rangeStarts[i];
+        auto subRangeEnd = started ? stepEnd : rangeEnds[i];
+
+        // scales the 32 bit random number into the sub-range
+        auto subRangeSize =
+            static_cast<uint64_t>(subRangeEnd - subRangeStart) + 1;
+        lastNumbers[i] = subRangeStart +
+                         static_cast<int>((randomNumbers[i] * subRangeSize) >>
+                                          32);
+        haveRequestedFirstNumber[i] = 1;
+    }
+}
+
+const std::vector<int> &WalkBank::getIntegerNumbers()
+{
+    return m_lastNumbersSelected;
+}
+
+void WalkBank::setParams(int voice, NumberProtocolConfig newParams)
+{
+    checkVoiceIsValid(voice);
+
+    auto maxStep = newParams.protocols.getWalk().getMaxStep();
+    auto newRange = newParams.getRange();
+    ErrorChecker::checkMaxStepIsValid(maxStep, newRange);
+
+    m_rangeStarts[voice] = newRange.start;
+    m_rangeEnds[voice] = newRange.end;
+    m_maxSteps[voice] = maxStep;
+
+    // As with Walk, the walk continues from the last number if it is within
+    // the new range, otherwise the next step selects from the whole range
+    if(!newRange.numberIsInRange(m_lastNumbersSelected[voice])) {
+        m_haveRequestedFirstNumber[voice] = 0;
+    }
+}
+
+NumberProtocolConfig WalkBank::getParams(int voice)
+{
+    checkVoiceIsValid(voice);
+
+    return NumberProtocolConfig(
+        Range(m_rangeStarts[voice], m_rangeEnds[voice]),
+        NumberProtocolParams(WalkParams(m_maxSteps[voice])));
+}
+
+// Private methods
+void WalkBank::checkVoiceIsValid(int voice)
+{
+    if(voice < 0 || voice >= getNumberOfVoices()) {
+        ErrorChecker::throwInvalidArgument(
+            "The voice must be between 0 and " +
+            std::to_string(getNumberOfVoices() - 1));
+    }
+}
+
+} // namespace aleatoric
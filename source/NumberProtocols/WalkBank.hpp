@@ -0,0 +1,71 @@
+#ifndef WalkBank_hpp
+#define WalkBank_hpp
+
+#include "NumberProtocolParameters.hpp"
+#include "Range.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+class EngineBank;
+
+/*!
+ * @brief Many independent Walk voices, advanced together
+ *
+ * Each voice follows the Walk protocol (see Walk) with its own range, maximum
+ * step and random number engine. Rather than holding one Walk object per voice,
+ * the state of every voice is held in contiguous arrays, so that a single call
+ * to step() advances all voices in loops the compiler is able to vectorise.
+ *
+ * The range and WalkParams of each voice can be set individually.
+ */
+class WalkBank {
+  public:
+    WalkBank(int numberOfVoices);
+
+    /*!
+     * @param numberOfVoices The number of independent walks. Must be at least
+     * 1.
+     *
+     * @param range The range every voice starts with.
+     *
+     * @param maxStep The maximum step every voice starts with. Must not exceed
+     * the size of the range.
+     */
+    WalkBank(int numberOfVoices, Range range, int maxStep);
+
+    ~WalkBank();
+
+    int getNumberOfVoices();
+
+    /*!
+     * @brief Advances every voice one step of its walk. As with Walk, the
+     * first step of a voice selects from its whole range.
+     */
+    void step();
+
+    /*!
+     * @return the number each voice selected at the last step, indexed by
+     * voice.
+     */
+    const std::vector<int> &getIntegerNumbers();
+
+    void setParams(int voice, NumberProtocolConfig newParams);
+
+    NumberProtocolConfig getParams(int voice);
+
+  private:
+    std::unique_ptr<EngineBank> m_engines;
+    std::vector<uint32_t> m_randomNumbers;
+    std::vector<int> m_rangeStarts;
+    std::vector<int> m_rangeEnds;
+    std::vector<int> m_maxSteps;
+    std::vector<int> m_haveRequestedFirstNumber;
+    std::vector<int> m_lastNumbersSelected;
+    void checkVoiceIsValid(int voice);
+};
+} // namespace aleatoric
+
+#endif /* WalkBank_hpp */
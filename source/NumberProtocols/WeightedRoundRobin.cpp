@@ -0,0 +1,199 @@
+#include "WeightedRoundRobin.hpp"
+
+#include "ErrorChecker.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace aleatoric {
+namespace {
+// Allows for rounding in times that should be whole numbers of requests, such
+// as those of numbers with equal weights
+const double tolerance = 1e-6;
+} // namespace
+
+WeightedRoundRobin::WeightedRoundRobin(
+    std::unique_ptr<IUniformRealGenerator> generator)
+: m_generator(std::move(generator)),
+  m_range(0, 1),
+  m_weights(std::vector<double> {1.0, 1.0}),
+  m_jitter(1.0)
+{
+    m_generator->setDistribution(0.0, 1.0);
+    initialise();
+}
+
+WeightedRoundRobin::WeightedRoundRobin(
+    std::unique_ptr<IUniformRealGenerator> generator,
+    Range range,
+    std::vector<double> weights,
+    double jitter)
+: m_generator(std::move(generator)), m_range(range), m_weights(weights)
+{
+    checkParams(m_weights, jitter, m_range);
+    m_jitter = jitter;
+    m_generator->setDistribution(0.0, 1.0);
+    initialise();
+}
+
+WeightedRoundRobin::~WeightedRoundRobin()
+{}
+
+int WeightedRoundRobin::getIntegerNumber()
+{
+    m_requests++;
+
+    auto waitingAfter = [this](int a, int b) { return isWaitingAfter(a, b); };
+    auto readyAfter = [this](int a, int b) { return isReadyAfter(a, b); };
+
+    // Rounding can leave no occurrence eligible a fraction early, in which
+    // case the one closest to eligible is taken
+    while(!m_waiting.empty() &&
+          (m_eligible[m_waiting.front()] < m_requests - tolerance ||
+           m_ready.empty())) {
+        std::pop_heap(m_waiting.begin(), m_waiting.end(), waitingAfter);
+        m_ready.push_back(m_waiting.back());
+        m_waiting.pop_back();
+        std::push_heap(m_ready.begin(), m_ready.end(), readyAfter);
+    }
+
+    std::pop_heap(m_ready.begin(), m_ready.end(), readyAfter);
+    auto index = m_ready.back();
+    m_ready.pop_back();
+
+    m_counts[index]++;
+    schedule(index);
+
+    return index + m_range.offset;
+}
+
+double WeightedRoundRobin::getDecimalNumber()
+{
+    return static_cast<double>(getIntegerNumber());
+}
+
+void WeightedRoundRobin::setParams(NumberProtocolConfig newParams)
+{
+    auto params = newParams.protocols.getWeightedRoundRobin();
+    auto newWeights = params.getWeights();
+    auto newRange = newParams.getRange();
+    checkParams(newWeights, params.getJitter(), newRange);
+    m_weights = newWeights;
+    m_jitter = params.getJitter();
+    m_range = newRange;
+    initialise();
+}
+
+NumberProtocolConfig WeightedRoundRobin::getParams()
+{
+    return NumberProtocolConfig(
+        m_range,
+        NumberProtocolParams(WeightedRoundRobinParams(m_weights, m_jitter)));
+}
+
+// Private methods
+void WeightedRoundRobin::initialise()
+{
+    auto size = m_weights.size();
+    auto total = std::accumulate(m_weights.begin(), m_weights.end(), 0.0);
+    m_shares.resize(size);
+    for(size_t i = 0; i < size; i++) {
+        m_shares[i] = m_weights[i] / total;
+    }
+
+    m_counts.assign(size, 0);
+    m_eligible.assign(size, 0.0);
+    m_due.assign(size, 0.0);
+    m_order.assign(size, 0.0);
+    m_waiting.clear();
+    m_ready.clear();
+    m_requests = 0;
+
+    for(size_t i = 0; i < size; i++) {
+        if(m_shares[i] > 0.0) {
+            schedule(static_cast<int>(i));
+        }
+    }
+}
+
+void WeightedRoundRobin::schedule(int index)
+{
+    // The next occurrence of the number becomes eligible once the number is
+    // behind its share, and is due by the request at which it would fall a
+    // whole occurrence behind
+    auto share = m_shares[index];
+    auto count = static_cast<double>(m_counts[index]);
+    m_eligible[index] = count / share;
+    auto deadline = (count + 1.0) / share;
+    m_due[index] = std::ceil(deadline - tolerance);
+
+    // Occurrences due at the same request can be selected in any order
+    // without missing a deadline, so the jitter only reorders those
+    auto order = deadline - (m_due[index] - 1.0);
+    if(m_jitter > 0.0) {
+        order = (1.0 - m_jitter) * order + m_jitter * m_generator->getNumber();
+    }
+    m_order[index] = order;
+
+    if(m_eligible[index] < m_requests + 1 - tolerance) {
+        m_ready.push_back(index);
+        std::push_heap(m_ready.begin(),
+                       m_ready.end(),
+                       [this](int a, int b) { return isReadyAfter(a, b); });
+    } else {
+        m_waiting.push_back(index);
+        std::push_heap(m_waiting.begin(),
+                       m_waiting.end(),
+                       [this](int a, int b) { return isWaitingAfter(a, b); });
+    }
+}
+
+bool WeightedRoundRobin::isWaitingAfter(int a, int b)
+{
+    if(m_eligible[a] != m_eligible[b]) {
+        return m_eligible[a] > m_eligible[b];
+    }
+    return a > b;
+}
+
+bool WeightedRoundRobin::isReadyAfter(int a, int b)
+{
+    if(m_due[a] != m_due[b]) {
+        return m_due[a] > m_due[b];
+    }
+    if(m_order[a] != m_order[b]) {
+        return m_order[a] > m_order[b];
+    }
+    return a > b;
+}
+
+void WeightedRoundRobin::checkParams(const std::vector<double> &weights,
+                                     double jitter,
+                                     const Range &range)
+{
+    if(static_cast<int>(weights.size()) != range.size) {
+        ErrorChecker::throwInvalidArgument(
+            "The size of the weights collection must "
+            "match the size of the range");
+    }
+
+    if(std::any_of(weights.begin(), weights.end(), [](double weight) {
+           return weight < 0.0;
+       })) {
+        ErrorChecker::throwInvalidArgument("Weights must not be negative");
+    }
+
+    if(std::none_of(weights.begin(), weights.end(), [](double weight) {
+           return weight > 0.0;
+       })) {
+        ErrorChecker::throwInvalidArgument(
+            "At least one weight must be greater than 0");
+    }
+
+    if(!(jitter >= 0.0 && jitter <= 1.0)) {
+        ErrorChecker::throwInvalidArgument(
+            "The jitter must be between 0 and 1");
+    }
+}
+} // namespace aleatoric
@@ -0,0 +1,110 @@
+#ifndef WeightedRoundRobin_hpp
+#define WeightedRoundRobin_hpp
+
+#include "IUniformRealGenerator.hpp"
+#include "NumberProtocol.hpp"
+#include "NumberProtocolParameters.hpp"
+#include "Range.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+/*!
+ * @brief A protocol for producing numbers that keep to a target distribution
+ * from the very first number
+ *
+ * A concrete implementation of the Protocol interface which forms part of a
+ * [Strategy](https://en.wikipedia.org/wiki/Strategy_pattern) design pattern
+ * (see Protocol for more information).
+ *
+ * Each number in the range is given a weight, as with Precision. Precision
+ * only matches its distribution in the long run, so a short excerpt can be
+ * badly skewed. This protocol instead tracks how often each number has
+ * occurred: after any count of numbers, how often each number has occurred
+ * differs from the count times its share of the total weight by less than 1.
+ * Short phrases are therefore always representative of the distribution.
+ * Numbers with a weight of 0 are never selected.
+ *
+ * Jitter decides how the order varies. With a jitter of 0 the protocol is
+ * deterministic. With a jitter above 0, numbers that are due at the same time
+ * are selected in a random order, and at 1 that order is entirely random. With
+ * equal weights, for instance, a jitter of 1 selects each number once, in a
+ * random order, before any number occurs again, as Serial does. Jitter never
+ * loosens the bound above.
+ *
+ * __Further detail__: Each occurrence of a number has a window in which it is
+ * due: it becomes _eligible_ once the number is behind its share, and is due
+ * by the time it would fall a whole occurrence behind. Every time a number is
+ * requested, the eligible occurrence that is due soonest is selected (earliest
+ * deadline first), with occurrences due at the same request ordered by the
+ * jitter. As the shares add up to 1 this always meets every deadline. The
+ * numbers waiting to become eligible and the eligible numbers are each kept in
+ * a binary heap, so each number costs O(log n) for a range of size n, rather
+ * than the O(n) of adding each weight to a running total (smooth weighted
+ * round robin).
+ *
+ * Numbers are always integers: getDecimalNumber() returns the same numbers as
+ * getIntegerNumber().
+ */
+class WeightedRoundRobin : public NumberProtocol {
+  public:
+    WeightedRoundRobin(std::unique_ptr<IUniformRealGenerator> generator);
+
+    /*!
+     * @param generator Should be an instance of UniformRealGenerator. Default
+     * construction is fine. Used for the jitter.
+     *
+     * @param range The range within which to produce numbers.
+     *
+     * @param weights The weight for each number in the range. Must match the
+     * size of the range, must not be negative and must include at least one
+     * weight above 0.
+     *
+     * @param jitter How random the order of numbers due at the same time is.
+     * Must be between 0 and 1.
+     */
+    WeightedRoundRobin(std::unique_ptr<IUniformRealGenerator> generator,
+                       Range range,
+                       std::vector<double> weights,
+                       double jitter);
+
+    ~WeightedRoundRobin();
+
+    int getIntegerNumber() override;
+
+    double getDecimalNumber() override;
+
+    /*!
+     * @brief Sets the range, weights and jitter, and starts tracking how often
+     * each number occurs afresh.
+     */
+    void setParams(NumberProtocolConfig newParams) override;
+
+    NumberProtocolConfig getParams() override;
+
+  private:
+    std::unique_ptr<IUniformRealGenerator> m_generator;
+    Range m_range;
+    std::vector<double> m_weights;
+    double m_jitter;
+    std::vector<double> m_shares;
+    std::vector<int64_t> m_counts;
+    std::vector<double> m_eligible;
+    std::vector<double> m_due;
+    std::vector<double> m_order;
+    std::vector<int> m_waiting;
+    std::vector<int> m_ready;
+    int64_t m_requests;
+    void initialise();
+    void schedule(int index);
+    bool isWaitingAfter(int a, int b);
+    bool isReadyAfter(int a, int b);
+    void checkParams(const std::vector<double> &weights,
+                     double jitter,
+                     const Range &range);
+};
+} // namespace aleatoric
+
+#endif /* WeightedRoundRobin_hpp */
@@ -0,0 +1,112 @@
+#include "WeightedSerial.hpp"
+
+#include "ErrorChecker.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace aleatoric {
+WeightedSerial::WeightedSerial(std::unique_ptr<IUniformRealGenerator> generator)
+: m_generator(std::move(generator)),
+  m_range(0, 1),
+  m_weights(std::vector<double> {1.0, 1.0})
+{
+    m_generator->setDistribution(0.0, 1.0);
+    setSeriesOrder();
+}
+
+WeightedSerial::WeightedSerial(std::unique_ptr<IUniformRealGenerator> generator,
+                               Range range,
+                               std::vector<double> weights)
+: m_generator(std::move(generator)), m_range(range), m_weights(weights)
+{
+    checkWeights(m_weights, m_range);
+    m_generator->setDistribution(0.0, 1.0);
+    setSeriesOrder();
+}
+
+WeightedSerial::~WeightedSerial()
+{}
+
+int WeightedSerial::getIntegerNumber()
+{
+    if(m_seriesPosition == m_seriesOrder.size()) {
+        setSeriesOrder();
+    }
+
+    return m_seriesOrder[m_seriesPosition++] + m_range.offset;
+}
+
+double WeightedSerial::getDecimalNumber()
+{
+    return static_cast<double>(getIntegerNumber());
+}
+
+void WeightedSerial::setParams(NumberProtocolConfig newParams)
+{
+    auto newWeights = newParams.protocols.getWeightedSerial().getWeights();
+    auto newRange = newParams.getRange();
+    checkWeights(newWeights, newRange);
+    m_weights = newWeights;
+    m_range = newRange;
+    setSeriesOrder();
+}
+
+NumberProtocolConfig WeightedSerial::getParams()
+{
+    return NumberProtocolConfig(
+        m_range,
+        NumberProtocolParams(WeightedSerialParams(m_weights)));
+}
+
+// Private methods
+void WeightedSerial::setSeriesOrder()
+{
+    std::vector<std::pair<double, int>> keys;
+    keys.reserve(m_weights.size());
+
+    for(size_t i = 0; i < m_weights.size(); i++) {
+        if(m_weights[i] > 0.0) {
+            // log(u) / weight orders identically to u^(1 / weight), without
+            // the precision loss for small weights
+            keys.emplace_back(std::log(m_generator->getNumber()) / m_weights[i],
+                              static_cast<int>(i));
+        }
+    }
+
+    std::sort(keys.begin(), keys.end(), [](const auto &a, const auto &b) {
+        return a.first > b.first;
+    });
+
+    m_seriesOrder.clear();
+    for(auto &&key : keys) {
+        m_seriesOrder.push_back(key.second);
+    }
+
+    m_seriesPosition = 0;
+}
+
+void WeightedSerial::checkWeights(const std::vector<double> &weights,
+                                  const Range &range)
+{
+    if(static_cast<int>(weights.size()) != range.size) {
+        ErrorChecker::throwInvalidArgument(
+            "The size of the weights collection must "
+            "match the size of the range");
+    }
+
+    if(std::any_of(weights.begin(), weights.end(), [](double weight) {
+           return weight < 0.0;
+       })) {
+        ErrorChecker::throwInvalidArgument("Weights must not be negative");
+    }
+
+    if(std::none_of(weights.begin(), weights.end(), [](double weight) {
+           return weight > 0.0;
+       })) {
+        ErrorChecker::throwInvalidArgument(
+            "At least one weight must be greater than 0");
+    }
+}
+} // namespace aleatoric
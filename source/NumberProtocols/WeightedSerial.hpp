@@ -0,0 +1,67 @@
+#ifndef WeightedSerial_hpp
+#define WeightedSerial_hpp
+
+#include "IUniformRealGenerator.hpp"
+#include "NumberProtocol.hpp"
+#include "NumberProtocolParameters.hpp"
+#include "Range.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+/*!
+ * @brief A protocol for producing random numbers
+ *
+ * Like Serial, numbers are selected without repetition until every number in
+ * the range has been selected. Unlike Serial, each number is given a weight:
+ * numbers with higher weights tend to be selected earlier in each series.
+ * Numbers with a weight of 0 are never selected.
+ *
+ * __Further Detail__: At the start of each series, the order of the whole
+ * series is determined by giving each number a random key of u^(1 / weight),
+ * where u is drawn uniformly from 0 to 1, and sorting the numbers by key,
+ * highest first (Efraimidis and Spirakis' weighted sampling without
+ * replacement). This costs O(n log n) once per series, after which each
+ * number is read from the series order in constant time.
+ */
+class WeightedSerial : public NumberProtocol {
+  public:
+    WeightedSerial(std::unique_ptr<IUniformRealGenerator> generator);
+
+    /*!
+     * @param generator Should be an instance of UniformRealGenerator. Default
+     * construction is fine.
+     *
+     * @param range The range within which to produce numbers.
+     *
+     * @param weights The weight for each number in the range. Must match the
+     * size of the range, must not be negative and must include at least one
+     * weight above 0.
+     */
+    WeightedSerial(std::unique_ptr<IUniformRealGenerator> generator,
+                   Range range,
+                   std::vector<double> weights);
+
+    ~WeightedSerial();
+
+    int getIntegerNumber() override;
+
+    double getDecimalNumber() override;
+
+    void setParams(NumberProtocolConfig newParams) override;
+
+    NumberProtocolConfig getParams() override;
+
+  private:
+    std::unique_ptr<IUniformRealGenerator> m_generator;
+    Range m_range;
+    std::vector<double> m_weights;
+    std::vector<int> m_seriesOrder;
+    size_t m_seriesPosition;
+    void setSeriesOrder();
+    void checkWeights(const std::vector<double> &weights, const Range &range);
+};
+} // namespace aleatoric
+
+#endif /* WeightedSerial_hpp */
@@ -0,0 +1,87 @@
+#include "ChordProducer.hpp"
+
+#include "ErrorChecker.hpp"
+
+#include <numeric>
+
+namespace aleatoric {
+ChordProducer::ChordProducer(std::unique_ptr<IUniformGenerator> generator,
+                             Range range,
+                             int chordSize)
+: m_generator(std::move(generator)), m_range(range), m_chordSize(chordSize)
+{
+    setRange(range);
+}
+
+ChordProducer::~ChordProducer()
+{}
+
+void ChordProducer::getChord(int *output)
+{
+    auto last = m_range.size - 1;
+    for(int i = 0; i < m_chordSize; i++) {
+        m_generator->setDistribution(i, last);
+        auto selected = m_generator->getNumber();
+        auto number = m_numbers[selected];
+        m_numbers[selected] = m_numbers[i];
+        m_numbers[i] = number;
+        output[i] = number + m_range.offset;
+    }
+}
+
+std::vector<int> ChordProducer::getChord()
+{
+    std::vector<int> chord(m_chordSize);
+    getChord(chord.data());
+    return chord;
+}
+
+void ChordProducer::getChords(int *output, int size)
+{
+    for(int i = 0; i < size; i++) {
+        getChord(output + i * m_chordSize);
+    }
+}
+
+std::vector<std::vector<int>> ChordProducer::getChords(int size)
+{
+    std::vector<std::vector<int>> chords(size, std::vector<int>(m_chordSize));
+    for(auto &&chord : chords) {
+        getChord(chord.data());
+    }
+    return chords;
+}
+
+Range ChordProducer::getRange()
+{
+    return m_range;
+}
+
+void ChordProducer::setRange(Range newRange)
+{
+    checkChordSizeIsValid(m_chordSize, newRange);
+    m_range = newRange;
+    m_numbers.resize(m_range.size);
+    std::iota(m_numbers.begin(), m_numbers.end(), 0);
+}
+
+int ChordProducer::getChordSize()
+{
+    return m_chordSize;
+}
+
+void ChordProducer::setChordSize(int chordSize)
+{
+    checkChordSizeIsValid(chordSize, m_range);
+    m_chordSize = chordSize;
+}
+
+// Private methods
+void ChordProducer::checkChordSizeIsValid(int chordSize, const Range &range)
+{
+    if(chordSize < 1 || chordSize > range.size) {
+        ErrorChecker::throwInvalidArgument(
+            "The chord size must be between 1 and the size of the range");
+    }
+}
+} // namespace aleatoric
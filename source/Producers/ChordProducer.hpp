@@ -0,0 +1,83 @@
+#ifndef ChordProducer_hpp
+#define ChordProducer_hpp
+
+#include "IUniformGenerator.hpp"
+#include "Range.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+/*! @brief Produces chords of distinct numbers from a range
+ *
+ * Each chord is a selection of a fixed number of distinct numbers from the
+ * range, with every such selection equally likely. The numbers of a chord are
+ * in a random order rather than sorted, so they can be assigned to voices or
+ * instruments at random as they are.
+ *
+ * __Further detail__: The numbers of the range are kept in an array, which is
+ * partially shuffled for each chord (a partial Fisher–Yates shuffle): each
+ * number of the chord is swapped into place from the part of the array not yet
+ * used by the chord. The array remains a shuffle of the whole range, so it is
+ * not reset between chords, and each chord costs a random number and a swap
+ * per number in the chord, however large the range. Nothing is rejected and
+ * retried, as it is when distinct numbers are drawn one at a time.
+ */
+class ChordProducer {
+  public:
+    /*!
+     * @param generator Should be an instance of UniformGenerator. Default
+     * construction is fine.
+     *
+     * @param range The range from which to select the numbers of each chord.
+     *
+     * @param chordSize The number of numbers in each chord. Must be between 1
+     * and the size of the range.
+     */
+    ChordProducer(std::unique_ptr<IUniformGenerator> generator,
+                  Range range,
+                  int chordSize);
+
+    ~ChordProducer();
+
+    /*! @brief Writes a chord
+     *
+     * @param output An array with room for the chord size.
+     */
+    void getChord(int *output);
+
+    std::vector<int> getChord();
+
+    /*! @brief Writes size chords, one after another
+     *
+     * @param output An array with room for size times the chord size, which
+     * is filled as a matrix of chords by numbers: the numbers of chord i are
+     * output[i * chordSize] to output[i * chordSize + chordSize - 1].
+     */
+    void getChords(int *output, int size);
+
+    /*! @return size chords, indexed by chord and then by number */
+    std::vector<std::vector<int>> getChords(int size);
+
+    Range getRange();
+
+    /*! @exception std::invalid_argument if the range is smaller than the
+     * chord size */
+    void setRange(Range newRange);
+
+    int getChordSize();
+
+    /*! @exception std::invalid_argument if the chord size is not between 1 and
+     * the size of the range */
+    void setChordSize(int chordSize);
+
+  private:
+    std::unique_ptr<IUniformGenerator> m_generator;
+    Range m_range;
+    int m_chordSize;
+    std::vector<int> m_numbers;
+    void checkChordSizeIsValid(int chordSize, const Range &range);
+};
+} // namespace aleatoric
+
+#endif /* ChordProducer_hpp */
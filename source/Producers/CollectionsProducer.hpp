@@ -5,9 +5,15 @@
 #include "NumberProtocolParameters.hpp"
 
 #include <memory>
-#include <stdexcept>
 #include <vector>
 
+#ifdef ALEATORIC_NO_EXCEPTIONS
+#include <cstdio>
+#include <cstdlib>
+#else
+#include <stdexcept>
+#endif
+
 namespace aleatoric {
 template<typename T>
 class CollectionsProducer {
@@ -27,6 +33,8 @@ class CollectionsProducer {
   private:
     std::vector<T> m_source;
     std::unique_ptr<NumberProtocol> m_protocol;
+    static void checkSourceSizeIsValid(size_t size);
+    [[noreturn]] static void throwInvalidArgument(const char *message);
 };
 
 // NB: When using templates the definitions need to be in the header or
@@ -36,13 +44,8 @@ CollectionsProducer<T>::CollectionsProducer(
     std::vector<T> source, std::unique_ptr<NumberProtocol> protocol)
 : m_source(source), m_protocol(std::move(protocol))
 {
-    try {
-        m_protocol->setParams(Range(0, m_source.size() - 1));
-    } catch(const std::exception &e) {
-        throw std::invalid_argument(
-            "The size of the source collection provided is too small. It must "
-            "be two or greater");
-    }
+    checkSourceSizeIsValid(m_source.size());
+    m_protocol->setParams(Range(0, m_source.size() - 1));
 }
 
 template<typename T>
@@ -52,9 +55,13 @@ CollectionsProducer<T>::~CollectionsProducer()
 template<typename T>
 const T &CollectionsProducer<T>::getItem()
 {
-    // NB: using .at() because it will throw an out_of_range exception if the
-    // number is out of bounds
+    // The protocol's range is set to the source whenever either changes, so
+    // the number is always a valid index
+#ifdef ALEATORIC_UNCHECKED_ACCESS
+    return m_source[m_protocol->getIntegerNumber()];
+#else
     return m_source.at(m_protocol->getIntegerNumber());
+#endif
 }
 
 template<typename T>
@@ -80,7 +87,7 @@ void CollectionsProducer<T>::setParams(NumberProtocolParams newParams)
 {
     if(newParams.getActiveProtocol() !=
        m_protocol->getParams().protocols.getActiveProtocol()) {
-        throw std::invalid_argument(
+        throwInvalidArgument(
             "Active protocol for new params is not consistent with protocol "
             "currently in use");
     }
@@ -101,13 +108,8 @@ template<typename T>
 void CollectionsProducer<T>::setSource(std::vector<T> newSource)
 {
     if(newSource.size() != m_source.size()) {
-        try {
-            m_protocol->setParams(Range(0, newSource.size() - 1));
-        } catch(const std::exception &e) {
-            throw std::invalid_argument(
-                "The size of the source collection provided is too small. It "
-                "must be two or greater");
-        }
+        checkSourceSizeIsValid(newSource.size());
+        m_protocol->setParams(Range(0, newSource.size() - 1));
     }
 
     m_source = newSource;
@@ -119,5 +121,29 @@ std::vector<T> CollectionsProducer<T>::getSource()
     return m_source;
 }
 
+// Private methods
+template<typename T>
+void CollectionsProducer<T>::checkSourceSizeIsValid(size_t size)
+{
+    if(size < 2) {
+        throwInvalidArgument(
+            "The size of the source collection provided is too small. It must "
+            "be two or greater");
+    }
+}
+
+// NB: The library's own error reporting is private to it, so this header
+// repeats it
+template<typename T>
+void CollectionsProducer<T>::throwInvalidArgument(const char *message)
+{
+#ifdef ALEATORIC_NO_EXCEPTIONS
+    std::fprintf(stderr, "aleatoric: invalid argument: %s\n", message);
+    std::abort();
+#else
+    throw std::invalid_argument(message);
+#endif
+}
+
 } // namespace aleatoric
 #endif /* CollectionsProducer_hpp */
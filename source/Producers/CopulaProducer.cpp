@@ -0,0 +1,349 @@
+#include "CopulaProducer.hpp"
+
+#include "ErrorChecker.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <string>
+
+namespace aleatoric {
+namespace {
+// Allows for rounding in correlation matrices that are only positive
+// semi-definite, such as those with a correlation of 1
+const double tolerance = 1e-9;
+
+template<typename T>
+void arrangeByRank(T *numbers,
+                   std::vector<T> &sorted,
+                   const std::vector<int> &order,
+                   int size)
+{
+    sorted.assign(numbers, numbers + size);
+    std::sort(sorted.begin(), sorted.end());
+    for(int rank = 0; rank < size; rank++) {
+        numbers[order[rank]] = sorted[rank];
+    }
+}
+} // namespace
+
+CopulaProducer::CopulaProducer(
+    std::vector<std::unique_ptr<NumberProtocol>> protocols,
+    std::unique_ptr<IGaussianGenerator> generator,
+    std::vector<std::vector<double>> correlations)
+: m_protocols(std::move(protocols)),
+  m_normalGenerator(std::move(generator)),
+  m_copula(Copula::gaussian),
+  m_theta(0.0)
+{
+    checkProtocolsAreValid();
+    m_factor = getFactor(correlations);
+    m_correlations = correlations;
+    m_normalGenerator->setDistribution(0.0, 1.0);
+    m_sample.resize(m_protocols.size());
+}
+
+CopulaProducer::CopulaProducer(
+    std::vector<std::unique_ptr<NumberProtocol>> protocols,
+    std::unique_ptr<IUniformRealGenerator> generator,
+    double theta)
+: m_protocols(std::move(protocols)),
+  m_uniformGenerator(std::move(generator)),
+  m_copula(Copula::clayton)
+{
+    checkProtocolsAreValid();
+    if(!(theta > 0.0)) {
+        ErrorChecker::throwInvalidArgument("Theta must be greater than 0");
+    }
+    m_theta = theta;
+    m_uniformGenerator->setDistribution(0.0, 1.0);
+    m_sample.resize(m_protocols.size());
+}
+
+CopulaProducer::~CopulaProducer()
+{}
+
+int CopulaProducer::getNumberOfDimensions()
+{
+    return static_cast<int>(m_protocols.size());
+}
+
+CopulaProducer::Copula CopulaProducer::getCopula()
+{
+    return m_copula;
+}
+
+void CopulaProducer::getIntegerBlock(int *const *output, int size)
+{
+    drawSample(size);
+
+    std::vector<int> sorted;
+    for(int dimension = 0; dimension < getNumberOfDimensions(); dimension++) {
+        auto numbers = output[dimension];
+        auto &protocol = *m_protocols[dimension];
+        for(int i = 0; i < size; i++) {
+            numbers[i] = protocol.getIntegerNumber();
+        }
+        sortByRank(dimension, size);
+        arrangeByRank(numbers, sorted, m_order, size);
+    }
+}
+
+std::vector<std::vector<int>> CopulaProducer::getIntegerBlock(int size)
+{
+    std::vector<std::vector<int>> block(getNumberOfDimensions(),
+                                        std::vector<int>(size));
+    std::vector<int *> output;
+    for(auto &&numbers : block) {
+        output.push_back(numbers.data());
+    }
+    getIntegerBlock(output.data(), size);
+    return block;
+}
+
+void CopulaProducer::getDecimalBlock(double *const *output, int size)
+{
+    drawSample(size);
+
+    std::vector<double> sorted;
+    for(int dimension = 0; dimension < getNumberOfDimensions(); dimension++) {
+        auto numbers = output[dimension];
+        auto &protocol = *m_protocols[dimension];
+        for(int i = 0; i < size; i++) {
+            numbers[i] = protocol.getDecimalNumber();
+        }
+        sortByRank(dimension, size);
+        arrangeByRank(numbers, sorted, m_order, size);
+    }
+}
+
+std::vector<std::vector<double>> CopulaProducer::getDecimalBlock(int size)
+{
+    std::vector<std::vector<double>> block(getNumberOfDimensions(),
+                                           std::vector<double>(size));
+    std::vector<double *> output;
+    for(auto &&numbers : block) {
+        output.push_back(numbers.data());
+    }
+    getDecimalBlock(output.data(), size);
+    return block;
+}
+
+std::vector<std::vector<double>> CopulaProducer::getCorrelations()
+{
+    if(m_copula != Copula::gaussian) {
+        ErrorChecker::throwInvalidArgument("The copula is not Gaussian");
+    }
+    return m_correlations;
+}
+
+void CopulaProducer::setCorrelations(
+    std::vector<std::vector<double>> correlations)
+{
+    if(m_copula != Copula::gaussian) {
+        ErrorChecker::throwInvalidArgument("The copula is not Gaussian");
+    }
+    m_factor = getFactor(correlations);
+    m_correlations = correlations;
+}
+
+double CopulaProducer::getTheta()
+{
+    if(m_copula != Copula::clayton) {
+        ErrorChecker::throwInvalidArgument("The copula is not Clayton");
+    }
+    return m_theta;
+}
+
+void CopulaProducer::setTheta(double theta)
+{
+    if(m_copula != Copula::clayton) {
+        ErrorChecker::throwInvalidArgument("The copula is not Clayton");
+    }
+    if(!(theta > 0.0)) {
+        ErrorChecker::throwInvalidArgument("Theta must be greater than 0");
+    }
+    m_theta = theta;
+}
+
+NumberProtocolConfig CopulaProducer::getParams(int dimension)
+{
+    checkDimensionIsValid(dimension);
+    return m_protocols[dimension]->getParams();
+}
+
+void CopulaProducer::setParams(int dimension, NumberProtocolConfig newParams)
+{
+    checkDimensionIsValid(dimension);
+
+    if(newParams.protocols.getActiveProtocol() !=
+       m_protocols[dimension]->getParams().protocols.getActiveProtocol()) {
+        ErrorChecker::throwInvalidArgument(
+            "Active protocol for new params is not consistent with protocol "
+            "currently in use");
+    }
+
+    m_protocols[dimension]->setParams(newParams);
+}
+
+// Private methods
+void CopulaProducer::drawSample(int size)
+{
+    for(auto &&column : m_sample) {
+        column.resize(size);
+    }
+
+    if(m_copula == Copula::gaussian) {
+        drawGaussianSample(size);
+    } else {
+        drawClaytonSample(size);
+    }
+}
+
+void CopulaProducer::drawGaussianSample(int size)
+{
+    for(auto &&column : m_sample) {
+        m_normalGenerator->getNumbers(column.data(), size);
+    }
+
+    // Correlates the independent normal numbers by multiplying them by the
+    // lower triangular factor of the correlation matrix. Working from the last
+    // dimension to the first, each dimension only needs the independent
+    // numbers of itself and the dimensions before it, which are still intact.
+    for(int dimension = getNumberOfDimensions() - 1; dimension >= 0;
+        dimension--) {
+        auto &row = m_factor[dimension];
+        auto column = m_sample[dimension].data();
+        auto diagonal = row[dimension];
+        for(int i = 0; i < size; i++) {
+            column[i] *= diagonal;
+        }
+        for(int before = 0; before < dimension; before++) {
+            auto weight = row[before];
+            auto independent = m_sample[before].data();
+            for(int i = 0; i < size; i++) {
+                column[i] += weight * independent[i];
+            }
+        }
+    }
+
+    // Only the ranks of the sample are used, so there is no need to map the
+    // normal numbers to uniform ones
+}
+
+void CopulaProducer::drawClaytonSample(int size)
+{
+    // Each dimension is drawn from its distribution given the dimensions
+    // before it. Writing t for u^-theta - 1, where u is the uniform number of
+    // a dimension, the k-th dimension (counting from 0) is
+    // t = (1 + sum of the t before it) * (w^(-theta / (1 + k theta)) - 1)
+    // for a uniform number w. As t falls when u rises, -t is kept, which has
+    // the same ranks as u.
+    m_sum.assign(size, 1.0);
+    for(int dimension = 0; dimension < getNumberOfDimensions(); dimension++) {
+        auto exponent = -m_theta / (1.0 + dimension * m_theta);
+        auto column = m_sample[dimension].data();
+        for(int i = 0; i < size; i++) {
+            // Within (0, 1], so that the power is finite
+            auto uniform = 1.0 - m_uniformGenerator->getNumber();
+            auto t = m_sum[i] * (std::pow(uniform, exponent) - 1.0);
+            m_sum[i] += t;
+            column[i] = -t;
+        }
+    }
+}
+
+void CopulaProducer::sortByRank(int dimension, int size)
+{
+    m_order.resize(size);
+    std::iota(m_order.begin(), m_order.end(), 0);
+    auto &column = m_sample[dimension];
+    std::sort(m_order.begin(), m_order.end(), [&column](int a, int b) {
+        return column[a] < column[b];
+    });
+}
+
+void CopulaProducer::checkProtocolsAreValid()
+{
+    if(m_protocols.empty()) {
+        ErrorChecker::throwInvalidArgument(
+            "The number of dimensions must be greater than 0");
+    }
+}
+
+void CopulaProducer::checkDimensionIsValid(int dimension)
+{
+    if(dimension < 0 || dimension >= getNumberOfDimensions()) {
+        ErrorChecker::throwInvalidArgument(
+            "The dimension must be between 0 and " +
+            std::to_string(getNumberOfDimensions() - 1));
+    }
+}
+
+std::vector<std::vector<double>> CopulaProducer::getFactor(
+    const std::vector<std::vector<double>> &correlations)
+{
+    auto size = m_protocols.size();
+
+    if(correlations.size() != size) {
+        ErrorChecker::throwInvalidArgument(
+            "The correlation matrix must have a row "
+            "and column for each dimension");
+    }
+
+    for(size_t row = 0; row < size; row++) {
+        if(correlations[row].size() != size) {
+            ErrorChecker::throwInvalidArgument(
+                "The correlation matrix must have a "
+                "row and column for each dimension");
+        }
+        if(correlations[row][row] != 1.0) {
+            ErrorChecker::throwInvalidArgument(
+                "The correlation matrix must have 1 on its diagonal");
+        }
+        for(size_t column = 0; column < row; column++) {
+            auto correlation = correlations[row][column];
+            if(correlation != correlations[column][row]) {
+                ErrorChecker::throwInvalidArgument(
+                    "The correlation matrix must be symmetric");
+            }
+            if(!(correlation >= -1.0 && correlation <= 1.0)) {
+                ErrorChecker::throwInvalidArgument(
+                    "Correlations must be between -1 and 1");
+            }
+        }
+    }
+
+    // Cholesky factorisation. A pivot of 0 means the dimension is fully
+    // determined by those before it, which is only consistent if the rest of
+    // its column is 0 too.
+    std::vector<std::vector<double>> factor(size,
+                                            std::vector<double>(size, 0.0));
+    for(size_t column = 0; column < size; column++) {
+        auto pivot = correlations[column][column];
+        for(size_t k = 0; k < column; k++) {
+            pivot -= factor[column][k] * factor[column][k];
+        }
+        if(pivot < -tolerance) {
+            ErrorChecker::throwInvalidArgument(
+                "The correlation matrix must be positive semi-definite");
+        }
+        auto diagonal = pivot > tolerance ? std::sqrt(pivot) : 0.0;
+        factor[column][column] = diagonal;
+
+        for(size_t row = column + 1; row < size; row++) {
+            auto residual = correlations[row][column];
+            for(size_t k = 0; k < column; k++) {
+                residual -= factor[row][k] * factor[column][k];
+            }
+            if(diagonal > 0.0) {
+                factor[row][column] = residual / diagonal;
+            } else if(std::abs(residual) > tolerance) {
+                ErrorChecker::throwInvalidArgument(
+                    "The correlation matrix must be positive semi-definite");
+            }
+        }
+    }
+    return factor;
+}
+} // namespace aleatoric
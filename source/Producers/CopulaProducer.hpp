@@ -0,0 +1,163 @@
+#ifndef CopulaProducer_hpp
+#define CopulaProducer_hpp
+
+#include "IGaussianGenerator.hpp"
+#include "IUniformRealGenerator.hpp"
+#include "NumberProtocol.hpp"
+#include "NumberProtocolParameters.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+/*! @brief Produces tuples of numbers from several protocols, with the
+ * protocols linked by a copula so that their numbers rise and fall together
+ *
+ * Each dimension of the tuples (e.g. pitch, velocity and duration) has its own
+ * protocol, which decides which numbers occur in that dimension. The copula
+ * decides how the numbers of the dimensions are paired up into tuples. It is
+ * one of:
+ * - gaussian: the dependence between each pair of dimensions is set by a
+ * correlation matrix. A positive correlation pairs high numbers with high
+ * numbers, a negative one pairs high numbers with low numbers, and 0 leaves
+ * the pair independent.
+ * - clayton: every pair of dimensions has the same dependence, set by theta,
+ * and it is strongest at the low end: low numbers are very likely to occur
+ * together, while high numbers are only loosely linked. Kendall's rank
+ * correlation between any two dimensions is theta / (theta + 2).
+ *
+ * Tuples are produced in blocks and written as structure-of-arrays, with the
+ * numbers of each dimension for the whole block held together.
+ *
+ * __Further detail__: For each block, the protocol of every dimension
+ * produces its numbers and a sample of the same size is drawn from the copula.
+ * The numbers of each dimension are then arranged so that their ranks match
+ * the ranks of that dimension of the copula sample: the smallest number goes
+ * where the copula is smallest, and so on. The numbers of each protocol are
+ * therefore exactly those it produced, only reordered, whatever its
+ * distribution. It follows that the order in which a protocol produced its
+ * numbers is not kept within a block, so protocols producing independent
+ * numbers (e.g. Basic or Precision) suit this best, and that a block needs
+ * enough tuples for the dependence to show: a block of one tuple is
+ * independent.
+ *
+ * The correlation matrix is factorised once, when it is set, so a Gaussian
+ * copula sample costs a normal number per dimension and a multiply-add per
+ * pair of dimensions. A Clayton copula sample is drawn by conditional
+ * inversion, which costs a uniform number and a power per dimension.
+ */
+class CopulaProducer {
+  public:
+    enum class Copula { gaussian, clayton };
+
+    /*!
+     * @brief Creates a producer with a Gaussian copula
+     *
+     * @param protocols The protocol for each dimension. Their ranges and
+     * params should be set before they are passed in. Must not be empty.
+     *
+     * @param generator Should be an instance of GaussianGenerator. Default
+     * construction is fine.
+     *
+     * @param correlations A symmetric matrix with a row for each dimension,
+     * holding the correlation between each pair of dimensions. The diagonal
+     * must be 1 and every correlation between -1 and 1. The matrix must also
+     * be positive semi-definite, as every correlation matrix is: correlations
+     * that contradict one another, such as two dimensions each strongly
+     * correlated with a third but negatively correlated with each other, are
+     * rejected.
+     */
+    CopulaProducer(std::vector<std::unique_ptr<NumberProtocol>> protocols,
+                   std::unique_ptr<IGaussianGenerator> generator,
+                   std::vector<std::vector<double>> correlations);
+
+    /*!
+     * @brief Creates a producer with a Clayton copula
+     *
+     * @param protocols The protocol for each dimension. Their ranges and
+     * params should be set before they are passed in. Must not be empty.
+     *
+     * @param generator Should be an instance of UniformRealGenerator. Default
+     * construction is fine.
+     *
+     * @param theta The strength of the dependence. Must be greater than 0.
+     */
+    CopulaProducer(std::vector<std::unique_ptr<NumberProtocol>> protocols,
+                   std::unique_ptr<IUniformRealGenerator> generator,
+                   double theta);
+
+    ~CopulaProducer();
+
+    int getNumberOfDimensions();
+
+    Copula getCopula();
+
+    /*! @brief Writes a block of size tuples of integer numbers
+     *
+     * @param output An array for each dimension, indexed by dimension, each
+     * with room for size numbers. The tuples are output[0][i], output[1][i]
+     * and so on.
+     */
+    void getIntegerBlock(int *const *output, int size);
+
+    /*! @return a block of size tuples of integer numbers, indexed by dimension
+     * and then by tuple */
+    std::vector<std::vector<int>> getIntegerBlock(int size);
+
+    /*! @brief Writes a block of size tuples of decimal numbers
+     *
+     * @param output An array for each dimension, indexed by dimension, each
+     * with room for size numbers. The tuples are output[0][i], output[1][i]
+     * and so on.
+     */
+    void getDecimalBlock(double *const *output, int size);
+
+    /*! @return a block of size tuples of decimal numbers, indexed by dimension
+     * and then by tuple */
+    std::vector<std::vector<double>> getDecimalBlock(int size);
+
+    /*! @exception std::invalid_argument if the copula is not gaussian */
+    std::vector<std::vector<double>> getCorrelations();
+
+    /*! @exception std::invalid_argument if the copula is not gaussian, or the
+     * correlations are invalid (see the constructor) */
+    void setCorrelations(std::vector<std::vector<double>> correlations);
+
+    /*! @exception std::invalid_argument if the copula is not clayton */
+    double getTheta();
+
+    /*! @exception std::invalid_argument if the copula is not clayton, or theta
+     * is not greater than 0 */
+    void setTheta(double theta);
+
+    NumberProtocolConfig getParams(int dimension);
+
+    /*! @brief Sets the params of the protocol of a dimension
+     *
+     * The params must be for the protocol already in use by the dimension.
+     */
+    void setParams(int dimension, NumberProtocolConfig newParams);
+
+  private:
+    std::vector<std::unique_ptr<NumberProtocol>> m_protocols;
+    std::unique_ptr<IGaussianGenerator> m_normalGenerator;
+    std::unique_ptr<IUniformRealGenerator> m_uniformGenerator;
+    Copula m_copula;
+    std::vector<std::vector<double>> m_correlations;
+    std::vector<std::vector<double>> m_factor;
+    double m_theta;
+    std::vector<std::vector<double>> m_sample;
+    std::vector<double> m_sum;
+    std::vector<int> m_order;
+    void drawSample(int size);
+    void drawGaussianSample(int size);
+    void drawClaytonSample(int size);
+    void sortByRank(int dimension, int size);
+    void checkProtocolsAreValid();
+    void checkDimensionIsValid(int dimension);
+    std::vector<std::vector<double>>
+    getFactor(const std::vector<std::vector<double>> &correlations);
+};
+} // namespace aleatoric
+
+#endif /* CopulaProducer_hpp */
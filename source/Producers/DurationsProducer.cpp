@@ -1,6 +1,6 @@
 #include "DurationsProducer.hpp"
 
-#include <stdexcept>
+#include "ErrorChecker.hpp"
 
 namespace aleatoric {
 DurationsProducer::DurationsProducer(
@@ -10,13 +10,8 @@ DurationsProducer::DurationsProducer(
   m_numberProtocol(std::move(numberProtocol))
 {
     m_durationCollectionSize = m_durationProtocol->getCollectionSize();
-    try {
-        m_numberProtocol->setParams(Range(0, m_durationCollectionSize - 1));
-    } catch(const std::invalid_argument &e) {
-        throw std::invalid_argument(
-            "The selectable durations collection size of the provided Duration "
-            "Protocol is too small. It must be two or greater");
-    }
+    checkCollectionSizeIsValid(m_durationCollectionSize);
+    m_numberProtocol->setParams(Range(0, m_durationCollectionSize - 1));
 }
 
 DurationsProducer::~DurationsProducer()
@@ -53,7 +48,7 @@ void DurationsProducer::setParams(NumberProtocolParams newParams)
 {
     if(newParams.getActiveProtocol() !=
        m_numberProtocol->getParams().protocols.getActiveProtocol()) {
-        throw std::invalid_argument(
+        ErrorChecker::throwInvalidArgument(
             "Active protocol for new params is not consistent with protocol "
             "currently in use");
     }
@@ -69,7 +64,7 @@ int DurationsProducer::addListenerForParamsChange(
     std::function<void()> callback)
 {
     if(!callback) {
-        throw std::invalid_argument("Callback must not be empty");
+        ErrorChecker::throwInvalidArgument("Callback must not be empty");
     }
 
     auto id = getNewId();
@@ -97,13 +92,8 @@ void DurationsProducer::setDurationProtocol(
         newCollectionSize != m_durationCollectionSize;
 
     if(hasDifferentCollectionSize) {
-        try {
-            m_numberProtocol->setParams(Range(0, newCollectionSize - 1));
-        } catch(const std::invalid_argument &e) {
-            throw std::invalid_argument(
-                "The selectable durations collection size of the provided "
-                "Duration Protocol is too small. It must be two or greater");
-        }
+        checkCollectionSizeIsValid(newCollectionSize);
+        m_numberProtocol->setParams(Range(0, newCollectionSize - 1));
     }
 
     m_durationProtocol = std::move(durationProtocol);
@@ -130,4 +120,14 @@ int DurationsProducer::getNewId()
     return ++m_listenersIdCounter;
 }
 
+void DurationsProducer::checkCollectionSizeIsValid(int collectionSize)
+{
+    // Checked here, rather than left to the range given to the number
+    // protocol, so that builds without exceptions report it too
+    if(collectionSize < 2) {
+        ErrorChecker::throwInvalidArgument(
+            "The selectable durations collection size of the provided Duration "
+            "Protocol is too small. It must be two or greater");
+    }
+}
 } // namespace aleatoric
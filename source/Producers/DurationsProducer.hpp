@@ -42,6 +42,7 @@ class DurationsProducer {
     int m_listenersIdCounter {0};
     void notifyParamsChangeListeners();
     int getNewId();
+    void checkCollectionSizeIsValid(int collectionSize);
 };
 
 } // namespace aleatoric
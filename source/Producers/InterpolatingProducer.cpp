@@ -0,0 +1,173 @@
+#include "InterpolatingProducer.hpp"
+
+#include "ErrorChecker.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace aleatoric {
+InterpolatingProducer::InterpolatingProducer(
+    std::unique_ptr<NumberProtocol> protocol,
+    int samplesPerStep,
+    Interpolation interpolation)
+: m_protocol(std::move(protocol)),
+  m_samplesPerStep(samplesPerStep),
+  m_pendingSamplesPerStep(samplesPerStep),
+  m_interpolation(interpolation),
+  m_targets {0.0, 0.0, 0.0, 0.0},
+  m_positionInStep(0),
+  m_haveRequestedFirstTarget(false)
+{
+    checkSamplesPerStepIsValid(samplesPerStep);
+    setWeights();
+}
+
+InterpolatingProducer::~InterpolatingProducer()
+{}
+
+void InterpolatingProducer::getBlock(double *output, int numberOfSamples)
+{
+    if(!m_haveRequestedFirstTarget) {
+        // the step before the first has no target, so the first target
+        // stands in for it
+        m_targets[1] = m_protocol->getDecimalNumber();
+        m_targets[0] = m_targets[1];
+        m_targets[2] = m_protocol->getDecimalNumber();
+        m_targets[3] = m_protocol->getDecimalNumber();
+        m_haveRequestedFirstTarget = true;
+    }
+
+    int rendered = 0;
+    while(rendered < numberOfSamples) {
+        if(m_positionInStep == m_samplesPerStep) {
+            advanceStep();
+        }
+
+        auto run = std::min(numberOfSamples - rendered,
+                            m_samplesPerStep - m_positionInStep);
+
+        auto out = output + rendered;
+        auto w0 = m_weights[0].data() + m_positionInStep;
+        auto w1 = m_weights[1].data() + m_positionInStep;
+        auto w2 = m_weights[2].data() + m_positionInStep;
+        auto w3 = m_weights[3].data() + m_positionInStep;
+        auto p0 = m_targets[0];
+        auto p1 = m_targets[1];
+        auto p2 = m_targets[2];
+        auto p3 = m_targets[3];
+
+        for(int i = 0; i < run; i++) {
+            out[i] = w0[i] * p0 + w1[i] * p1 + w2[i] * p2 + w3[i] * p3;
+        }
+
+        rendered += run;
+        m_positionInStep += run;
+    }
+}
+
+std::vector<double> InterpolatingProducer::getBlock(int numberOfSamples)
+{
+    std::vector<double> block(std::max(numberOfSamples, 0));
+    getBlock(block.data(), static_cast<int>(block.size()));
+    return block;
+}
+
+int InterpolatingProducer::getSamplesPerStep()
+{
+    return m_pendingSamplesPerStep;
+}
+
+void InterpolatingProducer::setSamplesPerStep(int samplesPerStep)
+{
+    checkSamplesPerStepIsValid(samplesPerStep);
+    m_pendingSamplesPerStep = samplesPerStep;
+
+    if(!m_haveRequestedFirstTarget) {
+        m_samplesPerStep = samplesPerStep;
+        setWeights();
+    }
+}
+
+InterpolatingProducer::Interpolation InterpolatingProducer::getInterpolation()
+{
+    return m_interpolation;
+}
+
+void InterpolatingProducer::setInterpolation(Interpolation interpolation)
+{
+    m_interpolation = interpolation;
+    setWeights();
+}
+
+NumberProtocolConfig InterpolatingProducer::getParams()
+{
+    return m_protocol->getParams();
+}
+
+void InterpolatingProducer::setParams(NumberProtocolConfig newParams)
+{
+    // Targets already selected are kept, as the protocol's state has moved
+    // on from them
+    m_protocol->setParams(newParams);
+}
+
+// Private methods
+void InterpolatingProducer::setWeights()
+{
+    for(auto &&weights : m_weights) {
+        weights.assign(m_samplesPerStep, 0.0);
+    }
+
+    const double pi = 3.14159265358979323846;
+
+    for(int i = 0; i < m_samplesPerStep; i++) {
+        double t = static_cast<double>(i) / m_samplesPerStep;
+
+        switch(m_interpolation) {
+        case Interpolation::linear:
+            m_weights[1][i] = 1.0 - t;
+            m_weights[2][i] = t;
+            break;
+        case Interpolation::cosine: {
+            auto eased = (1.0 - std::cos(t * pi)) * 0.5;
+            m_weights[1][i] = 1.0 - eased;
+            m_weights[2][i] = eased;
+            break;
+        }
+        case Interpolation::cubic: {
+            // Catmull-Rom basis
+            auto t2 = t * t;
+            auto t3 = t2 * t;
+            m_weights[0][i] = 0.5 * (-t3 + 2.0 * t2 - t);
+            m_weights[1][i] = 0.5 * (3.0 * t3 - 5.0 * t2 + 2.0);
+            m_weights[2][i] = 0.5 * (-3.0 * t3 + 4.0 * t2 + t);
+            m_weights[3][i] = 0.5 * (t3 - t2);
+            break;
+        }
+        }
+    }
+}
+
+void InterpolatingProducer::advanceStep()
+{
+    m_targets[0] = m_targets[1];
+    m_targets[1] = m_targets[2];
+    m_targets[2] = m_targets[3];
+    m_targets[3] = m_protocol->getDecimalNumber();
+    m_positionInStep = 0;
+
+    if(m_pendingSamplesPerStep != m_samplesPerStep) {
+        m_samplesPerStep = m_pendingSamplesPerStep;
+        setWeights();
+    }
+}
+
+void InterpolatingProducer::checkSamplesPerStepIsValid(int samplesPerStep)
+{
+    if(samplesPerStep < 1) {
+        ErrorChecker::throwInvalidArgument(
+            "The number of samples per step must be greater than 0");
+    }
+}
+
+} // namespace aleatoric
@@ -0,0 +1,102 @@
+#ifndef InterpolatingProducer_hpp
+#define InterpolatingProducer_hpp
+
+#include "NumberProtocol.hpp"
+#include "NumberProtocolParameters.hpp"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+/*! @brief Renders blocks of smoothly interpolated samples between the numbers
+ * produced by a protocol
+ *
+ * Intended for driving continuous (e.g. synthesis) parameters at audio rate
+ * from a protocol such as GranularWalk. Each number produced by the protocol
+ * becomes a _target_, and a fixed number of samples is rendered between each
+ * target and the next, so the protocol is only called once per step rather
+ * than once per sample.
+ *
+ * The interpolation between targets is one of:
+ * - linear
+ * - cosine: eases in and out of each target
+ * - cubic: a Catmull-Rom spline through the targets. Note that, unlike the
+ * others, this can overshoot the targets and therefore the protocol's range.
+ *
+ * The weights applied to the targets for each sample position within a step
+ * are calculated once, when the samples per step or interpolation are set, so
+ * rendering is a multiply-add per sample that the compiler is able to
+ * vectorise.
+ */
+class InterpolatingProducer {
+  public:
+    enum class Interpolation { linear, cosine, cubic };
+
+    /*!
+     * @param protocol The protocol that produces the targets. Its decimal
+     * numbers are used.
+     *
+     * @param samplesPerStep The number of samples rendered from one target to
+     * the next. Must be at least 1.
+     *
+     * @param interpolation The interpolation to use between targets.
+     */
+    InterpolatingProducer(std::unique_ptr<NumberProtocol> protocol,
+                          int samplesPerStep,
+                          Interpolation interpolation);
+
+    ~InterpolatingProducer();
+
+    /*! @brief Renders the next numberOfSamples samples into output
+     *
+     * Rendering continues from where the previous block ended, so consecutive
+     * blocks join without discontinuity.
+     */
+    void getBlock(double *output, int numberOfSamples);
+
+    std::vector<double> getBlock(int numberOfSamples);
+
+    int getSamplesPerStep();
+
+    /*! @brief Sets the number of samples per step
+     *
+     * Takes effect from the start of the next step.
+     */
+    void setSamplesPerStep(int samplesPerStep);
+
+    Interpolation getInterpolation();
+
+    void setInterpolation(Interpolation interpolation);
+
+    NumberProtocolConfig getParams();
+
+    /*! @brief Sets the params of the protocol
+     *
+     * Targets already selected are kept: the step currently being rendered
+     * is completed, and the next step moves towards the target selected
+     * after it. The new params apply from the target after that, so targets
+     * follow on from one another as the protocol produced them.
+     */
+    void setParams(NumberProtocolConfig newParams);
+
+  private:
+    std::unique_ptr<NumberProtocol> m_protocol;
+    int m_samplesPerStep;
+    int m_pendingSamplesPerStep;
+    Interpolation m_interpolation;
+    // the weight applied to each of the four targets around the current step,
+    // for each sample position within the step
+    std::array<std::vector<double>, 4> m_weights;
+    // the targets before, at the start of, at the end of and after the
+    // current step
+    std::array<double, 4> m_targets;
+    int m_positionInStep;
+    bool m_haveRequestedFirstTarget;
+    void setWeights();
+    void advanceStep();
+    void checkSamplesPerStepIsValid(int samplesPerStep);
+};
+} // namespace aleatoric
+
+#endif /* InterpolatingProducer_hpp */
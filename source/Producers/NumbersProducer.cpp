@@ -1,9 +1,8 @@
 #include "NumbersProducer.hpp"
 
+#include "ErrorChecker.hpp"
 #include "NumberProtocolParameters.hpp"
 
-#include <stdexcept>
-
 namespace aleatoric {
 NumbersProducer::NumbersProducer(std::unique_ptr<NumberProtocol> protocol)
 : m_protocol(std::move(protocol))
@@ -24,24 +23,12 @@ double NumbersProducer::getDecimalNumber()
 
 std::vector<int> NumbersProducer::getIntegerCollection(int size)
 {
-    std::vector<int> collection(size);
-
-    for(auto &&it : collection) {
-        it = getIntegerNumber();
-    }
-
-    return collection;
+    return m_protocol->getIntegerCollection(size);
 }
 
 std::vector<double> NumbersProducer::getDecimalCollection(int size)
 {
-    std::vector<double> collection(size);
-
-    for(auto &&it : collection) {
-        it = getDecimalNumber();
-    }
-
-    return collection;
+    return m_protocol->getDecimalCollection(size);
 }
 
 NumberProtocolConfig NumbersProducer::getParams()
@@ -53,7 +40,7 @@ void NumbersProducer::setParams(NumberProtocolConfig newParams)
 {
     if(newParams.protocols.getActiveProtocol() !=
        m_protocol->getParams().protocols.getActiveProtocol()) {
-        throw std::invalid_argument(
+        ErrorChecker::throwInvalidArgument(
             "Active protocol for new params is not consistent with protocol "
             "currently in use");
     }
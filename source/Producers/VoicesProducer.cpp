@@ -0,0 +1,293 @@
+#include "VoicesProducer.hpp"
+
+#include "BitOperations.hpp"
+#include "ErrorChecker.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace aleatoric {
+namespace {
+const int wordSize = 64;
+} // namespace
+
+VoicesProducer::VoicesProducer(
+    std::vector<std::unique_ptr<NumberProtocol>> voices,
+    std::unique_ptr<IUniformGenerator> generator,
+    Range range,
+    int minimumDistance)
+: m_voices(std::move(voices)),
+  m_generator(std::move(generator)),
+  m_range(range),
+  m_available((range.size + wordSize - 1) / wordSize),
+  m_numbers(m_voices.size(), range.start)
+{
+    if(m_voices.empty()) {
+        ErrorChecker::throwInvalidArgument(
+            "The number of voices must be greater than 0");
+    }
+
+    checkMinimumDistanceIsValid(minimumDistance);
+    m_minimumDistance = minimumDistance;
+    m_generator->setDistribution(0, 1);
+}
+
+VoicesProducer::~VoicesProducer()
+{}
+
+int VoicesProducer::getNumberOfVoices()
+{
+    return static_cast<int>(m_voices.size());
+}
+
+void VoicesProducer::step()
+{
+    std::fill(m_available.begin(), m_available.end(), ~uint64_t(0));
+    auto lastBit = (m_range.size - 1) % wordSize;
+    m_available.back() &= ~uint64_t(0) >> (wordSize - 1 - lastBit);
+    if(m_minimumDistance > 0) {
+        m_capacity = getCapacity(m_range.size);
+    }
+
+    auto numberOfVoices = getNumberOfVoices();
+    for(int voice = 0; voice < numberOfVoices; voice++) {
+        auto proposal = m_voices[voice]->getIntegerNumber() - m_range.offset;
+        auto position = select(proposal, numberOfVoices - voice - 1);
+        if(m_minimumDistance > 0) {
+            take(position);
+        }
+        m_numbers[voice] = position + m_range.offset;
+    }
+}
+
+const std::vector<int> &VoicesProducer::getIntegerNumbers()
+{
+    return m_numbers;
+}
+
+std::vector<std::vector<int>> VoicesProducer::getIntegerCollection(int size)
+{
+    std::vector<std::vector<int>> collection(size);
+    for(auto &&numbers : collection) {
+        step();
+        numbers = m_numbers;
+    }
+    return collection;
+}
+
+Range VoicesProducer::getRange()
+{
+    return m_range;
+}
+
+int VoicesProducer::getMinimumDistance()
+{
+    return m_minimumDistance;
+}
+
+void VoicesProducer::setMinimumDistance(int minimumDistance)
+{
+    checkMinimumDistanceIsValid(minimumDistance);
+    m_minimumDistance = minimumDistance;
+}
+
+NumberProtocolConfig VoicesProducer::getParams(int voice)
+{
+    checkVoiceIsValid(voice);
+    return m_voices[voice]->getParams();
+}
+
+void VoicesProducer::setParams(int voice, NumberProtocolConfig newParams)
+{
+    checkVoiceIsValid(voice);
+
+    if(newParams.protocols.getActiveProtocol() !=
+       m_voices[voice]->getParams().protocols.getActiveProtocol()) {
+        ErrorChecker::throwInvalidArgument(
+            "Active protocol for new params is not consistent with protocol "
+            "currently in use");
+    }
+
+    m_voices[voice]->setParams(newParams);
+}
+
+// Private methods
+int VoicesProducer::select(int proposal, int remainingVoices)
+{
+    auto position = std::min(std::max(proposal, 0), m_range.size - 1);
+
+    if(m_minimumDistance == 0) {
+        return position;
+    }
+
+    if(isAvailable(position) &&
+       fitsRemainingVoices(position, remainingVoices)) {
+        return position;
+    }
+
+    auto below = findPreviousAvailable(position - 1);
+    while(below >= 0 && !fitsRemainingVoices(below, remainingVoices)) {
+        below = findPreviousAvailable(below - 1);
+    }
+
+    auto above = findNextAvailable(position + 1);
+    while(above < m_range.size &&
+          !fitsRemainingVoices(above, remainingVoices)) {
+        above = findNextAvailable(above + 1);
+    }
+
+    // The capacity kept ensures at least one of them exists
+    if(below < 0) {
+        return above;
+    }
+    if(above >= m_range.size) {
+        return below;
+    }
+
+    auto belowDistance = position - below;
+    auto aboveDistance = above - position;
+    if(belowDistance == aboveDistance) {
+        return m_generator->getNumber() == 0 ? below : above;
+    }
+    return belowDistance < aboveDistance ? below : above;
+}
+
+bool VoicesProducer::fitsRemainingVoices(int position, int remainingVoices)
+{
+    auto start = findPreviousUnavailable(position) + 1;
+    auto end = findNextUnavailable(position) - 1;
+    auto capacity = m_capacity - getCapacity(end - start + 1) +
+                    getCapacity(position - m_minimumDistance - start + 1) +
+                    getCapacity(end - position - m_minimumDistance + 1);
+    return capacity >= remainingVoices;
+}
+
+void VoicesProducer::take(int position)
+{
+    auto start = findPreviousUnavailable(position) + 1;
+    auto end = findNextUnavailable(position) - 1;
+    m_capacity += getCapacity(position - m_minimumDistance - start + 1) +
+                  getCapacity(end - position - m_minimumDistance + 1) -
+                  getCapacity(end - start + 1);
+
+    // Clear the numbers within the minimum distance of the position
+    auto first = std::max(position - m_minimumDistance + 1, start);
+    auto last = std::min(position + m_minimumDistance - 1, end);
+    for(auto word = first / wordSize; word <= last / wordSize; word++) {
+        auto from = std::max(first - word * wordSize, 0);
+        auto to = std::min(last - word * wordSize, wordSize - 1);
+        auto bits = (~uint64_t(0) >> (wordSize - 1 - to)) &
+                    (~uint64_t(0) << from);
+        m_available[word] &= ~bits;
+    }
+}
+
+int VoicesProducer::findPreviousAvailable(int position)
+{
+    if(position < 0) {
+        return -1;
+    }
+
+    auto word = position / wordSize;
+    auto mask = ~uint64_t(0) >> (wordSize - 1 - position % wordSize);
+    auto bits = m_available[word] & mask;
+    while(bits == 0) {
+        if(word == 0) {
+            return -1;
+        }
+        word--;
+        bits = m_available[word];
+    }
+    return word * wordSize + BitOperations::getHighestBit(bits);
+}
+
+int VoicesProducer::findNextAvailable(int position)
+{
+    if(position >= m_range.size) {
+        return m_range.size;
+    }
+
+    auto word = position / wordSize;
+    auto words = static_cast<int>(m_available.size());
+    auto bits = m_available[word] & (~uint64_t(0) << (position % wordSize));
+    while(bits == 0) {
+        word++;
+        if(word == words) {
+            return m_range.size;
+        }
+        bits = m_available[word];
+    }
+    return word * wordSize + BitOperations::countTrailingZeros(bits);
+}
+
+int VoicesProducer::findPreviousUnavailable(int position)
+{
+    auto word = position / wordSize;
+    auto mask = ~uint64_t(0) >> (wordSize - 1 - position % wordSize);
+    auto bits = ~m_available[word] & mask;
+    while(bits == 0) {
+        if(word == 0) {
+            return -1;
+        }
+        word--;
+        bits = ~m_available[word];
+    }
+    return word * wordSize + BitOperations::getHighestBit(bits);
+}
+
+int VoicesProducer::findNextUnavailable(int position)
+{
+    auto word = position / wordSize;
+    auto words = static_cast<int>(m_available.size());
+    auto bits = ~m_available[word] & (~uint64_t(0) << (position % wordSize));
+    while(bits == 0) {
+        word++;
+        if(word == words) {
+            return m_range.size;
+        }
+        bits = ~m_available[word];
+    }
+    // The bits beyond the range are never available
+    return std::min(word * wordSize + BitOperations::countTrailingZeros(bits),
+                    m_range.size);
+}
+
+int VoicesProducer::getCapacity(int length)
+{
+    // The most voices that fit into length consecutive available numbers
+    if(length <= 0) {
+        return 0;
+    }
+    return (length - 1) / m_minimumDistance + 1;
+}
+
+bool VoicesProducer::isAvailable(int position)
+{
+    return (m_available[position / wordSize] >> (position % wordSize)) & 1;
+}
+
+void VoicesProducer::checkVoiceIsValid(int voice)
+{
+    if(voice < 0 || voice >= getNumberOfVoices()) {
+        ErrorChecker::throwInvalidArgument(
+            "The voice must be between 0 and " +
+            std::to_string(getNumberOfVoices() - 1));
+    }
+}
+
+void VoicesProducer::checkMinimumDistanceIsValid(int minimumDistance)
+{
+    if(minimumDistance < 0) {
+        ErrorChecker::throwInvalidArgument(
+            "The minimum distance must be 0 or greater");
+    }
+
+    if(minimumDistance > 0 &&
+       static_cast<long long>(minimumDistance) * (getNumberOfVoices() - 1) >=
+           m_range.size) {
+        ErrorChecker::throwInvalidArgument(
+            "The range is too small for the voices to "
+            "be the minimum distance apart");
+    }
+}
+} // namespace aleatoric
@@ -0,0 +1,115 @@
+#ifndef VoicesProducer_hpp
+#define VoicesProducer_hpp
+
+#include "IUniformGenerator.hpp"
+#include "NumberProtocol.hpp"
+#include "NumberProtocolParameters.hpp"
+#include "Range.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+/*! @brief Produces numbers for several voices at once, keeping the voices a
+ * minimum distance apart
+ *
+ * Each voice has its own protocol, as it would with a NumbersProducer per
+ * voice. At each step every voice selects a number from the shared range, one
+ * voice after another. A voice's protocol proposes a number and it is used if
+ * it is far enough from the numbers already selected by the other voices. If
+ * not, the voice takes the nearest number that is, choosing at random between
+ * two equally near. A minimum distance of 1 makes the voices distinct, and 0
+ * lets them coincide freely.
+ *
+ * __Further detail__: The numbers still available to the voices are held as
+ * a bitmask over the range. A selection clears the numbers within the minimum
+ * distance of it, and the nearest available number to a proposal is found a
+ * word of 64 numbers at a time, so there are no retry loops. The count of
+ * voices that can still be fitted into the available numbers is kept up to
+ * date as they are selected, and a voice never takes a number that would
+ * leave too little room for the voices after it, so every step succeeds.
+ *
+ * Checking that room means finding the run of available numbers around a
+ * candidate, which scans the bitmask a word at a time and so costs up to
+ * n / 64 for a range of n numbers. Usually the proposal or the nearest
+ * available number on either side leaves room, and a step costs about
+ * v * n / 64 for v voices. When the voices nearly fill the range, candidates
+ * are rejected and the next ones tried one at a time, so a step costs v * n *
+ * n / 64 at worst.
+ */
+class VoicesProducer {
+  public:
+    /*!
+     * @param voices The protocol for each voice. Their ranges and params
+     * should be set before they are passed in. Must not be empty.
+     *
+     * @param generator Should be an instance of UniformGenerator. Default
+     * construction is fine. Used to choose between two equally near numbers.
+     *
+     * @param range The range shared by the voices. Numbers proposed outside it
+     * are replaced by the nearest available number within it.
+     *
+     * @param minimumDistance The least distance between the numbers of any two
+     * voices at the same step. Must be 0 or greater, and small enough for
+     * every voice to fit within the range.
+     */
+    VoicesProducer(std::vector<std::unique_ptr<NumberProtocol>> voices,
+                   std::unique_ptr<IUniformGenerator> generator,
+                   Range range,
+                   int minimumDistance);
+
+    ~VoicesProducer();
+
+    int getNumberOfVoices();
+
+    /*! @brief Selects the next number of every voice */
+    void step();
+
+    /*!
+     * @return the number each voice selected at the last step, indexed by
+     * voice.
+     */
+    const std::vector<int> &getIntegerNumbers();
+
+    /*! @brief Steps size times, returning the numbers of every voice for each
+     * step */
+    std::vector<std::vector<int>> getIntegerCollection(int size);
+
+    Range getRange();
+
+    int getMinimumDistance();
+
+    void setMinimumDistance(int minimumDistance);
+
+    NumberProtocolConfig getParams(int voice);
+
+    /*! @brief Sets the params of the protocol of a voice
+     *
+     * The params must be for the protocol already in use by the voice.
+     */
+    void setParams(int voice, NumberProtocolConfig newParams);
+
+  private:
+    std::vector<std::unique_ptr<NumberProtocol>> m_voices;
+    std::unique_ptr<IUniformGenerator> m_generator;
+    Range m_range;
+    int m_minimumDistance;
+    std::vector<uint64_t> m_available;
+    int m_capacity;
+    std::vector<int> m_numbers;
+    int select(int proposal, int remainingVoices);
+    bool fitsRemainingVoices(int position, int remainingVoices);
+    void take(int position);
+    int findPreviousAvailable(int position);
+    int findNextAvailable(int position);
+    int findPreviousUnavailable(int position);
+    int findNextUnavailable(int position);
+    int getCapacity(int length);
+    bool isAvailable(int position);
+    void checkVoiceIsValid(int voice);
+    void checkMinimumDistanceIsValid(int minimumDistance);
+};
+} // namespace aleatoric
+
+#endif /* VoicesProducer_hpp */
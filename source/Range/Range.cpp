@@ -1,13 +1,13 @@
 #include "Range.hpp"
 
-#include <stdexcept>
+#include "ErrorChecker.hpp"
 
 namespace aleatoric {
 
 Range::Range(int rangeStart, int rangeEnd)
 {
     if(rangeEnd <= rangeStart) {
-        throw std::invalid_argument(
+        ErrorChecker::throwInvalidArgument(
             "The supplied range end must be greater than the range start");
     }
 
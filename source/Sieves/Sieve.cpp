@@ -0,0 +1,237 @@
+#include "Sieve.hpp"
+
+#include "BitOperations.hpp"
+#include "ErrorChecker.hpp"
+
+#include <algorithm>
+
+namespace aleatoric {
+namespace {
+const int wordSize = 64;
+} // namespace
+
+Sieve::Sieve(Range range)
+: m_range(range), m_words((range.size + wordSize - 1) / wordSize, 0)
+{}
+
+Sieve::Sieve(Range range, int modulus, int residue)
+: m_range(range), m_words((range.size + wordSize - 1) / wordSize, 0)
+{
+    if(modulus < 1) {
+        ErrorChecker::throwInvalidArgument("The modulus must be 1 or greater");
+    }
+
+    // The position in the range of the first member
+    auto first = ((residue - range.start) % modulus + modulus) % modulus;
+
+    // A class with a small modulus repeats every modulus words, so only those
+    // words are built bit by bit
+    auto words = static_cast<int>(m_words.size());
+    auto wordsToBuild = modulus < wordSize ? std::min(modulus, words) : words;
+    auto positionsToBuild =
+        std::min(static_cast<int64_t>(wordsToBuild) * wordSize,
+                 static_cast<int64_t>(range.size));
+
+    for(int64_t position = first; position < positionsToBuild;
+        position += modulus) {
+        m_words[position / wordSize] |= uint64_t(1) << (position % wordSize);
+    }
+
+    for(int i = wordsToBuild; i < words; i++) {
+        m_words[i] = m_words[i - modulus];
+    }
+
+    clearUnusedBits();
+}
+
+Range Sieve::getRange() const
+{
+    return m_range;
+}
+
+int Sieve::getSize() const
+{
+    buildIndex();
+    return m_ranks.back();
+}
+
+bool Sieve::contains(int number) const
+{
+    if(!m_range.numberIsInRange(number)) {
+        return false;
+    }
+
+    auto position = number - m_range.start;
+    return (m_words[position / wordSize] >> (position % wordSize)) & 1;
+}
+
+int Sieve::getRank(int number) const
+{
+    if(number <= m_range.start) {
+        return 0;
+    }
+    if(number > m_range.end) {
+        return getSize();
+    }
+
+    buildIndex();
+
+    auto position = number - m_range.start;
+    auto word = position / wordSize;
+    auto bitsBelow = (uint64_t(1) << (position % wordSize)) - 1;
+    return m_ranks[word] + BitOperations::countBits(m_words[word] & bitsBelow);
+}
+
+int Sieve::getNumber(int index) const
+{
+#ifndef ALEATORIC_UNCHECKED_ACCESS
+    if(index < 0 || index >= getSize()) {
+        ErrorChecker::throwOutOfRange(
+            "The index must be less than the sieve size");
+    }
+#endif
+
+    // The samples bound the words that can hold the member; the ranks then
+    // find the word, and the bits of the word the member
+    auto sample = index / wordSize;
+    auto searchStart = m_ranks.begin() + m_selectSamples[sample];
+    auto searchEnd = sample + 1 < static_cast<int>(m_selectSamples.size())
+                         ? m_ranks.begin() + m_selectSamples[sample + 1] + 1
+                         : m_ranks.end() - 1;
+    auto word = static_cast<int>(
+        std::upper_bound(searchStart, searchEnd, index) - m_ranks.begin() - 1);
+
+    auto bits = m_words[word];
+    for(int i = m_ranks[word]; i < index; i++) {
+        bits &= bits - 1;
+    }
+
+    return m_range.start + word * wordSize +
+           BitOperations::countTrailingZeros(bits);
+}
+
+std::vector<int> Sieve::getNumbers() const
+{
+    std::vector<int> numbers;
+    numbers.reserve(getSize());
+
+    for(size_t i = 0; i < m_words.size(); i++) {
+        auto bits = m_words[i];
+        while(bits != 0) {
+            numbers.push_back(m_range.start + static_cast<int>(i) * wordSize +
+                              BitOperations::countTrailingZeros(bits));
+            bits &= bits - 1;
+        }
+    }
+
+    return numbers;
+}
+
+Sieve Sieve::getUnion(const Sieve &other) const &
+{
+    checkRangeMatches(other);
+
+    Sieve result(m_range);
+    for(size_t i = 0; i < m_words.size(); i++) {
+        result.m_words[i] = m_words[i] | other.m_words[i];
+    }
+
+    return result;
+}
+
+Sieve Sieve::getUnion(const Sieve &other) &&
+{
+    checkRangeMatches(other);
+
+    for(size_t i = 0; i < m_words.size(); i++) {
+        m_words[i] |= other.m_words[i];
+    }
+    m_ranks.clear();
+
+    return std::move(*this);
+}
+
+Sieve Sieve::getIntersection(const Sieve &other) const &
+{
+    checkRangeMatches(other);
+
+    Sieve result(m_range);
+    for(size_t i = 0; i < m_words.size(); i++) {
+        result.m_words[i] = m_words[i] & other.m_words[i];
+    }
+
+    return result;
+}
+
+Sieve Sieve::getIntersection(const Sieve &other) &&
+{
+    checkRangeMatches(other);
+
+    for(size_t i = 0; i < m_words.size(); i++) {
+        m_words[i] &= other.m_words[i];
+    }
+    m_ranks.clear();
+
+    return std::move(*this);
+}
+
+Sieve Sieve::getComplement() const &
+{
+    Sieve result(m_range);
+    for(size_t i = 0; i < m_words.size(); i++) {
+        result.m_words[i] = ~m_words[i];
+    }
+    result.clearUnusedBits();
+
+    return result;
+}
+
+Sieve Sieve::getComplement() &&
+{
+    for(auto &&word : m_words) {
+        word = ~word;
+    }
+    clearUnusedBits();
+    m_ranks.clear();
+
+    return std::move(*this);
+}
+
+// Private methods
+void Sieve::clearUnusedBits()
+{
+    auto usedBits = m_range.size % wordSize;
+    if(usedBits != 0) {
+        m_words.back() &= (uint64_t(1) << usedBits) - 1;
+    }
+}
+
+void Sieve::buildIndex() const
+{
+    if(!m_ranks.empty()) {
+        return;
+    }
+
+    m_ranks.resize(m_words.size() + 1);
+    m_selectSamples.clear();
+
+    int total = 0;
+    for(size_t i = 0; i < m_words.size(); i++) {
+        m_ranks[i] = total;
+        total += BitOperations::countBits(m_words[i]);
+
+        while(static_cast<int>(m_selectSamples.size()) * wordSize < total) {
+            m_selectSamples.push_back(static_cast<int>(i));
+        }
+    }
+    m_ranks.back() = total;
+}
+
+void Sieve::checkRangeMatches(const Sieve &other) const
+{
+    if(other.m_range.start != m_range.start ||
+       other.m_range.end != m_range.end) {
+        ErrorChecker::throwInvalidArgument("Sieves must share the same range");
+    }
+}
+} // namespace aleatoric
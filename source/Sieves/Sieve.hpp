@@ -0,0 +1,112 @@
+#ifndef Sieve_hpp
+#define Sieve_hpp
+
+#include "Range.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace aleatoric {
+/*!
+ * @brief A set of numbers within a range, built as a Xenakis sieve
+ *
+ * A sieve starts from residue classes - every number n for which n modulo a
+ * modulus equals a residue - which are then combined with union, intersection
+ * and complement to produce pitch or time structures. For example, the sieve
+ * written by Xenakis as (3, 2) ∪ ((4, 1) ∩ ¬(5, 0)) is:
+ *
+ * @code
+ * auto sieve = Sieve(range, 3, 2).getUnion(
+ *     Sieve(range, 4, 1).getIntersection(Sieve(range, 5, 0).getComplement()));
+ * @endcode
+ *
+ * The members can be passed to a CollectionsProducer with getNumbers(), or a
+ * sieve can be used as a source of durations through the Sieved duration
+ * protocol.
+ *
+ * __Further detail__: A sieve holds one bit per number in the range, packed
+ * into 64-bit words, so the set operations work on 64 numbers at a time. A
+ * residue class with a modulus below 64 repeats every modulus words and is
+ * built by copying words. The first time a sieve is queried it counts the
+ * members before each word, so that getRank() takes constant time, and notes
+ * the word holding every 64th member, which narrows getNumber() to a short
+ * search. Sieves that are only combined into others are never counted, and
+ * temporary sieves in an expression like the one above are combined in place.
+ */
+class Sieve {
+  public:
+    /*!
+     * @brief Creates an empty sieve over the range
+     */
+    Sieve(Range range);
+
+    /*!
+     * @brief Creates a sieve of the residue class: the numbers in the range
+     * which, modulo the modulus, equal the residue modulo the modulus.
+     *
+     * @param modulus Must be 1 or greater.
+     */
+    Sieve(Range range, int modulus, int residue);
+
+    Range getRange() const;
+
+    /*!
+     * @return the number of members
+     */
+    int getSize() const;
+
+    /*!
+     * @return whether the number is a member. Numbers outside the range are
+     * never members.
+     */
+    bool contains(int number) const;
+
+    /*!
+     * @return the number of members less than the number given
+     */
+    int getRank(int number) const;
+
+    /*!
+     * @return the member at the index given, counting from the lowest member.
+     * Throws std::out_of_range if the index is not less than getSize(), unless
+     * built with ALEATORIC_UNCHECKED_ACCESS, when the index is not checked.
+     */
+    int getNumber(int index) const;
+
+    /*!
+     * @return all members, lowest first
+     */
+    std::vector<int> getNumbers() const;
+
+    /*!
+     * @brief The numbers that are members of either sieve. Both sieves must
+     * have the same range.
+     */
+    Sieve getUnion(const Sieve &other) const &;
+    Sieve getUnion(const Sieve &other) &&;
+
+    /*!
+     * @brief The numbers that are members of both sieves. Both sieves must
+     * have the same range.
+     */
+    Sieve getIntersection(const Sieve &other) const &;
+    Sieve getIntersection(const Sieve &other) &&;
+
+    /*!
+     * @brief The numbers in the range that are not members of this sieve.
+     */
+    Sieve getComplement() const &;
+    Sieve getComplement() &&;
+
+  private:
+    Range m_range;
+    std::vector<uint64_t> m_words;
+    mutable std::vector<int> m_ranks;
+    mutable std::vector<int> m_selectSamples;
+    void clearUnusedBits();
+    void buildIndex() const;
+    void checkRangeMatches(const Sieve &other) const;
+};
+} // namespace aleatoric
+
+#endif /* Sieve_hpp */
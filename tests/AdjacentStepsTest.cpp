@@ -1,7 +1,7 @@
 #include "AdjacentSteps.hpp"
 
-#include "DiscreteGenerator.hpp"
-#include "DiscreteGeneratorMock.hpp"
+#include "UniformGenerator.hpp"
+#include "UniformGeneratorMock.hpp"
 
 #include <catch2/catch.hpp>
 #include <catch2/trompeloeil.hpp>
@@ -12,7 +12,7 @@ SCENARIO("Numbers::AdjacentSteps: default construction")
 {
     using namespace aleatoric;
 
-    AdjacentSteps instance(std::make_unique<DiscreteGenerator>());
+    AdjacentSteps instance(std::make_unique<UniformGenerator>());
 
     THEN("Params are set to defaults")
     {
@@ -44,17 +44,17 @@ SCENARIO("Numbers::AdjacentSteps: constructed with params")
 
     GIVEN("Construction")
     {
-        auto generator = std::make_unique<DiscreteGeneratorMock>();
+        auto generator = std::make_unique<UniformGeneratorMock>();
         auto generatorPointer = generator.get();
 
         Range range(1, 3);
 
         WHEN("The object is constructed")
         {
-            THEN("The generator distribution is set to the range size")
+            THEN("The generator distribution is set to the range")
             {
                 REQUIRE_CALL(*generatorPointer,
-                             setDistributionVector(range.size, 1.0));
+                             setDistribution(range.start, range.end));
                 AdjacentSteps(std::move(generator), range);
             }
         }
@@ -62,99 +62,69 @@ SCENARIO("Numbers::AdjacentSteps: constructed with params")
 
     GIVEN("The object is constructed")
     {
-        auto generator = std::make_unique<DiscreteGeneratorMock>();
+        auto generator = std::make_unique<UniformGeneratorMock>();
         auto generatorPointer = generator.get();
-        ALLOW_CALL(*generatorPointer, updateDistributionVector(ANY(double)));
-        ALLOW_CALL(*generatorPointer, updateDistributionVector(ANY(int), 1.0));
-        ALLOW_CALL(*generatorPointer, setDistributionVector(ANY(int), 1.0));
+        ALLOW_CALL(*generatorPointer, setDistribution(ANY(int), ANY(int)));
 
-        Range range(1, 3);
+        Range range(1, 5);
 
-        int generatedNumber = 1;
         AdjacentSteps instance(std::move(generator), range);
 
-        WHEN("A number is requested")
+        WHEN("The first number is requested")
         {
-            THEN("It returns a generated number with the range offset added")
+            THEN("It returns the generated number")
             {
-                REQUIRE_CALL(*generatorPointer, getNumber())
-                    .RETURN(generatedNumber);
-                auto returnedNumber = instance.getIntegerNumber();
-                REQUIRE(returnedNumber == generatedNumber + range.offset);
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(3);
+                REQUIRE(instance.getIntegerNumber() == 3);
             }
 
-            AND_WHEN("The returned number is mid range")
+            THEN("The generator is set to flip a coin for the next step")
             {
-                auto midRangeGeneratedNumber = 2 - range.offset;
-                auto stepUp = midRangeGeneratedNumber + 1;
-                auto stepDown = midRangeGeneratedNumber - 1;
-
-                THEN("A stepwise distribution is set such that a step can be "
-                     "taken either up or down")
-                {
-                    REQUIRE_CALL(*generatorPointer, getNumber())
-                        .RETURN(midRangeGeneratedNumber);
-                    REQUIRE_CALL(*generatorPointer,
-                                 updateDistributionVector(0.0));
-                    REQUIRE_CALL(*generatorPointer,
-                                 updateDistributionVector(stepUp, 1.0));
-                    REQUIRE_CALL(*generatorPointer,
-                                 updateDistributionVector(stepDown, 1.0));
-                    FORBID_CALL(
-                        *generatorPointer,
-                        updateDistributionVector(midRangeGeneratedNumber, 1.0));
-                    instance.getIntegerNumber();
-                }
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(3);
+                REQUIRE_CALL(*generatorPointer, setDistribution(0, 1));
+                instance.getIntegerNumber();
             }
+        }
 
-            AND_WHEN("The returned number is the bottom (start) of the range")
+        WHEN("The last number is mid range")
+        {
+            REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(3);
+            instance.getIntegerNumber();
+
+            THEN("A coin flip of 0 steps down")
             {
-                auto startOfRangeGeneratedNumber = range.start - range.offset;
-                auto stepUp = startOfRangeGeneratedNumber + 1;
-                auto stepDown = startOfRangeGeneratedNumber - 1;
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(0);
+                REQUIRE(instance.getIntegerNumber() == 2);
+            }
 
-                THEN("A stepwise distribution is set such that a step can "
-                     "only be taken upwards")
-                {
-                    REQUIRE_CALL(*generatorPointer, getNumber())
-                        .RETURN(startOfRangeGeneratedNumber);
-                    REQUIRE_CALL(*generatorPointer,
-                                 updateDistributionVector(0.0));
-                    REQUIRE_CALL(*generatorPointer,
-                                 updateDistributionVector(stepUp, 1.0));
-                    FORBID_CALL(*generatorPointer,
-                                updateDistributionVector(stepDown, 1.0));
-                    FORBID_CALL(
-                        *generatorPointer,
-                        updateDistributionVector(startOfRangeGeneratedNumber,
-                                                 1.0));
-                    instance.getIntegerNumber();
-                }
+            THEN("A coin flip of 1 steps up")
+            {
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(1);
+                REQUIRE(instance.getIntegerNumber() == 4);
             }
+        }
+
+        WHEN("The last number is the bottom (start) of the range")
+        {
+            REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(range.start);
+            instance.getIntegerNumber();
 
-            AND_WHEN("The returned number is the top (end) of the range")
+            THEN("A step can only be taken upwards and no coin is flipped")
             {
-                auto endOfRangeGeneratedNumber = range.end - range.offset;
-                auto stepUp = endOfRangeGeneratedNumber + 1;
-                auto stepDown = endOfRangeGeneratedNumber - 1;
+                FORBID_CALL(*generatorPointer, getNumber());
+                REQUIRE(instance.getIntegerNumber() == range.start + 1);
+            }
+        }
 
-                THEN("A stepwise distribution is set such that a step can "
-                     "only be taken downwards")
-                {
-                    REQUIRE_CALL(*generatorPointer, getNumber())
-                        .RETURN(endOfRangeGeneratedNumber);
-                    REQUIRE_CALL(*generatorPointer,
-                                 updateDistributionVector(0.0));
-                    FORBID_CALL(*generatorPointer,
-                                updateDistributionVector(stepUp, 1.0));
-                    REQUIRE_CALL(*generatorPointer,
-                                 updateDistributionVector(stepDown, 1.0));
-                    FORBID_CALL(
-                        *generatorPointer,
-                        updateDistributionVector(endOfRangeGeneratedNumber,
-                                                 1.0));
-                    instance.getIntegerNumber();
-                }
+        WHEN("The last number is the top (end) of the range")
+        {
+            REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(range.end);
+            instance.getIntegerNumber();
+
+            THEN("A step can only be taken downwards and no coin is flipped")
+            {
+                FORBID_CALL(*generatorPointer, getNumber());
+                REQUIRE(instance.getIntegerNumber() == range.end - 1);
             }
         }
     }
@@ -165,9 +135,7 @@ SCENARIO("Numbers::AdjacentSteps: params")
     using namespace aleatoric;
 
     Range range(1, 3);
-    auto generator = std::make_unique<DiscreteGenerator>();
-    auto generatorPointer = generator.get();
-    AdjacentSteps instance(std::move(generator), range);
+    AdjacentSteps instance(std::make_unique<UniformGenerator>(), range);
 
     WHEN("Get params")
     {
@@ -209,11 +177,10 @@ SCENARIO("Numbers::AdjacentSteps: params")
                 NumberProtocolParams(AdjacentStepsParams()));
             instance.setParams(newParams);
 
-            THEN("Generator distribution has equal probability for whole range")
+            THEN("The next number is selected from the whole new range")
             {
-                std::vector<double> expectedDistribution {1, 1, 1, 1};
-                REQUIRE(generatorPointer->getDistributionVector() ==
-                        expectedDistribution);
+                auto nextNumber = instance.getIntegerNumber();
+                REQUIRE(newRange.numberIsInRange(nextNumber));
             }
         }
 
@@ -229,11 +196,10 @@ SCENARIO("Numbers::AdjacentSteps: params")
                     NumberProtocolParams(AdjacentStepsParams()));
                 instance.setParams(newParams);
 
-                THEN("Generator dist has equal prob for whole range")
+                THEN("The next number is selected from the whole new range")
                 {
-                    std::vector<double> expectedDistribution {1, 1, 1, 1, 1};
-                    REQUIRE(generatorPointer->getDistributionVector() ==
-                            expectedDistribution);
+                    auto nextNumber = instance.getIntegerNumber();
+                    REQUIRE(newRange.numberIsInRange(nextNumber));
                 }
             }
 
@@ -247,9 +213,9 @@ SCENARIO("Numbers::AdjacentSteps: params")
 
                 THEN("Only numbers either side of it are selectable")
                 {
-                    std::vector<double> expectedDist {0, 1, 0, 1, 0};
-                    REQUIRE(generatorPointer->getDistributionVector() ==
-                            expectedDist);
+                    auto nextNumber = instance.getIntegerNumber();
+                    REQUIRE((nextNumber == lastNumber - 1 ||
+                             nextNumber == lastNumber + 1));
                 }
             }
 
@@ -263,9 +229,7 @@ SCENARIO("Numbers::AdjacentSteps: params")
 
                 THEN("Only the number above is selectable")
                 {
-                    std::vector<double> expectedDist {0, 1, 0, 0, 0};
-                    REQUIRE(generatorPointer->getDistributionVector() ==
-                            expectedDist);
+                    REQUIRE(instance.getIntegerNumber() == lastNumber + 1);
                 }
             }
 
@@ -279,9 +243,7 @@ SCENARIO("Numbers::AdjacentSteps: params")
 
                 THEN("Only the number below is selectable")
                 {
-                    std::vector<double> expectedDist {0, 0, 0, 1, 0};
-                    REQUIRE(generatorPointer->getDistributionVector() ==
-                            expectedDist);
+                    REQUIRE(instance.getIntegerNumber() == lastNumber - 1);
                 }
             }
         }
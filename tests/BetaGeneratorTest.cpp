@@ -0,0 +1,95 @@
+#include "BetaGenerator.hpp"
+
+#include <catch2/catch.hpp>
+
+SCENARIO("BetaGenerator")
+{
+    using namespace aleatoric;
+
+    auto checkNumbers = [](const std::vector<double> &numbers,
+                           double expectedMean,
+                           double expectedVariance) {
+        double sum = 0.0;
+        double sumOfSquares = 0.0;
+        bool allInUnitInterval = true;
+        for(auto number : numbers) {
+            sum += number;
+            sumOfSquares += number * number;
+            allInUnitInterval &= number >= 0.0 && number <= 1.0;
+        }
+
+        auto mean = sum / numbers.size();
+        REQUIRE(allInUnitInterval);
+        REQUIRE(mean == Approx(expectedMean).margin(0.005));
+        REQUIRE(sumOfSquares / numbers.size() - mean * mean ==
+                Approx(expectedVariance).margin(0.002));
+    };
+
+    GIVEN("Default construction")
+    {
+        BetaGenerator instance;
+
+        THEN("Returned distribution is alpha and beta of 1")
+        {
+            auto distribution = instance.getDistribution();
+            REQUIRE(distribution.first == 1.0);
+            REQUIRE(distribution.second == 1.0);
+        }
+
+        THEN("Numbers are uniform over 0 to 1")
+        {
+            checkNumbers(instance.getNumbers(100000), 0.5, 1.0 / 12.0);
+        }
+
+        THEN("Shape parameters that are not positive throw")
+        {
+            REQUIRE_THROWS_WITH(
+                instance.setDistribution(0.0, 1.0),
+                "The alpha and beta values must be greater than 0");
+            REQUIRE_THROWS_AS(instance.setDistribution(1.0, -1.0),
+                              std::invalid_argument);
+        }
+    }
+
+    GIVEN("Shape parameters greater than 1")
+    {
+        BetaGenerator instance(2.0, 5.0);
+
+        THEN("The mean and variance match the distribution")
+        {
+            checkNumbers(instance.getNumbers(100000), 2.0 / 7.0, 10.0 / 392.0);
+        }
+    }
+
+    GIVEN("Shape parameters less than 1")
+    {
+        BetaGenerator instance(0.5, 0.5);
+
+        THEN("The mean and variance match the distribution")
+        {
+            checkNumbers(instance.getNumbers(100000), 0.5, 0.125);
+        }
+    }
+
+    GIVEN("Tiny shape parameters, whose gamma numbers underflow")
+    {
+        BetaGenerator instance(0.001, 0.001);
+
+        THEN("Numbers gather at 0 and 1 and are never NaN")
+        {
+            checkNumbers(instance.getNumbers(100000),
+                         0.5,
+                         0.001 * 0.001 / (0.002 * 0.002 * 1.002));
+        }
+
+        THEN("Even smaller shapes stay within 0 to 1")
+        {
+            instance.setDistribution(1.0e-8, 1.0e-6);
+            bool allInUnitInterval = true;
+            for(auto number : instance.getNumbers(10000)) {
+                allInUnitInterval &= number >= 0.0 && number <= 1.0;
+            }
+            REQUIRE(allInUnitInterval);
+        }
+    }
+}
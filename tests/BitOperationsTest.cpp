@@ -0,0 +1,71 @@
+#include "BitOperations.hpp"
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+
+SCENARIO("BitOperations")
+{
+    using namespace aleatoric;
+
+    GIVEN("32-bit words")
+    {
+        THEN("Set bits are counted")
+        {
+            REQUIRE(BitOperations::countBits(uint32_t(0)) == 0);
+            REQUIRE(BitOperations::countBits(uint32_t(1)) == 1);
+            REQUIRE(BitOperations::countBits(uint32_t(0xf0f0)) == 8);
+            REQUIRE(BitOperations::countBits(~uint32_t(0)) == 32);
+        }
+
+        THEN("Trailing zeros are counted, and an empty word has as many as "
+             "its size")
+        {
+            REQUIRE(BitOperations::countTrailingZeros(uint32_t(1)) == 0);
+            REQUIRE(BitOperations::countTrailingZeros(uint32_t(0xf0f0)) == 4);
+            REQUIRE(BitOperations::countTrailingZeros(uint32_t(1) << 31) ==
+                    31);
+            REQUIRE(BitOperations::countTrailingZeros(uint32_t(0)) == 32);
+        }
+    }
+
+    GIVEN("64-bit words")
+    {
+        THEN("Set bits are counted")
+        {
+            REQUIRE(BitOperations::countBits(uint64_t(0)) == 0);
+            REQUIRE(BitOperations::countBits(uint64_t(0xff) << 40) == 8);
+            REQUIRE(BitOperations::countBits(~uint64_t(0)) == 64);
+        }
+
+        THEN("Trailing zeros are counted, and an empty word has as many as "
+             "its size")
+        {
+            REQUIRE(BitOperations::countTrailingZeros(uint64_t(1)) == 0);
+            REQUIRE(BitOperations::countTrailingZeros(uint64_t(0xff) << 40) ==
+                    40);
+            REQUIRE(BitOperations::countTrailingZeros(uint64_t(1) << 63) ==
+                    63);
+            REQUIRE(BitOperations::countTrailingZeros(uint64_t(0)) == 64);
+        }
+
+        THEN("The highest set bit is found, or -1 if there is none")
+        {
+            REQUIRE(BitOperations::getHighestBit(uint64_t(1)) == 0);
+            REQUIRE(BitOperations::getHighestBit(uint64_t(0xff) << 40) == 47);
+            REQUIRE(BitOperations::getHighestBit(~uint64_t(0)) == 63);
+            REQUIRE(BitOperations::getHighestBit(uint64_t(0)) == -1);
+        }
+
+        THEN("Each single bit is found by every operation")
+        {
+            bool found = true;
+            for(int bit = 0; bit < 64; bit++) {
+                auto word = uint64_t(1) << bit;
+                found &= BitOperations::countBits(word) == 1;
+                found &= BitOperations::countTrailingZeros(word) == bit;
+                found &= BitOperations::getHighestBit(word) == bit;
+            }
+            REQUIRE(found);
+        }
+    }
+}
@@ -0,0 +1,45 @@
+#include "CauchyGenerator.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+
+SCENARIO("CauchyGenerator")
+{
+    using namespace aleatoric;
+
+    GIVEN("Default construction")
+    {
+        CauchyGenerator instance;
+
+        THEN("Returned distribution is a location of 0 and scale of 1")
+        {
+            auto distribution = instance.getDistribution();
+            REQUIRE(distribution.first == 0.0);
+            REQUIRE(distribution.second == 1.0);
+        }
+
+        THEN("A scale that is not positive throws")
+        {
+            REQUIRE_THROWS_WITH(instance.setDistribution(0.0, 0.0),
+                                "The scale must be greater than 0");
+        }
+    }
+
+    GIVEN("Construction with a location and scale")
+    {
+        CauchyGenerator instance(10.0, 2.0);
+
+        THEN("The median and quartiles match the distribution")
+        {
+            // The Cauchy distribution has no mean, but its quartiles are the
+            // location plus and minus the scale
+            auto numbers = instance.getNumbers(100000);
+            std::sort(numbers.begin(), numbers.end());
+
+            REQUIRE(numbers[25000] == Approx(8.0).margin(0.1));
+            REQUIRE(numbers[50000] == Approx(10.0).margin(0.05));
+            REQUIRE(numbers[75000] == Approx(12.0).margin(0.1));
+        }
+    }
+}
@@ -0,0 +1,304 @@
+#include "CellularAutomaton.hpp"
+
+#include "Range.hpp"
+
+#include <catch2/catch.hpp>
+
+namespace {
+// Cell by cell reference implementation of a wrapping elementary automaton
+std::vector<bool> getNextRow(const std::vector<bool> &row, int rule)
+{
+    auto size = static_cast<int>(row.size());
+    std::vector<bool> next(size);
+    for(int i = 0; i < size; i++) {
+        auto pattern = row[(i + size - 1) % size] * 4 + row[i] * 2 +
+                       row[(i + 1) % size];
+        next[i] = (rule >> pattern) & 1;
+    }
+    return next;
+}
+
+std::vector<int> getLiveNumbers(const std::vector<bool> &row, int offset)
+{
+    std::vector<int> numbers;
+    for(int i = 0; i < static_cast<int>(row.size()); i++) {
+        if(row[i]) {
+            numbers.push_back(i + offset);
+        }
+    }
+    return numbers;
+}
+} // namespace
+
+SCENARIO("Numbers::CellularAutomaton: default constructor")
+{
+    using namespace aleatoric;
+
+    CellularAutomaton instance;
+
+    THEN("Params are set to defaults")
+    {
+        auto params = instance.getParams();
+        REQUIRE(params.getRange().start == 0);
+        REQUIRE(params.getRange().end == 1);
+        auto automaton = params.protocols.getCellularAutomaton();
+        REQUIRE(automaton.getRule() == 30);
+        REQUIRE(automaton.getOutput() ==
+                CellularAutomatonParams::Output::population);
+        REQUIRE(automaton.getLiveCellIndex() == 0);
+        REQUIRE(automaton.getInitialCells().empty());
+    }
+}
+
+SCENARIO("Numbers::CellularAutomaton")
+{
+    using namespace aleatoric;
+
+    GIVEN("Construction: with invalid params")
+    {
+        THEN("Throws")
+        {
+            REQUIRE_THROWS_WITH(
+                CellularAutomaton(Range(1, 10),
+                                  256,
+                                  CellularAutomatonParams::Output::row),
+                "The rule must be between 0 and 255");
+            REQUIRE_THROWS_WITH(
+                CellularAutomaton(Range(1, 10),
+                                  -1,
+                                  CellularAutomatonParams::Output::row),
+                "The rule must be between 0 and 255");
+            REQUIRE_THROWS_WITH(
+                CellularAutomaton(Range(1, 10),
+                                  30,
+                                  CellularAutomatonParams::Output::liveCell,
+                                  -1),
+                "The live cell index must be 0 or greater");
+            REQUIRE_THROWS_WITH(
+                CellularAutomaton(Range(1, 10),
+                                  30,
+                                  CellularAutomatonParams::Output::row,
+                                  0,
+                                  {5, 11}),
+                "The initial cells must be within the range");
+        }
+    }
+
+    GIVEN("The object is constructed with no initial cells")
+    {
+        CellularAutomaton instance(Range(10, 20),
+                                   90,
+                                   CellularAutomatonParams::Output::row);
+
+        THEN("Only the centre of the range is live in the first row")
+        {
+            REQUIRE(instance.getRow() == std::vector<int> {15});
+            REQUIRE(instance.getIntegerNumber() == 15);
+        }
+
+        THEN("The next row follows the rule")
+        {
+            instance.getIntegerNumber();
+            REQUIRE(instance.getIntegerNumber() == 14);
+            REQUIRE(instance.getIntegerNumber() == 16);
+            REQUIRE(instance.getRow() == std::vector<int> {14, 16});
+        }
+    }
+
+    GIVEN("The output is the row")
+    {
+        int rule = 30;
+        Range range(5, 204);
+        std::vector<int> initialCells {5, 60, 69, 70, 130, 204};
+        CellularAutomaton instance(range,
+                                   rule,
+                                   CellularAutomatonParams::Output::row,
+                                   0,
+                                   initialCells);
+
+        THEN("Numbers are the live cells of each row in turn, matching a cell "
+             "by cell simulation across word boundaries and the wrap around")
+        {
+            std::vector<bool> row(range.size, false);
+            for(auto number : initialCells) {
+                row[number - range.offset] = true;
+            }
+
+            std::vector<int> expected;
+            for(int generation = 0; generation < 300; generation++) {
+                auto numbers = getLiveNumbers(row, range.offset);
+                expected.insert(expected.end(), numbers.begin(), numbers.end());
+                row = getNextRow(row, rule);
+            }
+
+            auto size = static_cast<int>(expected.size());
+            auto numbers = instance.getIntegerCollection(size);
+            REQUIRE(numbers == expected);
+        }
+    }
+
+    GIVEN("The output is the population")
+    {
+        int rule = 90;
+        Range range(0, 127);
+        CellularAutomaton instance(range,
+                                   rule,
+                                   CellularAutomatonParams::Output::population,
+                                   0,
+                                   {64});
+
+        THEN("Numbers are the population of each row, which doubles each "
+             "power of two generations for rule 90")
+        {
+            auto numbers = instance.getIntegerCollection(9);
+            std::vector<int> expected {0, 1, 1, 3, 1, 3, 3, 7, 1};
+            // Populations 1, 2, 2, 4, 2, 4, 4, 8, 2 scaled by 127 / 128
+            REQUIRE(numbers == expected);
+        }
+
+        THEN("Decimal numbers are the population as a proportion of the range")
+        {
+            REQUIRE(instance.getDecimalNumber() == Approx(127.0 / 128.0));
+            REQUIRE(instance.getDecimalNumber() == Approx(127.0 / 64.0));
+        }
+
+        THEN("A full row produces the end of the range and an empty row the "
+             "start")
+        {
+            CellularAutomaton flip(range,
+                                   51,
+                                   CellularAutomatonParams::Output::population,
+                                   0,
+                                   {64});
+            REQUIRE(flip.getIntegerNumber() == 0);
+            REQUIRE(flip.getIntegerNumber() == 126);
+
+            CellularAutomaton full(range,
+                                   255,
+                                   CellularAutomatonParams::Output::population);
+            full.getIntegerNumber();
+            REQUIRE(full.getIntegerNumber() == 127);
+
+            CellularAutomaton dead(range,
+                                   0,
+                                   CellularAutomatonParams::Output::population);
+            dead.getIntegerNumber();
+            REQUIRE(dead.getIntegerNumber() == 0);
+        }
+    }
+
+    GIVEN("The output is a live cell")
+    {
+        int rule = 30;
+        Range range(1, 100);
+        CellularAutomaton instance(range,
+                                   rule,
+                                   CellularAutomatonParams::Output::liveCell,
+                                   3);
+
+        THEN("Numbers are the live cell at the index within each row, "
+             "wrapping when the row has fewer live cells")
+        {
+            std::vector<bool> row(range.size, false);
+            row[range.size / 2] = true;
+
+            bool matches = true;
+            for(int generation = 0; generation < 500; generation++) {
+                auto numbers = getLiveNumbers(row, range.offset);
+                matches &= instance.getIntegerNumber() ==
+                           numbers[3 % numbers.size()];
+                row = getNextRow(row, rule);
+            }
+            REQUIRE(matches);
+        }
+    }
+
+    GIVEN("The row dies out")
+    {
+        CellularAutomaton instance(Range(1, 10),
+                                   0,
+                                   CellularAutomatonParams::Output::row,
+                                   0,
+                                   {2, 7});
+
+        THEN("The initial row is restored")
+        {
+            auto numbers = instance.getIntegerCollection(6);
+            REQUIRE(numbers == std::vector<int> {2, 7, 2, 7, 2, 7});
+        }
+    }
+
+    GIVEN("A range of two numbers")
+    {
+        CellularAutomaton instance(Range(3, 4),
+                                   102,
+                                   CellularAutomatonParams::Output::row,
+                                   0,
+                                   {3});
+
+        THEN("Each cell is both neighbours of the other")
+        {
+            // Rule 102 is the centre cell exclusive or its right neighbour
+            auto numbers = instance.getIntegerCollection(4);
+            REQUIRE(numbers == std::vector<int> {3, 3, 4, 3});
+        }
+    }
+
+    WHEN("Get params")
+    {
+        CellularAutomaton instance(Range(1, 10),
+                                   110,
+                                   CellularAutomatonParams::Output::liveCell,
+                                   2,
+                                   {3, 4});
+        auto params = instance.getParams();
+
+        THEN("Reflects object state")
+        {
+            REQUIRE(params.getRange().start == 1);
+            REQUIRE(params.getRange().end == 10);
+            auto automaton = params.protocols.getCellularAutomaton();
+            REQUIRE(automaton.getRule() == 110);
+            REQUIRE(automaton.getOutput() ==
+                    CellularAutomatonParams::Output::liveCell);
+            REQUIRE(automaton.getLiveCellIndex() == 2);
+            REQUIRE(automaton.getInitialCells() == std::vector<int> {3, 4});
+            REQUIRE(params.protocols.getActiveProtocol() ==
+                    NumberProtocol::Type::cellularAutomaton);
+        }
+    }
+
+    WHEN("Set params")
+    {
+        CellularAutomaton instance(Range(1, 10),
+                                   30,
+                                   CellularAutomatonParams::Output::row);
+        instance.getIntegerCollection(20);
+
+        THEN("Invalid params throw and leave the object unchanged")
+        {
+            REQUIRE_THROWS_AS(
+                instance.setParams(NumberProtocolConfig(
+                    Range(20, 30),
+                    NumberProtocolParams(CellularAutomatonParams(
+                        30, CellularAutomatonParams::Output::row, 0, {5})))),
+                std::invalid_argument);
+            REQUIRE(instance.getParams().getRange().start == 1);
+        }
+
+        instance.setParams(NumberProtocolConfig(
+            Range(20, 30),
+            NumberProtocolParams(CellularAutomatonParams(
+                90, CellularAutomatonParams::Output::row, 0, {21}))));
+
+        THEN("Object is updated and restarts from the new initial row")
+        {
+            auto automaton =
+                instance.getParams().protocols.getCellularAutomaton();
+            REQUIRE(automaton.getRule() == 90);
+            REQUIRE(instance.getParams().getRange().start == 20);
+            auto numbers = instance.getIntegerCollection(3);
+            REQUIRE(numbers == std::vector<int> {21, 20, 22});
+        }
+    }
+}
@@ -0,0 +1,194 @@
+#include "ChordProducer.hpp"
+
+#include "Range.hpp"
+#include "UniformGenerator.hpp"
+#include "UniformGeneratorMock.hpp"
+
+#include <algorithm>
+#include <map>
+
+namespace {
+bool isChord(std::vector<int> chord, aleatoric::Range range)
+{
+    std::sort(chord.begin(), chord.end());
+    return std::adjacent_find(chord.begin(), chord.end()) == chord.end() &&
+           range.numberIsInRange(chord.front()) &&
+           range.numberIsInRange(chord.back());
+}
+} // namespace
+
+SCENARIO("ChordProducer")
+{
+    using namespace aleatoric;
+
+    Range range(1, 10);
+
+    GIVEN("Construction: with invalid arguments")
+    {
+        THEN("Throws")
+        {
+            REQUIRE_THROWS_WITH(
+                ChordProducer(std::make_unique<UniformGenerator>(), range, 0),
+                "The chord size must be between 1 and the size of the range");
+            REQUIRE_THROWS_WITH(
+                ChordProducer(std::make_unique<UniformGenerator>(), range, 11),
+                "The chord size must be between 1 and the size of the range");
+        }
+    }
+
+    GIVEN("The generator is a mock")
+    {
+        auto generator = std::make_unique<UniformGeneratorMock>();
+        auto generatorPointer = generator.get();
+
+        ChordProducer instance(std::move(generator), Range(1, 4), 2);
+
+        THEN("Each number is selected from the numbers not yet in the chord")
+        {
+            REQUIRE_CALL(*generatorPointer, setDistribution(0, 3));
+            REQUIRE_CALL(*generatorPointer, setDistribution(1, 3));
+            REQUIRE_CALL(*generatorPointer, getNumber()).TIMES(2).RETURN(2);
+
+            // The second selection takes the number swapped out of the
+            // position of the first
+            REQUIRE(instance.getChord() == std::vector<int> {3, 1});
+        }
+    }
+
+    GIVEN("A chord size")
+    {
+        ChordProducer instance(std::make_unique<UniformGenerator>(), range, 4);
+
+        WHEN("Chords are requested")
+        {
+            auto chords = instance.getChords(1000);
+
+            THEN("Each chord holds distinct numbers within the range")
+            {
+                REQUIRE(chords.size() == 1000);
+                bool allChords = true;
+                for(auto &&chord : chords) {
+                    allChords &= chord.size() == 4 && isChord(chord, range);
+                }
+                REQUIRE(allChords);
+            }
+
+            THEN("Every number occurs equally often")
+            {
+                std::vector<int> counts(range.size, 0);
+                for(auto &&chord : chords) {
+                    for(auto &&number : chord) {
+                        counts[number - range.offset]++;
+                    }
+                }
+                // 400 each on average
+                for(auto &&count : counts) {
+                    REQUIRE(count > 300);
+                    REQUIRE(count < 500);
+                }
+            }
+        }
+
+        WHEN("Chords are written to a matrix")
+        {
+            std::vector<int> matrix(100 * 4);
+            instance.getChords(matrix.data(), 100);
+
+            THEN("Each row holds a chord")
+            {
+                bool allChords = true;
+                for(int i = 0; i < 100; i++) {
+                    allChords &= isChord(
+                        std::vector<int>(matrix.begin() + i * 4,
+                                         matrix.begin() + i * 4 + 4),
+                        range);
+                }
+                REQUIRE(allChords);
+            }
+        }
+
+        WHEN("The chord size is the size of the range")
+        {
+            instance.setChordSize(range.size);
+
+            THEN("Each chord holds every number")
+            {
+                auto chord = instance.getChord();
+                std::sort(chord.begin(), chord.end());
+                REQUIRE(chord ==
+                        std::vector<int> {1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+            }
+        }
+    }
+
+    GIVEN("Chords of two numbers from three")
+    {
+        ChordProducer instance(std::make_unique<UniformGenerator>(),
+                               Range(1, 3),
+                               2);
+
+        THEN("Every pair is equally likely")
+        {
+            std::map<std::vector<int>, int> counts;
+            for(int i = 0; i < 3000; i++) {
+                auto chord = instance.getChord();
+                std::sort(chord.begin(), chord.end());
+                counts[chord]++;
+            }
+            // 1000 each on average
+            REQUIRE(counts.size() == 3);
+            for(auto &&count : counts) {
+                REQUIRE(count.second > 850);
+                REQUIRE(count.second < 1150);
+            }
+        }
+    }
+
+    GIVEN("Getters and setters")
+    {
+        ChordProducer instance(std::make_unique<UniformGenerator>(), range, 4);
+
+        REQUIRE(instance.getRange().start == 1);
+        REQUIRE(instance.getRange().end == 10);
+        REQUIRE(instance.getChordSize() == 4);
+
+        WHEN("The range is set")
+        {
+            Range newRange(20, 25);
+            instance.setRange(newRange);
+
+            THEN("Chords are selected from the new range")
+            {
+                REQUIRE(instance.getRange().start == 20);
+                bool allChords = true;
+                for(int i = 0; i < 100; i++) {
+                    allChords &= isChord(instance.getChord(), newRange);
+                }
+                REQUIRE(allChords);
+            }
+        }
+
+        WHEN("The chord size is set")
+        {
+            instance.setChordSize(6);
+
+            THEN("Chords have the new size")
+            {
+                REQUIRE(instance.getChordSize() == 6);
+                REQUIRE(instance.getChord().size() == 6);
+            }
+        }
+
+        THEN("Invalid values throw and leave the producer unchanged")
+        {
+            REQUIRE_THROWS_WITH(
+                instance.setRange(Range(1, 3)),
+                "The chord size must be between 1 and the size of the range");
+            REQUIRE_THROWS_WITH(
+                instance.setChordSize(0),
+                "The chord size must be between 1 and the size of the range");
+            REQUIRE(instance.getRange().end == 10);
+            REQUIRE(instance.getChordSize() == 4);
+        }
+    }
+}
@@ -148,6 +148,47 @@ SCENARIO("CollectionsProducer: using Serial")
     }
 }
 
+SCENARIO("CollectionsProducer: using WeightedSerial")
+{
+    using namespace aleatoric;
+
+    std::vector<char> source {'a', 'b', 'c'};
+
+    GIVEN("The Producer has been instantiated")
+    {
+        CollectionsProducer<char> instance(
+            source,
+            NumberProtocol::create(NumberProtocol::Type::weightedSerial));
+
+        WHEN("The weights are set")
+        {
+            instance.setParams(NumberProtocolParams(
+                WeightedSerialParams(std::vector<double> {1.0, 0.0, 4.0})));
+
+            auto sample = instance.getCollection(100);
+
+            THEN("Only items with a weight above 0 are selected, each once "
+                 "per series")
+            {
+                REQUIRE(std::count(sample.begin(), sample.end(), 'a') == 50);
+                REQUIRE(std::count(sample.begin(), sample.end(), 'b') == 0);
+                REQUIRE(std::count(sample.begin(), sample.end(), 'c') == 50);
+            }
+        }
+
+        WHEN("A full series sample set has been gathered with default params")
+        {
+            auto sample = instance.getCollection(source.size());
+
+            THEN("The sample should include every item from the source "
+                 "collection and only once")
+            {
+                REQUIRE_THAT(sample, Catch::UnorderedEquals(source));
+            }
+        }
+    }
+}
+
 SCENARIO("CollectionsProducer: using Subset")
 {
     using namespace aleatoric;
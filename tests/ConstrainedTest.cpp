@@ -0,0 +1,449 @@
+#include "Constrained.hpp"
+
+#include "Basic.hpp"
+#include "Cycle.hpp"
+#include "Range.hpp"
+#include "UniformGenerator.hpp"
+#include "UniformGeneratorMock.hpp"
+#include "UniformRealGenerator.hpp"
+
+#include <cstdlib>
+
+namespace {
+std::unique_ptr<aleatoric::NumberProtocol> makeBasic(aleatoric::Range range)
+{
+    return std::make_unique<aleatoric::Basic>(
+        std::make_unique<aleatoric::UniformGenerator>(), range);
+}
+
+std::vector<std::vector<int>> getPhrases(aleatoric::Constrained &instance,
+                                         int length,
+                                         int count)
+{
+    std::vector<std::vector<int>> phrases;
+    for(int i = 0; i < count; i++) {
+        phrases.push_back(instance.getIntegerCollection(length));
+    }
+    return phrases;
+}
+} // namespace
+
+SCENARIO("Numbers::Constrained: default constructor")
+{
+    using namespace aleatoric;
+
+    Constrained instance(std::make_unique<Cycle>(Range(0, 1)),
+                         std::make_unique<UniformRealGenerator>());
+
+    THEN("Params are set to defaults")
+    {
+        auto params = instance.getParams();
+        REQUIRE(params.getRange().start == 0);
+        REQUIRE(params.getRange().end == 1);
+        REQUIRE(params.protocols.getConstrained().getLength() == 16);
+        auto constraints = params.protocols.getConstrained().getConstraints();
+        REQUIRE(constraints.maxRun == 0);
+        REQUIRE(constraints.intervals.empty());
+        REQUIRE_FALSE(constraints.fixFirst);
+        REQUIRE_FALSE(constraints.fixLast);
+    }
+
+    THEN("The source is passed through untouched")
+    {
+        REQUIRE(instance.getIntegerCollection(6) ==
+                std::vector<int> {0, 1, 0, 1, 0, 1});
+    }
+}
+
+SCENARIO("Numbers::Constrained")
+{
+    using namespace aleatoric;
+
+    Range range(1, 12);
+
+    GIVEN("Construction: with invalid params")
+    {
+        auto construct = [range](int length, Constraints constraints) {
+            Constrained(makeBasic(range),
+                        std::make_unique<UniformRealGenerator>(),
+                        range,
+                        ConstrainedParams(length, constraints));
+        };
+
+        THEN("Throws")
+        {
+            Constraints constraints;
+            REQUIRE_THROWS_WITH(construct(0, constraints),
+                                "The length must be 1 or greater");
+
+            constraints.maxRun = -1;
+            REQUIRE_THROWS_WITH(construct(4, constraints),
+                                "The maximum run must be 0 or greater");
+
+            constraints = Constraints();
+            constraints.intervals = {1, -2};
+            REQUIRE_THROWS_WITH(construct(4, constraints),
+                                "Intervals must be 0 or greater");
+
+            constraints.intervals = {12, 20};
+            REQUIRE_THROWS_WITH(construct(4, constraints),
+                                "At least one interval must be smaller than "
+                                "the size of the range");
+
+            constraints = Constraints();
+            constraints.fixLast = true;
+            constraints.last = 13;
+            REQUIRE_THROWS_WITH(
+                construct(4, constraints),
+                "The first and last numbers must be within the range");
+
+            constraints = Constraints();
+            constraints.minSum = 10;
+            constraints.maxSum = 9;
+            REQUIRE_THROWS_WITH(
+                construct(4, constraints),
+                "The minimum sum must not be greater than the maximum sum");
+
+            constraints = Constraints();
+            constraints.minSum = 49;
+            REQUIRE_THROWS_WITH(construct(4, constraints),
+                                "The constraints cannot be satisfied");
+
+            constraints = Constraints();
+            constraints.fixFirst = true;
+            constraints.first = 12;
+            constraints.maxSum = 14;
+            REQUIRE_THROWS_WITH(construct(4, constraints),
+                                "The constraints cannot be satisfied");
+        }
+    }
+
+    GIVEN("A limit on successive repetitions")
+    {
+        auto generator = std::make_unique<UniformGeneratorMock>();
+        auto generatorPointer = generator.get();
+        ALLOW_CALL(*generatorPointer, setDistribution(ANY(int), ANY(int)));
+        ALLOW_CALL(*generatorPointer, getNumber()).RETURN(5);
+
+        Constraints constraints;
+        constraints.maxRun = 2;
+        Constrained instance(
+            std::make_unique<Basic>(std::move(generator), range),
+            std::make_unique<UniformRealGenerator>(),
+            range,
+            ConstrainedParams(12, constraints));
+
+        THEN("Proposals are used until the limit is reached")
+        {
+            auto phrase = instance.getIntegerCollection(12);
+            REQUIRE(phrase[0] == 5);
+            REQUIRE(phrase[1] == 5);
+            REQUIRE(phrase[2] != 5);
+            REQUIRE(phrase[3] == 5);
+        }
+
+        THEN("Replacements are weighted towards the proposal, halving with "
+             "each step away from it")
+        {
+            int replaced = 0;
+            int adjacent = 0;
+            for(auto number : instance.getIntegerCollection(30000)) {
+                if(number != 5) {
+                    replaced++;
+                    adjacent += number == 4 || number == 6;
+                }
+            }
+            // 4 and 6 carry 1 of the total weight 1.875 + 7 / 128 of 1 to 12
+            REQUIRE(replaced == 10000);
+            REQUIRE(adjacent / 10000.0 ==
+                    Approx(1.0 / (1.875 + 7.0 / 128.0)).margin(0.03));
+        }
+    }
+
+    GIVEN("Permitted intervals")
+    {
+        Constraints constraints;
+        constraints.intervals = {2, 3};
+        Constrained instance(makeBasic(range),
+                             std::make_unique<UniformRealGenerator>(),
+                             range,
+                             ConstrainedParams(16, constraints));
+
+        THEN("Successive numbers within each phrase are a permitted interval "
+             "apart")
+        {
+            bool intervalsPermitted = true;
+            for(auto &&phrase : getPhrases(instance, 16, 200)) {
+                for(size_t i = 1; i < phrase.size(); i++) {
+                    auto interval = std::abs(phrase[i] - phrase[i - 1]);
+                    intervalsPermitted &= interval == 2 || interval == 3;
+                }
+            }
+            REQUIRE(intervalsPermitted);
+        }
+    }
+
+    GIVEN("Bounds on the sum")
+    {
+        Constraints constraints;
+        constraints.minSum = 60;
+        constraints.maxSum = 62;
+        Constrained instance(makeBasic(range),
+                             std::make_unique<UniformRealGenerator>(),
+                             range,
+                             ConstrainedParams(8, constraints));
+
+        THEN("The sum of each phrase is within the bounds")
+        {
+            bool sumsWithinBounds = true;
+            bool numbersInRange = true;
+            for(auto &&phrase : getPhrases(instance, 8, 500)) {
+                int sum = 0;
+                for(auto number : phrase) {
+                    sum += number;
+                    numbersInRange &= range.numberIsInRange(number);
+                }
+                sumsWithinBounds &= sum >= 60 && sum <= 62;
+            }
+            REQUIRE(sumsWithinBounds);
+            REQUIRE(numbersInRange);
+        }
+    }
+
+    GIVEN("A fixed first and last number")
+    {
+        Constraints constraints;
+        constraints.intervals = {1, 2};
+        constraints.fixFirst = true;
+        constraints.first = 1;
+        constraints.fixLast = true;
+        constraints.last = 12;
+        Constrained instance(makeBasic(range),
+                             std::make_unique<UniformRealGenerator>(),
+                             range,
+                             ConstrainedParams(7, constraints));
+
+        THEN("Each phrase starts and ends with them, even when the last is "
+             "only just reachable")
+        {
+            bool fixed = true;
+            bool intervalsPermitted = true;
+            for(auto &&phrase : getPhrases(instance, 7, 500)) {
+                fixed &= phrase.front() == 1 && phrase.back() == 12;
+                for(size_t i = 1; i < phrase.size(); i++) {
+                    auto interval = std::abs(phrase[i] - phrase[i - 1]);
+                    intervalsPermitted &= interval == 1 || interval == 2;
+                }
+            }
+            REQUIRE(fixed);
+            REQUIRE(intervalsPermitted);
+        }
+    }
+
+    GIVEN("A last number that can only be reached from every other number")
+    {
+        Constraints constraints;
+        constraints.intervals = {2};
+        constraints.fixLast = true;
+        constraints.last = 4;
+        Constrained instance(makeBasic(range),
+                             std::make_unique<UniformRealGenerator>(),
+                             range,
+                             ConstrainedParams(9, constraints));
+
+        THEN("Every number of each phrase is one from which it can be reached")
+        {
+            bool even = true;
+            bool last = true;
+            for(auto &&phrase : getPhrases(instance, 9, 200)) {
+                for(auto number : phrase) {
+                    even &= number % 2 == 0;
+                }
+                last &= phrase.back() == 4;
+            }
+            REQUIRE(even);
+            REQUIRE(last);
+        }
+    }
+
+    GIVEN("Constraints that no phrase can satisfy")
+    {
+        Constraints constraints;
+        constraints.intervals = {2};
+        constraints.fixFirst = true;
+        constraints.first = 1;
+        constraints.fixLast = true;
+        constraints.last = 4;
+
+        THEN("Construction throws rather than searching without end")
+        {
+            REQUIRE_THROWS_WITH(
+                Constrained(makeBasic(range),
+                            std::make_unique<UniformRealGenerator>(),
+                            range,
+                            ConstrainedParams(5, constraints)),
+                "The constraints cannot be satisfied");
+        }
+
+        THEN("Setting them throws and leaves the object unchanged")
+        {
+            Constrained instance(std::make_unique<Cycle>(range),
+                                 std::make_unique<UniformRealGenerator>(),
+                                 range,
+                                 ConstrainedParams(4, Constraints()));
+            REQUIRE(instance.getIntegerCollection(2) ==
+                    std::vector<int> {1, 2});
+
+            REQUIRE_THROWS_WITH(
+                instance.setParams(NumberProtocolConfig(
+                    range,
+                    NumberProtocolParams(ConstrainedParams(5, constraints)))),
+                "The constraints cannot be satisfied");
+            auto params = instance.getParams().protocols.getConstrained();
+            REQUIRE(params.getLength() == 4);
+            REQUIRE_FALSE(params.getConstraints().fixFirst);
+
+            // The current phrase continues where it left off
+            REQUIRE(instance.getIntegerCollection(2) ==
+                    std::vector<int> {3, 4});
+        }
+    }
+
+    GIVEN("Sum and interval constraints that searches can fail to meet")
+    {
+        Range tightRange(0, 10);
+        Constraints constraints;
+        constraints.maxRun = 1;
+        constraints.intervals = {4};
+        constraints.minSum = 50;
+        constraints.maxSum = 50;
+        Constrained instance(makeBasic(tightRange),
+                             std::make_unique<UniformRealGenerator>(),
+                             tightRange,
+                             ConstrainedParams(10, constraints));
+
+        THEN("Numbers never fail once the params are accepted, and each "
+             "phrase obeys the constraints")
+        {
+            std::vector<std::vector<int>> phrases;
+            REQUIRE_NOTHROW(phrases = getPhrases(instance, 10, 2000));
+            bool obeys = true;
+            for(auto &&phrase : phrases) {
+                int sum = 0;
+                for(size_t i = 0; i < phrase.size(); i++) {
+                    sum += phrase[i];
+                    if(i > 0) {
+                        obeys &= std::abs(phrase[i] - phrase[i - 1]) == 4;
+                    }
+                }
+                obeys &= sum == 50;
+            }
+            REQUIRE(obeys);
+        }
+    }
+
+    GIVEN("Long phrases with all constraints combined")
+    {
+        Range wideRange(1, 24);
+        Constraints constraints;
+        constraints.maxRun = 1;
+        constraints.intervals = {0, 1, 2, 3, 4};
+        constraints.minSum = 24000;
+        constraints.maxSum = 24050;
+        constraints.fixFirst = true;
+        constraints.first = 1;
+        constraints.fixLast = true;
+        constraints.last = 24;
+        Constrained instance(makeBasic(wideRange),
+                             std::make_unique<UniformRealGenerator>(),
+                             wideRange,
+                             ConstrainedParams(2000, constraints));
+
+        THEN("Each phrase obeys all of them")
+        {
+            bool obeys = true;
+            for(auto &&phrase : getPhrases(instance, 2000, 5)) {
+                int sum = 0;
+                for(size_t i = 0; i < phrase.size(); i++) {
+                    sum += phrase[i];
+                    if(i > 0) {
+                        obeys &= phrase[i] != phrase[i - 1];
+                        obeys &= std::abs(phrase[i] - phrase[i - 1]) <= 4;
+                    }
+                }
+                obeys &= sum >= 24000 && sum <= 24050;
+                obeys &= phrase.front() == 1 && phrase.back() == 24;
+            }
+            REQUIRE(obeys);
+        }
+    }
+
+    WHEN("Get params")
+    {
+        Constraints constraints;
+        constraints.maxRun = 3;
+        constraints.intervals = {1, 5};
+        constraints.minSum = 10;
+        constraints.maxSum = 40;
+        constraints.fixFirst = true;
+        constraints.first = 2;
+        Constrained instance(makeBasic(range),
+                             std::make_unique<UniformRealGenerator>(),
+                             range,
+                             ConstrainedParams(6, constraints));
+        auto params = instance.getParams();
+
+        THEN("Reflects object state")
+        {
+            REQUIRE(params.getRange().start == 1);
+            REQUIRE(params.getRange().end == 12);
+            auto constrained = params.protocols.getConstrained();
+            REQUIRE(constrained.getLength() == 6);
+            REQUIRE(constrained.getConstraints().maxRun == 3);
+            REQUIRE(constrained.getConstraints().intervals ==
+                    std::vector<int> {1, 5});
+            REQUIRE(constrained.getConstraints().minSum == 10);
+            REQUIRE(constrained.getConstraints().maxSum == 40);
+            REQUIRE(constrained.getConstraints().fixFirst);
+            REQUIRE(constrained.getConstraints().first == 2);
+            REQUIRE_FALSE(constrained.getConstraints().fixLast);
+            REQUIRE(params.protocols.getActiveProtocol() ==
+                    NumberProtocol::Type::constrained);
+        }
+    }
+
+    WHEN("Set params")
+    {
+        Constrained instance(makeBasic(range),
+                             std::make_unique<UniformRealGenerator>(),
+                             range,
+                             ConstrainedParams(6, Constraints()));
+        instance.getIntegerCollection(3);
+
+        THEN("Invalid params throw and leave the object unchanged")
+        {
+            REQUIRE_THROWS_AS(
+                instance.setParams(NumberProtocolConfig(
+                    Range(20, 30),
+                    NumberProtocolParams(ConstrainedParams(0, Constraints())))),
+                std::invalid_argument);
+            REQUIRE(instance.getParams().getRange().start == 1);
+        }
+
+        Constraints constraints;
+        constraints.fixFirst = true;
+        constraints.first = 3;
+        instance.setParams(NumberProtocolConfig(
+            range,
+            NumberProtocolParams(ConstrainedParams(4, constraints))));
+
+        THEN("Object is updated and starts a new phrase")
+        {
+            auto params = instance.getParams();
+            REQUIRE(params.protocols.getConstrained().getLength() == 4);
+            REQUIRE(instance.getIntegerNumber() == 3);
+            instance.getIntegerCollection(3);
+            REQUIRE(instance.getIntegerNumber() == 3);
+        }
+    }
+}
@@ -0,0 +1,299 @@
+#include "CopulaProducer.hpp"
+
+#include "Basic.hpp"
+#include "Cycle.hpp"
+#include "GaussianGenerator.hpp"
+#include "Range.hpp"
+#include "UniformGenerator.hpp"
+#include "UniformRealGenerator.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+std::vector<std::unique_ptr<aleatoric::NumberProtocol>>
+makeBasicProtocols(int numberOfDimensions)
+{
+    std::vector<std::unique_ptr<aleatoric::NumberProtocol>> protocols;
+    for(int i = 0; i < numberOfDimensions; i++) {
+        protocols.push_back(std::make_unique<aleatoric::Basic>(
+            std::make_unique<aleatoric::UniformGenerator>(),
+            aleatoric::Range(1, 100000)));
+    }
+    return protocols;
+}
+
+template<typename T>
+double getCorrelation(const std::vector<T> &first, const std::vector<T> &second)
+{
+    double size = first.size();
+    double firstMean = 0.0;
+    double secondMean = 0.0;
+    for(size_t i = 0; i < first.size(); i++) {
+        firstMean += first[i] / size;
+        secondMean += second[i] / size;
+    }
+
+    double covariance = 0.0;
+    double firstVariance = 0.0;
+    double secondVariance = 0.0;
+    for(size_t i = 0; i < first.size(); i++) {
+        auto firstDeviation = first[i] - firstMean;
+        auto secondDeviation = second[i] - secondMean;
+        covariance += firstDeviation * secondDeviation;
+        firstVariance += firstDeviation * firstDeviation;
+        secondVariance += secondDeviation * secondDeviation;
+    }
+    return covariance / std::sqrt(firstVariance * secondVariance);
+}
+
+double getKendallsTau(const std::vector<int> &first,
+                      const std::vector<int> &second)
+{
+    long long concordance = 0;
+    for(size_t i = 0; i < first.size(); i++) {
+        for(size_t j = i + 1; j < first.size(); j++) {
+            auto product =
+                (first[i] - first[j]) * (long long)(second[i] - second[j]);
+            concordance += (product > 0) - (product < 0);
+        }
+    }
+    double pairs = first.size() * (first.size() - 1.0) / 2.0;
+    return concordance / pairs;
+}
+} // namespace
+
+SCENARIO("CopulaProducer")
+{
+    using namespace aleatoric;
+
+    GIVEN("Construction: with invalid arguments")
+    {
+        THEN("Throws")
+        {
+            REQUIRE_THROWS_WITH(
+                CopulaProducer(makeBasicProtocols(0),
+                               std::make_unique<GaussianGenerator>(),
+                               std::vector<std::vector<double>> {}),
+                "The number of dimensions must be greater than 0");
+            REQUIRE_THROWS_WITH(
+                CopulaProducer(makeBasicProtocols(2),
+                               std::make_unique<GaussianGenerator>(),
+                               {{1.0}}),
+                "The correlation matrix must have a row and column for each "
+                "dimension");
+            REQUIRE_THROWS_WITH(
+                CopulaProducer(makeBasicProtocols(2),
+                               std::make_unique<GaussianGenerator>(),
+                               {{1.0, 0.5}, {0.5, 0.9}}),
+                "The correlation matrix must have 1 on its diagonal");
+            REQUIRE_THROWS_WITH(
+                CopulaProducer(makeBasicProtocols(2),
+                               std::make_unique<GaussianGenerator>(),
+                               {{1.0, 0.5}, {0.4, 1.0}}),
+                "The correlation matrix must be symmetric");
+            REQUIRE_THROWS_WITH(
+                CopulaProducer(makeBasicProtocols(2),
+                               std::make_unique<GaussianGenerator>(),
+                               {{1.0, 1.5}, {1.5, 1.0}}),
+                "Correlations must be between -1 and 1");
+            REQUIRE_THROWS_WITH(
+                CopulaProducer(makeBasicProtocols(3),
+                               std::make_unique<GaussianGenerator>(),
+                               {{1.0, 0.9, 0.9},
+                                {0.9, 1.0, -0.9},
+                                {0.9, -0.9, 1.0}}),
+                "The correlation matrix must be positive semi-definite");
+            REQUIRE_THROWS_WITH(
+                CopulaProducer(makeBasicProtocols(3),
+                               std::make_unique<GaussianGenerator>(),
+                               {{1.0, 1.0, 0.0},
+                                {1.0, 1.0, 0.5},
+                                {0.0, 0.5, 1.0}}),
+                "The correlation matrix must be positive semi-definite");
+            REQUIRE_THROWS_WITH(
+                CopulaProducer(makeBasicProtocols(2),
+                               std::make_unique<UniformRealGenerator>(),
+                               0.0),
+                "Theta must be greater than 0");
+            REQUIRE_NOTHROW(
+                CopulaProducer(makeBasicProtocols(3),
+                               std::make_unique<GaussianGenerator>(),
+                               {{1.0, 1.0, 0.5},
+                                {1.0, 1.0, 0.5},
+                                {0.5, 0.5, 1.0}}));
+        }
+    }
+
+    GIVEN("A Gaussian copula")
+    {
+        CopulaProducer instance(makeBasicProtocols(3),
+                                std::make_unique<GaussianGenerator>(),
+                                {{1.0, 0.8, 0.0},
+                                 {0.8, 1.0, -0.5},
+                                 {0.0, -0.5, 1.0}});
+
+        WHEN("A block is produced")
+        {
+            auto block = instance.getIntegerBlock(10000);
+
+            THEN("Each dimension is rank correlated with the others as the "
+                 "correlations set")
+            {
+                // For a Gaussian copula, the rank correlation is
+                // 6 / pi * asin(correlation / 2)
+                auto expected = [](double correlation) {
+                    return 6.0 / M_PI * std::asin(correlation / 2.0);
+                };
+                REQUIRE(block.size() == 3);
+                REQUIRE(getCorrelation(block[0], block[1]) ==
+                        Approx(expected(0.8)).margin(0.03));
+                REQUIRE(getCorrelation(block[1], block[2]) ==
+                        Approx(expected(-0.5)).margin(0.03));
+                REQUIRE(std::abs(getCorrelation(block[0], block[2])) < 0.05);
+            }
+        }
+
+        WHEN("A block of decimal numbers is written to arrays")
+        {
+            std::vector<double> first(10000);
+            std::vector<double> second(10000);
+            std::vector<double> third(10000);
+            double *output[] = {first.data(), second.data(), third.data()};
+            instance.getDecimalBlock(output, 10000);
+
+            THEN("The arrays are correlated in the same way")
+            {
+                REQUIRE(getCorrelation(first, second) > 0.7);
+                REQUIRE(getCorrelation(second, third) < -0.4);
+            }
+        }
+
+        WHEN("The correlations are changed")
+        {
+            instance.setCorrelations({{1.0, 0.0, 0.0},
+                                      {0.0, 1.0, 0.0},
+                                      {0.0, 0.0, 1.0}});
+            auto block = instance.getIntegerBlock(10000);
+
+            THEN("The dimensions become independent")
+            {
+                REQUIRE(instance.getCorrelations()[0][1] == 0.0);
+                REQUIRE(std::abs(getCorrelation(block[0], block[1])) < 0.05);
+                REQUIRE(std::abs(getCorrelation(block[1], block[2])) < 0.05);
+            }
+        }
+
+        THEN("Clayton settings cannot be used")
+        {
+            REQUIRE(instance.getCopula() == CopulaProducer::Copula::gaussian);
+            REQUIRE_THROWS_WITH(instance.getTheta(),
+                                "The copula is not Clayton");
+            REQUIRE_THROWS_WITH(instance.setTheta(1.0),
+                                "The copula is not Clayton");
+        }
+    }
+
+    GIVEN("A Clayton copula")
+    {
+        CopulaProducer instance(makeBasicProtocols(2),
+                                std::make_unique<UniformRealGenerator>(),
+                                2.0);
+
+        WHEN("A block is produced")
+        {
+            auto block = instance.getIntegerBlock(2000);
+
+            THEN("Kendall's rank correlation is theta / (theta + 2)")
+            {
+                REQUIRE(getKendallsTau(block[0], block[1]) ==
+                        Approx(0.5).margin(0.05));
+            }
+        }
+
+        WHEN("A large block is produced")
+        {
+            auto block = instance.getIntegerBlock(20000);
+
+            THEN("Low numbers occur together far more often than high ones")
+            {
+                int low = 0;
+                int high = 0;
+                for(size_t i = 0; i < block[0].size(); i++) {
+                    low += block[0][i] <= 5000 && block[1][i] <= 5000;
+                    high += block[0][i] > 95000 && block[1][i] > 95000;
+                }
+                REQUIRE(low > 2 * high);
+            }
+        }
+
+        THEN("Theta can be changed but the correlations cannot be used")
+        {
+            instance.setTheta(0.5);
+            REQUIRE(instance.getTheta() == 0.5);
+            REQUIRE_THROWS_AS(instance.setTheta(-1.0), std::invalid_argument);
+            REQUIRE(instance.getCopula() == CopulaProducer::Copula::clayton);
+            REQUIRE_THROWS_WITH(instance.getCorrelations(),
+                                "The copula is not Gaussian");
+        }
+    }
+
+    GIVEN("Protocols with known numbers")
+    {
+        std::vector<std::unique_ptr<NumberProtocol>> protocols;
+        protocols.push_back(std::make_unique<Cycle>(Range(1, 10)));
+        protocols.push_back(std::make_unique<Cycle>(Range(21, 25)));
+        CopulaProducer instance(std::move(protocols),
+                                std::make_unique<GaussianGenerator>(),
+                                {{1.0, 0.9}, {0.9, 1.0}});
+
+        THEN("Each dimension holds exactly the numbers of its protocol, "
+             "reordered")
+        {
+            auto block = instance.getIntegerBlock(100);
+            bool exact = true;
+            for(int number = 1; number <= 10; number++) {
+                exact &= std::count(block[0].begin(), block[0].end(), number) ==
+                         10;
+            }
+            for(int number = 21; number <= 25; number++) {
+                exact &= std::count(block[1].begin(), block[1].end(), number) ==
+                         20;
+            }
+            REQUIRE(exact);
+        }
+    }
+
+    WHEN("Get and set params")
+    {
+        std::vector<std::unique_ptr<NumberProtocol>> protocols;
+        protocols.push_back(std::make_unique<Cycle>(Range(1, 3)));
+        protocols.push_back(
+            std::make_unique<Basic>(std::make_unique<UniformGenerator>()));
+        CopulaProducer instance(std::move(protocols),
+                                std::make_unique<UniformRealGenerator>(),
+                                1.0);
+
+        THEN("The params of each dimension are those of its protocol")
+        {
+            REQUIRE(instance.getNumberOfDimensions() == 2);
+            REQUIRE(instance.getParams(1).protocols.getActiveProtocol() ==
+                    NumberProtocol::Type::basic);
+            REQUIRE_THROWS_WITH(instance.getParams(2),
+                                "The dimension must be between 0 and 1");
+        }
+
+        THEN("Params are set on the protocol of the dimension")
+        {
+            NumberProtocolConfig cycleParams(
+                Range(4, 6),
+                NumberProtocolParams(CycleParams(false, false)));
+            instance.setParams(0, cycleParams);
+            REQUIRE(instance.getParams(0).getRange().start == 4);
+            REQUIRE_THROWS_AS(instance.setParams(1, cycleParams),
+                              std::invalid_argument);
+        }
+    }
+}
@@ -739,3 +739,125 @@ SCENARIO("Numbers::Cycle: Set params: with last returned number")
         }
     }
 }
+
+SCENARIO("Numbers::Cycle: value at step and seek")
+{
+    using namespace aleatoric;
+
+    GIVEN("Unidirectional, forward direction")
+    {
+        Cycle instance(Range(1, 3));
+
+        THEN("Values at steps are calculated without altering the cycle")
+        {
+            REQUIRE(instance.valueAt(0) == 1);
+            REQUIRE(instance.valueAt(2) == 3);
+            REQUIRE(instance.valueAt(3) == 1);
+            REQUIRE(instance.valueAt(3000001) == 2);
+            REQUIRE(instance.valueAt(-1) == 3);
+            REQUIRE(instance.getIntegerNumber() == 1);
+        }
+    }
+
+    GIVEN("Unidirectional, reverse direction")
+    {
+        Cycle instance(Range(1, 3), false, true);
+
+        THEN("Values at steps are as expected")
+        {
+            REQUIRE(instance.valueAt(0) == 3);
+            REQUIRE(instance.valueAt(2) == 1);
+            REQUIRE(instance.valueAt(4) == 2);
+        }
+    }
+
+    GIVEN("Bidirectional, forward direction")
+    {
+        Cycle instance(Range(1, 4), true, false);
+
+        THEN("Values at steps are as expected")
+        {
+            std::vector<int> expected {1, 2, 3, 4, 3, 2, 1, 2, 3, 4};
+            for(size_t i = 0; i < expected.size(); i++) {
+                REQUIRE(instance.valueAt(i) == expected[i]);
+            }
+        }
+    }
+
+    GIVEN("Bidirectional, reverse direction")
+    {
+        Cycle instance(Range(1, 4), true, true);
+
+        THEN("Values at steps are as expected")
+        {
+            std::vector<int> expected {4, 3, 2, 1, 2, 3, 4, 3, 2, 1};
+            for(size_t i = 0; i < expected.size(); i++) {
+                REQUIRE(instance.valueAt(i) == expected[i]);
+            }
+        }
+    }
+
+    WHEN("The cycle is moved to a step")
+    {
+        Cycle instance(Range(1, 4), true, false);
+        instance.getIntegerNumber();
+        instance.seek(1000005);
+
+        THEN("The next numbers continue from that step")
+        {
+            std::vector<int> expected {4, 3, 2, 1, 2};
+            for(auto &&i : expected) {
+                REQUIRE(instance.getIntegerNumber() == i);
+            }
+        }
+    }
+}
+
+SCENARIO("Numbers::Cycle: collections")
+{
+    using namespace aleatoric;
+
+    auto bidirectional = GENERATE(false, true);
+    auto reverseDirection = GENERATE(false, true);
+
+    Range range(-2, 3);
+    Cycle bulk(range, bidirectional, reverseDirection);
+    Cycle single(range, bidirectional, reverseDirection);
+
+    WHEN("Collections of varying size are requested")
+    {
+        THEN("They match the numbers returned one at a time")
+        {
+            for(int size : {0, 1, 4, 13, 2, 40}) {
+                auto collection = bulk.getIntegerCollection(size);
+                REQUIRE(collection.size() == static_cast<size_t>(size));
+
+                for(auto &&i : collection) {
+                    REQUIRE(i == single.getIntegerNumber());
+                }
+            }
+        }
+    }
+
+    WHEN("The range is changed after a collection is requested")
+    {
+        bulk.getIntegerCollection(4);
+        for(int i = 0; i < 4; i++) {
+            single.getIntegerNumber();
+        }
+
+        NumberProtocolConfig newParams(
+            Range(0, 6),
+            NumberProtocolParams(CycleParams(bidirectional, reverseDirection)));
+        bulk.setParams(newParams);
+        single.setParams(newParams);
+
+        THEN("The cycles continue identically")
+        {
+            auto collection = bulk.getDecimalCollection(20);
+            for(auto &&i : collection) {
+                REQUIRE(i == single.getDecimalNumber());
+            }
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#include "ExponentialGenerator.hpp"
+
+#include <catch2/catch.hpp>
+
+SCENARIO("ExponentialGenerator")
+{
+    using namespace aleatoric;
+
+    GIVEN("Default construction")
+    {
+        ExponentialGenerator instance;
+
+        THEN("Returned rate is 1")
+        {
+            REQUIRE(instance.getDistribution() == 1.0);
+        }
+
+        THEN("A rate that is not positive throws")
+        {
+            REQUIRE_THROWS_WITH(instance.setDistribution(0.0),
+                                "The rate must be greater than 0");
+        }
+    }
+
+    GIVEN("Construction with a rate")
+    {
+        ExponentialGenerator instance(4.0);
+
+        WHEN("Numbers are requested in bulk")
+        {
+            auto numbers = instance.getNumbers(200000);
+
+            THEN("They match the mean and tail of the distribution")
+            {
+                double sum = 0.0;
+                int beyondOne = 0;
+                bool noneNegative = true;
+                for(auto number : numbers) {
+                    sum += number;
+                    beyondOne += number > 1.0;
+                    noneNegative &= number >= 0.0;
+                }
+
+                REQUIRE(noneNegative);
+                REQUIRE(sum / numbers.size() == Approx(0.25).margin(0.003));
+                // e^-4
+                REQUIRE(beyondOne / 200000.0 ==
+                        Approx(0.0183).margin(0.0015));
+            }
+        }
+
+        WHEN("Set distribution")
+        {
+            instance.setDistribution(0.5);
+
+            THEN("Numbers follow the new rate")
+            {
+                double sum = 0.0;
+                for(int i = 0; i < 100000; i++) {
+                    sum += instance.getNumber();
+                }
+
+                REQUIRE(instance.getDistribution() == 0.5);
+                REQUIRE(sum / 100000 == Approx(2.0).margin(0.03));
+            }
+        }
+    }
+}
@@ -0,0 +1,87 @@
+#include "GaussianGenerator.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cmath>
+
+SCENARIO("GaussianGenerator: default constructor")
+{
+    using namespace aleatoric;
+
+    GaussianGenerator instance;
+
+    THEN("Returned distribution is a mean of 0 and standard deviation of 1")
+    {
+        auto distribution = instance.getDistribution();
+        REQUIRE(distribution.first == 0.0);
+        REQUIRE(distribution.second == 1.0);
+    }
+
+    WHEN("Set distribution with a standard deviation that is not positive")
+    {
+        THEN("Throws")
+        {
+            REQUIRE_THROWS_WITH(
+                instance.setDistribution(1.0, 0.0),
+                "The standard deviation must be greater than 0");
+            REQUIRE_THROWS_AS(instance.setDistribution(1.0, -1.0),
+                              std::invalid_argument);
+        }
+    }
+}
+
+SCENARIO("GaussianGenerator: numbers follow the distribution")
+{
+    using namespace aleatoric;
+
+    double mean = 5.0;
+    double standardDeviation = 2.0;
+    GaussianGenerator instance(mean, standardDeviation);
+
+    auto checkNumbers = [&](const std::vector<double> &numbers) {
+        double sum = 0.0;
+        double sumOfSquares = 0.0;
+        int withinOneDeviation = 0;
+        int beyondThreeDeviations = 0;
+
+        for(auto number : numbers) {
+            sum += number;
+            sumOfSquares += number * number;
+            auto deviations = std::abs(number - mean) / standardDeviation;
+            withinOneDeviation += deviations < 1.0;
+            beyondThreeDeviations += deviations > 3.0;
+        }
+
+        double size = numbers.size();
+        auto sampleMean = sum / size;
+        REQUIRE(sampleMean == Approx(mean).margin(0.03));
+        REQUIRE(std::sqrt(sumOfSquares / size - sampleMean * sampleMean) ==
+                Approx(standardDeviation).margin(0.03));
+        REQUIRE(withinOneDeviation / size == Approx(0.6827).margin(0.005));
+        REQUIRE(beyondThreeDeviations / size == Approx(0.0027).margin(0.0006));
+    };
+
+    WHEN("Numbers are requested one at a time")
+    {
+        std::vector<double> numbers(200000);
+        for(auto &&number : numbers) {
+            number = instance.getNumber();
+        }
+
+        THEN("They match the mean, deviation and shape of the distribution")
+        {
+            checkNumbers(numbers);
+        }
+    }
+
+    WHEN("Numbers are requested in bulk")
+    {
+        auto numbers = instance.getNumbers(200000);
+
+        THEN("They match the mean, deviation and shape of the distribution")
+        {
+            REQUIRE(numbers.size() == 200000);
+            checkNumbers(numbers);
+        }
+    }
+}
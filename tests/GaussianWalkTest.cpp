@@ -0,0 +1,234 @@
+#include "GaussianWalk.hpp"
+
+#include "GaussianGenerator.hpp"
+#include "GaussianGeneratorMock.hpp"
+
+#include <cmath>
+
+SCENARIO("Numbers::GaussianWalk: default constructor")
+{
+    using namespace aleatoric;
+
+    GaussianWalk instance(std::make_unique<GaussianGenerator>());
+
+    THEN("Params are set to defaults")
+    {
+        auto params = instance.getParams();
+        REQUIRE(params.getRange().start == 0);
+        REQUIRE(params.getRange().end == 1);
+        REQUIRE(params.protocols.getGaussianWalk().getDeviationFactor() ==
+                0.1);
+    }
+}
+
+SCENARIO("Numbers::GaussianWalk")
+{
+    using namespace aleatoric;
+
+    GIVEN("Construction: with an invalid deviation factor")
+    {
+        THEN("Throws")
+        {
+            REQUIRE_THROWS_AS(
+                GaussianWalk(std::make_unique<GaussianGenerator>(),
+                             Range(1, 10),
+                             1.1),
+                std::invalid_argument);
+        }
+    }
+
+    GIVEN("The generator is a mock")
+    {
+        auto generator = std::make_unique<GaussianGeneratorMock>();
+        auto generatorPointer = generator.get();
+
+        WHEN("The object is constructed")
+        {
+            THEN("The generator is set to the standard normal distribution")
+            {
+                REQUIRE_CALL(*generatorPointer, setDistribution(0.0, 1.0));
+                GaussianWalk(std::move(generator), Range(0, 100), 0.1);
+            }
+        }
+
+        WHEN("Numbers are requested")
+        {
+            ALLOW_CALL(*generatorPointer,
+                       setDistribution(ANY(double), ANY(double)));
+            GaussianWalk instance(std::move(generator), Range(0, 100), 0.1);
+
+            THEN("Each step is the generated number times the standard "
+                 "deviation, starting from the centre of the range")
+            {
+                REQUIRE_CALL(*generatorPointer, getNumber())
+                    .TIMES(2)
+                    .RETURN(1.5);
+                REQUIRE(instance.getDecimalNumber() == Approx(65.0));
+                REQUIRE(instance.getDecimalNumber() == Approx(80.0));
+            }
+
+            THEN("A step beyond the end of the range is reflected back into "
+                 "it")
+            {
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(7.0);
+                REQUIRE(instance.getDecimalNumber() == Approx(80.0));
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(-9.0);
+                REQUIRE(instance.getDecimalNumber() == Approx(10.0));
+            }
+        }
+    }
+
+    GIVEN("The object is constructed")
+    {
+        Range range(0, 1000);
+        GaussianWalk instance(std::make_unique<GaussianGenerator>(5.0, 3.0),
+                              range,
+                              0.01);
+
+        THEN("Steps are normally distributed with the standard deviation set "
+             "by the deviation factor")
+        {
+            // The mean absolute step of a normal distribution is its standard
+            // deviation * sqrt(2 / pi). The walk starts at the centre of the
+            // range so rarely meets its edges in this many steps.
+            auto previous = 500.0;
+            auto sumOfAbsoluteSteps = 0.0;
+            for(int i = 0; i < 2000; i++) {
+                auto number = instance.getDecimalNumber();
+                sumOfAbsoluteSteps += std::abs(number - previous);
+                previous = number;
+            }
+
+            REQUIRE(sumOfAbsoluteSteps / 2000 == Approx(7.98).margin(0.8));
+        }
+
+        THEN("Numbers stay within the range, singly and in collections")
+        {
+            bool inRange = true;
+
+            for(int i = 0; i < 1000; i++) {
+                inRange &= range.floatingPointIsInRange(
+                    instance.getDecimalNumber());
+                inRange &= range.numberIsInRange(instance.getIntegerNumber());
+            }
+            for(auto number : instance.getDecimalCollection(100000)) {
+                inRange &= range.floatingPointIsInRange(number);
+            }
+            for(auto number : instance.getIntegerCollection(100000)) {
+                inRange &= range.numberIsInRange(number);
+            }
+
+            REQUIRE(inRange);
+        }
+    }
+
+    GIVEN("A large deviation factor over a small range")
+    {
+        Range range(1, 3);
+        GaussianWalk instance(std::make_unique<GaussianGenerator>(),
+                              range,
+                              1.0);
+
+        THEN("Steps beyond the edges are reflected into the range")
+        {
+            auto numbers = instance.getIntegerCollection(10000);
+
+            bool inRange = true;
+            for(auto number : numbers) {
+                inRange &= range.numberIsInRange(number);
+            }
+
+            REQUIRE(inRange);
+            REQUIRE_THAT(numbers,
+                         Catch::VectorContains(1) && Catch::VectorContains(2) &&
+                             Catch::VectorContains(3));
+        }
+    }
+
+    GIVEN("A deviation factor of 0")
+    {
+        GaussianWalk instance(std::make_unique<GaussianGenerator>(),
+                              Range(0, 10),
+                              0.0);
+
+        THEN("The walk stays at the centre of the range")
+        {
+            REQUIRE(instance.getDecimalNumber() == 5.0);
+            REQUIRE(instance.getIntegerCollection(3) ==
+                    std::vector<int> {5, 5, 5});
+        }
+
+        WHEN("Set params with a range that excludes the last number")
+        {
+            instance.setParams(NumberProtocolConfig(
+                Range(100, 200),
+                NumberProtocolParams(GaussianWalkParams(0.0))));
+
+            THEN("The walk restarts from the centre of the new range")
+            {
+                REQUIRE(instance.getIntegerNumber() == 150);
+            }
+        }
+
+        WHEN("Set params with a range that includes the last number")
+        {
+            instance.setParams(NumberProtocolConfig(
+                Range(4, 20),
+                NumberProtocolParams(GaussianWalkParams(0.0))));
+
+            THEN("The walk continues from the last number")
+            {
+                REQUIRE(instance.getIntegerNumber() == 5);
+            }
+        }
+    }
+}
+
+SCENARIO("Numbers::GaussianWalk: params")
+{
+    using namespace aleatoric;
+
+    GaussianWalk instance(std::make_unique<GaussianGenerator>(),
+                          Range(1, 10),
+                          0.5);
+
+    WHEN("Get params")
+    {
+        auto params = instance.getParams();
+
+        THEN("Reflects object state")
+        {
+            REQUIRE(params.getRange().start == 1);
+            REQUIRE(params.getRange().end == 10);
+            REQUIRE(params.protocols.getGaussianWalk().getDeviationFactor() ==
+                    0.5);
+            REQUIRE(params.protocols.getActiveProtocol() ==
+                    NumberProtocol::Type::gaussianWalk);
+        }
+    }
+
+    WHEN("Set params")
+    {
+        THEN("An invalid deviation factor throws")
+        {
+            REQUIRE_THROWS_AS(
+                instance.setParams(NumberProtocolConfig(
+                    Range(1, 10),
+                    NumberProtocolParams(GaussianWalkParams(-0.1)))),
+                std::invalid_argument);
+        }
+
+        instance.setParams(NumberProtocolConfig(
+            Range(20, 30),
+            NumberProtocolParams(GaussianWalkParams(0.25))));
+
+        THEN("Object is updated")
+        {
+            auto params = instance.getParams();
+            REQUIRE(params.getRange().start == 20);
+            REQUIRE(params.getRange().end == 30);
+            REQUIRE(params.protocols.getGaussianWalk().getDeviationFactor() ==
+                    0.25);
+        }
+    }
+}
@@ -25,6 +25,20 @@ SCENARIO("TimeDomain::Geometric")
             }
         }
     }
+    GIVEN("The class is instantiated with an invalid collection size")
+    {
+        THEN("A standard invalid_argument exception is thrown")
+        {
+            REQUIRE_THROWS_WITH(
+                aleatoric::Geometric(aleatoric::Range(1, 2), 1),
+                "The collection size supplied must be equal to, or greater "
+                "than, 2");
+            REQUIRE_THROWS_WITH(
+                aleatoric::Geometric(aleatoric::Range(1, 2), -1),
+                "The collection size supplied must be equal to, or greater "
+                "than, 2");
+        }
+    }
     GIVEN("The class is instantiated such that whole number durations are "
           "produced")
     {
@@ -0,0 +1,165 @@
+#include "GranularWalkBank.hpp"
+
+#include "Range.hpp"
+
+#include <catch2/catch.hpp>
+#include <cmath>
+
+SCENARIO("Numbers::GranularWalkBank: default constructor")
+{
+    using namespace aleatoric;
+
+    GranularWalkBank instance(4);
+
+    THEN("Every voice has default params")
+    {
+        REQUIRE(instance.getNumberOfVoices() == 4);
+
+        for(int voice = 0; voice < 4; voice++) {
+            auto params = instance.getParams(voice);
+            REQUIRE(params.getRange().start == 0);
+            REQUIRE(params.getRange().end == 1);
+            REQUIRE(params.protocols.getGranularWalk().getDeviationFactor() ==
+                    1.0);
+        }
+    }
+}
+
+SCENARIO("Numbers::GranularWalkBank")
+{
+    using namespace aleatoric;
+
+    GIVEN("Construction: with invalid arguments")
+    {
+        THEN("A number of voices less than 1 throws")
+        {
+            REQUIRE_THROWS_AS(GranularWalkBank(0, Range(1, 10), 0.5),
+                              std::invalid_argument);
+        }
+
+        THEN("A deviation factor outside the unit interval throws")
+        {
+            REQUIRE_THROWS_AS(GranularWalkBank(2, Range(1, 10), 1.1),
+                              std::invalid_argument);
+        }
+    }
+
+    GIVEN("The object is constructed")
+    {
+        Range range(0, 100);
+        double deviationFactor = 0.05;
+        double maxStep = 5.0;
+        int numberOfVoices = 500;
+        GranularWalkBank instance(numberOfVoices, range, deviationFactor);
+
+        WHEN("The first step is taken")
+        {
+            instance.step();
+            auto numbers = instance.getDecimalNumbers();
+
+            THEN("Each voice selects from the whole range")
+            {
+                REQUIRE(static_cast<int>(numbers.size()) == numberOfVoices);
+
+                double lowest = 100.0;
+                double highest = 0.0;
+                for(auto &&number : numbers) {
+                    REQUIRE(range.floatingPointIsInRange(number));
+                    lowest = std::min(lowest, number);
+                    highest = std::max(highest, number);
+                }
+
+                REQUIRE(highest - lowest > maxStep * 2);
+            }
+        }
+
+        WHEN("Further steps are taken")
+        {
+            instance.step();
+
+            THEN("Each voice moves no further than the max step and stays "
+                 "within the range")
+            {
+                bool stepsWithinMaxStep = true;
+                bool numbersWithinRange = true;
+
+                for(int i = 0; i < 100; i++) {
+                    auto previous = instance.getDecimalNumbers();
+                    instance.step();
+                    auto current = instance.getDecimalNumbers();
+
+                    for(int voice = 0; voice < numberOfVoices; voice++) {
+                        stepsWithinMaxStep &=
+                            std::abs(current[voice] - previous[voice]) <=
+                            maxStep;
+                        numbersWithinRange &=
+                            range.floatingPointIsInRange(current[voice]);
+                    }
+                }
+
+                REQUIRE(stepsWithinMaxStep);
+                REQUIRE(numbersWithinRange);
+            }
+        }
+
+        WHEN("Params are set for a single voice")
+        {
+            instance.step();
+
+            Range newRange(1000, 1010);
+            instance.setParams(
+                1,
+                NumberProtocolConfig(
+                    newRange,
+                    NumberProtocolParams(GranularWalkParams(0.1))));
+
+            THEN("Only that voice's params are updated")
+            {
+                auto params = instance.getParams(1);
+                REQUIRE(params.getRange().start == newRange.start);
+                REQUIRE(params.getRange().end == newRange.end);
+                REQUIRE(
+                    params.protocols.getGranularWalk().getDeviationFactor() ==
+                    0.1);
+
+                auto otherParams = instance.getParams(0);
+                REQUIRE(otherParams.getRange().end == range.end);
+                REQUIRE(otherParams.protocols.getGranularWalk()
+                            .getDeviationFactor() == deviationFactor);
+            }
+
+            THEN("The voice walks within its new range with its new max step")
+            {
+                instance.step();
+                for(int i = 0; i < 100; i++) {
+                    auto previous = instance.getDecimalNumbers()[1];
+                    instance.step();
+                    auto current = instance.getDecimalNumbers()[1];
+
+                    REQUIRE(newRange.floatingPointIsInRange(current));
+                    REQUIRE(std::abs(current - previous) <= 1.0);
+                }
+            }
+        }
+
+        WHEN("Invalid params are set")
+        {
+            THEN("An invalid voice throws")
+            {
+                REQUIRE_THROWS_AS(instance.getParams(numberOfVoices),
+                                  std::invalid_argument);
+            }
+
+            THEN("An invalid deviation factor throws")
+            {
+                REQUIRE_THROWS_AS(
+                    instance.setParams(
+                        0,
+                        NumberProtocolConfig(
+                            range,
+                            NumberProtocolParams(GranularWalkParams(-0.1)))),
+                    std::invalid_argument);
+            }
+        }
+    }
+}
@@ -205,6 +205,15 @@ SCENARIO("Numbers::GroupedRepetition")
                     FORBID_CALL(*numberGeneratorPointer, getNumber());
                     instance.getIntegerNumber();
                 }
+
+                THEN("The series should not be checked for completion")
+                {
+                    FORBID_CALL(*groupingGeneratorPointer,
+                                getDistributionVector());
+                    FORBID_CALL(*numberGeneratorPointer,
+                                getDistributionVector());
+                    instance.getIntegerNumber();
+                }
             }
 
             AND_WHEN(
@@ -285,6 +294,73 @@ SCENARIO("Numbers::GroupedRepetition")
                 }
             }
         }
+
+        WHEN("A group is requested")
+        {
+            THEN("It returns the generated number with the range offset added "
+                 "and the grouping selected")
+            {
+                REQUIRE_CALL(*numberGeneratorPointer, getNumber()).RETURN(2);
+                auto group = instance.getGroup();
+                REQUIRE(group.number == 2 + range.offset);
+                REQUIRE(group.count == 2);
+            }
+
+            AND_WHEN("A number has already been requested from the grouping")
+            {
+                instance.getIntegerNumber();
+
+                THEN("It returns the remainder of the grouping without calling "
+                     "the generators")
+                {
+                    FORBID_CALL(*groupingGeneratorPointer, getNumber());
+                    FORBID_CALL(*numberGeneratorPointer, getNumber());
+                    auto group = instance.getGroup();
+                    REQUIRE(group.number == range.offset);
+                    REQUIRE(group.count == 1);
+                }
+            }
+
+            AND_WHEN("The group has been returned")
+            {
+                instance.getGroup();
+
+                THEN("The next request starts a new grouping")
+                {
+                    REQUIRE_CALL(*groupingGeneratorPointer, getNumber())
+                        .RETURN(0);
+                    REQUIRE_CALL(*numberGeneratorPointer, getNumber())
+                        .RETURN(0);
+                    instance.getIntegerNumber();
+                }
+            }
+        }
+
+        WHEN("A collection is requested")
+        {
+            THEN("The generators are called once per grouping")
+            {
+                REQUIRE_CALL(*groupingGeneratorPointer, getNumber())
+                    .RETURN(0)
+                    .TIMES(3);
+                REQUIRE_CALL(*numberGeneratorPointer, getNumber())
+                    .RETURN(1)
+                    .TIMES(3);
+
+                auto collection = instance.getIntegerCollection(5);
+
+                REQUIRE(collection == std::vector<int>(5, 1 + range.offset));
+            }
+
+            THEN("A grouping left incomplete is continued by the next request")
+            {
+                instance.getIntegerCollection(3);
+
+                FORBID_CALL(*groupingGeneratorPointer, getNumber());
+                FORBID_CALL(*numberGeneratorPointer, getNumber());
+                instance.getIntegerNumber();
+            }
+        }
     }
 }
 
@@ -0,0 +1,215 @@
+#include "InterpolatingProducer.hpp"
+
+#include "Range.hpp"
+
+#include <catch2/catch.hpp>
+#include <cmath>
+
+namespace {
+// Cycle over 0 to 3 produces the targets 0, 1, 2, 3, 0, 1 ...
+std::unique_ptr<aleatoric::NumberProtocol> createCycle()
+{
+    using namespace aleatoric;
+
+    auto protocol = NumberProtocol::create(NumberProtocol::Type::cycle);
+    protocol->setParams(NumberProtocolConfig(
+        Range(0, 3),
+        NumberProtocolParams(CycleParams(false, false))));
+    return protocol;
+}
+} // namespace
+
+SCENARIO("InterpolatingProducer")
+{
+    using namespace aleatoric;
+    using Interpolation = InterpolatingProducer::Interpolation;
+
+    GIVEN("Construction: with invalid samples per step")
+    {
+        THEN("A standard invalid_argument exception is thrown")
+        {
+            REQUIRE_THROWS_WITH(
+                InterpolatingProducer(createCycle(), 0, Interpolation::linear),
+                "The number of samples per step must be greater than 0");
+        }
+    }
+
+    GIVEN("Linear interpolation")
+    {
+        InterpolatingProducer instance(createCycle(), 4, Interpolation::linear);
+
+        THEN("Samples move in straight lines between the targets")
+        {
+            auto block = instance.getBlock(12);
+            std::vector<double> expected {0.0,
+                                          0.25,
+                                          0.5,
+                                          0.75,
+                                          1.0,
+                                          1.25,
+                                          1.5,
+                                          1.75,
+                                          2.0,
+                                          2.25,
+                                          2.5,
+                                          2.75};
+
+            REQUIRE_THAT(block, Catch::Approx(expected));
+        }
+
+        THEN("Consecutive blocks join without discontinuity")
+        {
+            InterpolatingProducer reference(createCycle(),
+                                            4,
+                                            Interpolation::linear);
+            auto expected = reference.getBlock(20);
+
+            auto first = instance.getBlock(3);
+            auto second = instance.getBlock(6);
+            auto third = instance.getBlock(11);
+
+            std::vector<double> joined(first);
+            joined.insert(joined.end(), second.begin(), second.end());
+            joined.insert(joined.end(), third.begin(), third.end());
+
+            REQUIRE_THAT(joined, Catch::Approx(expected));
+        }
+
+        WHEN("The samples per step is changed")
+        {
+            instance.getBlock(2);
+            instance.setSamplesPerStep(2);
+
+            THEN("It takes effect from the next step")
+            {
+                REQUIRE(instance.getSamplesPerStep() == 2);
+                REQUIRE_THAT(instance.getBlock(6),
+                             Catch::Approx(std::vector<double> {
+                                 0.5, 0.75, 1.0, 1.5, 2.0, 2.5}));
+            }
+        }
+    }
+
+    GIVEN("Cosine interpolation")
+    {
+        InterpolatingProducer instance(createCycle(), 4, Interpolation::cosine);
+        auto block = instance.getBlock(8);
+
+        THEN("Each step starts on its target and passes through the midpoint")
+        {
+            REQUIRE(block[0] == Approx(0.0));
+            REQUIRE(block[2] == Approx(0.5));
+            REQUIRE(block[4] == Approx(1.0));
+            REQUIRE(block[6] == Approx(1.5));
+        }
+
+        THEN("It eases in and out of each target")
+        {
+            REQUIRE(block[1] < 0.25);
+            REQUIRE(block[3] > 0.75);
+        }
+    }
+
+    GIVEN("Cubic interpolation")
+    {
+        InterpolatingProducer instance(createCycle(), 4, Interpolation::cubic);
+        auto block = instance.getBlock(12);
+
+        THEN("Each step starts on its target")
+        {
+            REQUIRE(block[0] == Approx(0.0));
+            REQUIRE(block[4] == Approx(1.0));
+            REQUIRE(block[8] == Approx(2.0));
+        }
+
+        THEN("Targets in a straight line are joined by a straight line")
+        {
+            // the step from 1 to 2 lies between 0 and 3
+            REQUIRE_THAT(std::vector<double>(block.begin() + 4,
+                                             block.begin() + 8),
+                         Catch::Approx(std::vector<double> {
+                             1.0, 1.25, 1.5, 1.75}));
+        }
+
+        THEN("The interpolation can be changed")
+        {
+            instance.setInterpolation(Interpolation::linear);
+            REQUIRE(instance.getInterpolation() == Interpolation::linear);
+        }
+    }
+
+    GIVEN("A GranularWalk")
+    {
+        Range range(10, 20);
+        auto protocol =
+            NumberProtocol::create(NumberProtocol::Type::granularWalk);
+        protocol->setParams(NumberProtocolConfig(
+            range,
+            NumberProtocolParams(GranularWalkParams(0.2))));
+
+        InterpolatingProducer instance(std::move(protocol),
+                                       64,
+                                       Interpolation::cosine);
+
+        THEN("Params are those of the protocol")
+        {
+            auto params = instance.getParams();
+            REQUIRE(params.getRange().start == range.start);
+            REQUIRE(params.protocols.getActiveProtocol() ==
+                    NumberProtocol::Type::granularWalk);
+        }
+
+        THEN("Rendered samples stay within the range and move smoothly")
+        {
+            auto block = instance.getBlock(4096);
+
+            bool withinRange = true;
+            bool smooth = true;
+            for(size_t i = 0; i < block.size(); i++) {
+                withinRange &= range.floatingPointIsInRange(block[i]);
+                if(i > 0) {
+                    // a step covers at most 2 (0.2 of the range) over 64
+                    // samples, peaking at pi / 2 times the average rate
+                    smooth &= std::abs(block[i] - block[i - 1]) < 0.05;
+                }
+            }
+
+            REQUIRE(withinRange);
+            REQUIRE(smooth);
+        }
+    }
+
+    GIVEN("A Walk, rendered with a sample per step")
+    {
+        // With linear interpolation and a sample per step, each sample is
+        // a target
+        Range range(0, 100);
+        NumberProtocolConfig params(range,
+                                    NumberProtocolParams(WalkParams(5)));
+        auto protocol = NumberProtocol::create(NumberProtocol::Type::walk);
+        protocol->setParams(params);
+
+        InterpolatingProducer instance(std::move(protocol),
+                                       1,
+                                       Interpolation::linear);
+
+        WHEN("Params are set between blocks")
+        {
+            std::vector<double> targets;
+            for(int i = 0; i < 200; i++) {
+                auto block = instance.getBlock(3);
+                targets.insert(targets.end(), block.begin(), block.end());
+                instance.setParams(params);
+            }
+
+            THEN("Every target is within the maximum step of the last")
+            {
+                bool withinStep = true;
+                for(size_t i = 1; i < targets.size(); i++) {
+                    withinStep &= std::abs(targets[i] - targets[i - 1]) <= 5.0;
+                }
+                REQUIRE(withinStep);
+            }
+        }
+    }
+}
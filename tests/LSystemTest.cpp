@@ -0,0 +1,262 @@
+#include "LSystem.hpp"
+
+#include "DiscreteGenerator.hpp"
+#include "DiscreteGeneratorMock.hpp"
+#include "Range.hpp"
+
+#include <map>
+
+namespace {
+// Rewrites the whole sequence for each generation (deterministic productions)
+std::vector<int> expand(std::vector<int> sequence,
+                        std::map<int, std::vector<int>> productions,
+                        int generations)
+{
+    for(int i = 0; i < generations; i++) {
+        std::vector<int> next;
+        for(auto symbol : sequence) {
+            auto production = productions.find(symbol);
+            if(production == productions.end()) {
+                next.push_back(symbol);
+            } else {
+                next.insert(next.end(),
+                            production->second.begin(),
+                            production->second.end());
+            }
+        }
+        sequence = next;
+    }
+    return sequence;
+}
+} // namespace
+
+SCENARIO("Numbers::LSystem: default constructor")
+{
+    using namespace aleatoric;
+
+    LSystem instance(std::make_unique<DiscreteGenerator>());
+
+    THEN("Params are set to defaults")
+    {
+        auto params = instance.getParams();
+        REQUIRE(params.getRange().start == 0);
+        REQUIRE(params.getRange().end == 1);
+        auto lSystem = params.protocols.getLSystem();
+        REQUIRE(lSystem.getAxiom() == std::vector<int> {0});
+        REQUIRE(lSystem.getProductions().size() == 2);
+        REQUIRE(lSystem.getGenerations() == 8);
+    }
+
+    THEN("Numbers are the Fibonacci word")
+    {
+        auto expected = expand({0}, {{0, {0, 1}}, {1, {0}}}, 8);
+        auto size = static_cast<int>(expected.size());
+        REQUIRE(instance.getIntegerCollection(size) == expected);
+    }
+}
+
+SCENARIO("Numbers::LSystem")
+{
+    using namespace aleatoric;
+
+    GIVEN("Construction: with invalid params")
+    {
+        auto construct = [](std::vector<int> axiom,
+                            std::vector<Production> productions,
+                            int generations) {
+            LSystem(std::make_unique<DiscreteGenerator>(),
+                    Range(1, 5),
+                    LSystemParams(axiom, productions, generations));
+        };
+
+        THEN("Throws")
+        {
+            REQUIRE_THROWS_WITH(construct({}, {}, 1),
+                                "The axiom must contain at least one symbol");
+            REQUIRE_THROWS_WITH(construct({1}, {}, -1),
+                                "The number of generations must be 0 or "
+                                "greater");
+            REQUIRE_THROWS_WITH(construct({1}, {{1, {}, 1.0}}, 1),
+                                "Successors must contain at least one symbol");
+            REQUIRE_THROWS_WITH(construct({1}, {{1, {2}, 0.0}}, 1),
+                                "Production weights must be greater than 0");
+            REQUIRE_THROWS_WITH(construct({6}, {}, 1),
+                                "Symbols must be within the range");
+            REQUIRE_THROWS_WITH(construct({1}, {{0, {2}, 1.0}}, 1),
+                                "Symbols must be within the range");
+            REQUIRE_THROWS_WITH(construct({1}, {{1, {2, 6}, 1.0}}, 1),
+                                "Symbols must be within the range");
+        }
+    }
+
+    GIVEN("Deterministic productions")
+    {
+        Range range(1, 5);
+        std::vector<Production> productions {{1, {2, 3, 1}, 1.0},
+                                             {2, {4}, 1.0},
+                                             {3, {5, 1, 5}, 1.0},
+                                             {4, {3, 2}, 1.0}};
+        std::map<int, std::vector<int>> rules {
+            {1, {2, 3, 1}}, {2, {4}}, {3, {5, 1, 5}}, {4, {3, 2}}};
+
+        WHEN("The number of generations is 0")
+        {
+            LSystem instance(std::make_unique<DiscreteGenerator>(),
+                             range,
+                             LSystemParams({1, 5}, productions, 0));
+
+            THEN("Numbers are the axiom, repeated")
+            {
+                REQUIRE(instance.getIntegerCollection(6) ==
+                        std::vector<int> {1, 5, 1, 5, 1, 5});
+            }
+        }
+
+        WHEN("The number of generations is greater than 0")
+        {
+            LSystem instance(std::make_unique<DiscreteGenerator>(),
+                             range,
+                             LSystemParams({1, 5}, productions, 6));
+
+            THEN("Numbers are the rewritten sequence, with symbols without "
+                 "productions left in place, starting again when complete")
+            {
+                auto expected = expand({1, 5}, rules, 6);
+                auto repeated = expected;
+                repeated.insert(
+                    repeated.end(), expected.begin(), expected.end());
+                auto size = static_cast<int>(repeated.size());
+                REQUIRE(instance.getIntegerCollection(size) == repeated);
+            }
+
+            THEN("Decimal numbers are the same sequence")
+            {
+                auto expected = expand({1, 5}, rules, 6);
+                bool matches = true;
+                for(auto symbol : expected) {
+                    matches &= instance.getDecimalNumber() == symbol;
+                }
+                REQUIRE(matches);
+            }
+        }
+    }
+
+    GIVEN("A deep number of generations")
+    {
+        LSystem instance(
+            std::make_unique<DiscreteGenerator>(),
+            Range(0, 1),
+            LSystemParams({0}, {{0, {0, 1}, 1.0}, {1, {0}, 1.0}}, 1000));
+
+        THEN("Numbers are produced without building the sequence")
+        {
+            // Each generation of the Fibonacci word begins with the previous
+            auto expected = expand({0}, {{0, {0, 1}}, {1, {0}}}, 25);
+            auto size = static_cast<int>(expected.size());
+            REQUIRE(instance.getIntegerCollection(size) == expected);
+        }
+    }
+
+    GIVEN("Stochastic productions")
+    {
+        Range range(0, 2);
+        std::vector<Production> productions {{0, {1}, 1.0},
+                                             {1, {0, 0}, 1.0},
+                                             {0, {2}, 3.0}};
+
+        WHEN("The object is constructed with a mock generator")
+        {
+            auto generator = std::make_unique<DiscreteGeneratorMock>();
+            auto generatorPointer = generator.get();
+            LSystem instance(std::move(generator),
+                             range,
+                             LSystemParams({1}, productions, 2));
+
+            THEN("The distribution is set from the weights of the symbol's "
+                 "productions and the production chosen is used")
+            {
+                REQUIRE_CALL(*generatorPointer,
+                             setDistributionVector(std::vector<double> {1.0,
+                                                                        3.0}));
+                REQUIRE_CALL(*generatorPointer, getNumber())
+                    .TIMES(2)
+                    .RETURN(1);
+                REQUIRE(instance.getIntegerCollection(2) ==
+                        std::vector<int> {2, 2});
+            }
+        }
+
+        WHEN("The object is constructed with a generator")
+        {
+            LSystem instance(std::make_unique<DiscreteGenerator>(),
+                             range,
+                             LSystemParams({0}, productions, 1));
+
+            THEN("Productions are chosen in proportion to their weights")
+            {
+                int count = 0;
+                for(auto number : instance.getIntegerCollection(10000)) {
+                    count += number == 2;
+                }
+                REQUIRE(count / 10000.0 == Approx(0.75).margin(0.03));
+            }
+        }
+    }
+
+    WHEN("Get params")
+    {
+        LSystem instance(std::make_unique<DiscreteGenerator>(),
+                         Range(1, 10),
+                         LSystemParams({2, 3}, {{2, {3, 4}, 0.5}}, 4));
+        auto params = instance.getParams();
+
+        THEN("Reflects object state")
+        {
+            REQUIRE(params.getRange().start == 1);
+            REQUIRE(params.getRange().end == 10);
+            auto lSystem = params.protocols.getLSystem();
+            REQUIRE(lSystem.getAxiom() == std::vector<int> {2, 3});
+            REQUIRE(lSystem.getProductions().size() == 1);
+            REQUIRE(lSystem.getProductions()[0].predecessor == 2);
+            REQUIRE(lSystem.getProductions()[0].successor ==
+                    std::vector<int> {3, 4});
+            REQUIRE(lSystem.getProductions()[0].weight == 0.5);
+            REQUIRE(lSystem.getGenerations() == 4);
+            REQUIRE(params.protocols.getActiveProtocol() ==
+                    NumberProtocol::Type::lSystem);
+        }
+    }
+
+    WHEN("Set params")
+    {
+        LSystem instance(std::make_unique<DiscreteGenerator>(),
+                         Range(1, 10),
+                         LSystemParams({2}, {{2, {3, 2}, 1.0}}, 3));
+        instance.getIntegerCollection(5);
+
+        THEN("Invalid params throw and leave the object unchanged")
+        {
+            REQUIRE_THROWS_AS(instance.setParams(NumberProtocolConfig(
+                                  Range(20, 30),
+                                  NumberProtocolParams(
+                                      LSystemParams({2}, {}, 3)))),
+                              std::invalid_argument);
+            REQUIRE(instance.getParams().getRange().start == 1);
+        }
+
+        instance.setParams(NumberProtocolConfig(
+            Range(20, 30),
+            NumberProtocolParams(
+                LSystemParams({21}, {{21, {22, 23}, 1.0}}, 1))));
+
+        THEN("Object is updated and starts from the new axiom")
+        {
+            auto params = instance.getParams();
+            REQUIRE(params.getRange().start == 20);
+            REQUIRE(params.protocols.getLSystem().getAxiom() ==
+                    std::vector<int> {21});
+            REQUIRE(instance.getIntegerCollection(4) ==
+                    std::vector<int> {22, 23, 22, 23});
+        }
+    }
+}
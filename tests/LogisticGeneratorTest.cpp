@@ -0,0 +1,49 @@
+#include "LogisticGenerator.hpp"
+
+#include <catch2/catch.hpp>
+
+SCENARIO("LogisticGenerator")
+{
+    using namespace aleatoric;
+
+    GIVEN("Default construction")
+    {
+        LogisticGenerator instance;
+
+        THEN("Returned distribution is a location of 0 and scale of 1")
+        {
+            auto distribution = instance.getDistribution();
+            REQUIRE(distribution.first == 0.0);
+            REQUIRE(distribution.second == 1.0);
+        }
+
+        THEN("A scale that is not positive throws")
+        {
+            REQUIRE_THROWS_WITH(instance.setDistribution(0.0, -2.0),
+                                "The scale must be greater than 0");
+        }
+    }
+
+    GIVEN("Construction with a location and scale")
+    {
+        LogisticGenerator instance(-3.0, 0.5);
+
+        THEN("The mean and variance match the distribution")
+        {
+            auto numbers = instance.getNumbers(200000);
+
+            double sum = 0.0;
+            double sumOfSquares = 0.0;
+            for(auto number : numbers) {
+                sum += number;
+                sumOfSquares += number * number;
+            }
+
+            auto mean = sum / numbers.size();
+            REQUIRE(mean == Approx(-3.0).margin(0.01));
+            // scale squared * pi squared / 3
+            REQUIRE(sumOfSquares / numbers.size() - mean * mean ==
+                    Approx(0.8225).margin(0.02));
+        }
+    }
+}
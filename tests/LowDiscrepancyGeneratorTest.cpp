@@ -0,0 +1,122 @@
+#include "LowDiscrepancyGenerator.hpp"
+
+#include "NumberProtocol.hpp"
+#include "NumberProtocolParameters.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace {
+bool isPermutation(std::vector<int> numbers, int start, int end)
+{
+    std::vector<int> expected(end - start + 1);
+    std::iota(expected.begin(), expected.end(), start);
+    std::sort(numbers.begin(), numbers.end());
+    return numbers == expected;
+}
+} // namespace
+
+SCENARIO("LowDiscrepancyGenerator")
+{
+    using namespace aleatoric;
+    using Sequence = LowDiscrepancyGenerator::Sequence;
+
+    GIVEN("A range whose size is a power of the base")
+    {
+        LowDiscrepancyGenerator sobol(Sequence::sobol, 3, 1, 64);
+        LowDiscrepancyGenerator halton(Sequence::halton, 1, -40, 40);
+
+        THEN("Each run of that many numbers is a permutation of the range")
+        {
+            bool permutations = true;
+            for(int run = 0; run < 10; run++) {
+                std::vector<int> sobolNumbers;
+                for(int i = 0; i < 64; i++) {
+                    sobolNumbers.push_back(sobol.getNumber());
+                }
+                std::vector<int> haltonNumbers;
+                for(int i = 0; i < 81; i++) {
+                    haltonNumbers.push_back(halton.getNumber());
+                }
+                permutations &= isPermutation(sobolNumbers, 1, 64);
+                permutations &= isPermutation(haltonNumbers, -40, 40);
+            }
+            REQUIRE(permutations);
+        }
+    }
+
+    GIVEN("A range of any other size")
+    {
+        LowDiscrepancyGenerator instance(Sequence::sobol);
+        instance.setDistribution(0, 9);
+
+        THEN("Every number occurs close to equally often, far closer than "
+             "with UniformGenerator")
+        {
+            std::vector<int> counts(10, 0);
+            for(int i = 0; i < 1000; i++) {
+                counts[instance.getNumber()]++;
+            }
+            auto range = std::minmax_element(counts.begin(), counts.end());
+            REQUIRE(*range.second - *range.first <= 8);
+        }
+    }
+
+    GIVEN("The default range")
+    {
+        LowDiscrepancyGenerator instance(Sequence::halton);
+
+        THEN("Numbers alternate evenly between 0 and 1")
+        {
+            std::vector<int> numbers;
+            for(int i = 0; i < 100; i++) {
+                numbers.push_back(instance.getNumber());
+            }
+            REQUIRE(std::count(numbers.begin(), numbers.end(), 0) == 50);
+            REQUIRE(std::count(numbers.begin(), numbers.end(), 1) == 50);
+            REQUIRE(instance.getSequence() == Sequence::halton);
+            REQUIRE(instance.getDimension() == 0);
+        }
+
+        THEN("Skipping ahead moves along the sequence")
+        {
+            instance.skip(10);
+            REQUIRE(instance.getIndex() == 10);
+        }
+    }
+
+    GIVEN("Selected for a protocol made by NumberProtocol::create")
+    {
+        auto protocol = NumberProtocol::create(NumberProtocol::Type::basic,
+                                               NumberProtocol::Sampling::sobol);
+        protocol->setParams(NumberProtocolConfig(
+            Range(1, 128),
+            NumberProtocolParams(BasicParams())));
+
+        THEN("The protocol covers its range evenly")
+        {
+            REQUIRE(isPermutation(protocol->getIntegerCollection(128), 1, 128));
+        }
+    }
+
+    GIVEN("Selected for a protocol that does not select independent numbers")
+    {
+        THEN("NumberProtocol::create throws")
+        {
+            using Type = NumberProtocol::Type;
+            for(auto type : {Type::adjacentSteps, Type::walk, Type::markov}) {
+                REQUIRE_THROWS_WITH(
+                    NumberProtocol::create(type,
+                                           NumberProtocol::Sampling::halton),
+                    "Only the basic, granularWalk and tendencyMask protocols "
+                    "can use sobol or halton sampling");
+            }
+            REQUIRE_NOTHROW(
+                NumberProtocol::create(Type::walk,
+                                       NumberProtocol::Sampling::pseudoRandom));
+        }
+    }
+}
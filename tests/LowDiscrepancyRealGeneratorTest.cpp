@@ -0,0 +1,183 @@
+#include "LowDiscrepancyRealGenerator.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+namespace {
+// Whether each of the size equal parts of the range 0 to 1 holds exactly one
+// of the numbers
+bool isStratified(const std::vector<double> &numbers, int size)
+{
+    std::vector<int> counts(size, 0);
+    for(auto number : numbers) {
+        auto part = static_cast<int>(number * size);
+        if(part < 0 || part >= size) {
+            return false;
+        }
+        counts[part]++;
+    }
+    for(auto count : counts) {
+        if(count != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+SCENARIO("LowDiscrepancyRealGenerator")
+{
+    using namespace aleatoric;
+    using Sequence = LowDiscrepancyRealGenerator::Sequence;
+
+    GIVEN("Construction: with an invalid dimension")
+    {
+        THEN("Throws")
+        {
+            REQUIRE_THROWS_WITH(
+                LowDiscrepancyRealGenerator(Sequence::sobol, -1),
+                "The dimension must be between 0 and 15");
+            REQUIRE_THROWS_WITH(
+                LowDiscrepancyRealGenerator(Sequence::halton, 16),
+                "The dimension must be between 0 and 15");
+        }
+    }
+
+    GIVEN("A Sobol sequence")
+    {
+        THEN("In every dimension, the first 2^k numbers fall one into each of "
+             "2^k equal parts of the range")
+        {
+            bool stratified = true;
+            for(int dimension = 0; dimension < 16; dimension++) {
+                LowDiscrepancyRealGenerator instance(Sequence::sobol,
+                                                     dimension);
+                std::vector<double> numbers;
+                for(int i = 0; i < 1024; i++) {
+                    numbers.push_back(instance.getNumber());
+                }
+                stratified &= isStratified(numbers, 1024);
+                numbers.resize(256);
+                stratified &= isStratified(numbers, 256);
+            }
+            REQUIRE(stratified);
+        }
+
+        THEN("The first two dimensions together cover the unit square "
+             "evenly: every box of area 1 / 256 holds exactly one of the "
+             "first 256 points")
+        {
+            LowDiscrepancyRealGenerator first(Sequence::sobol, 0);
+            LowDiscrepancyRealGenerator second(Sequence::sobol, 1);
+            std::vector<double> xs;
+            std::vector<double> ys;
+            for(int i = 0; i < 256; i++) {
+                xs.push_back(first.getNumber());
+                ys.push_back(second.getNumber());
+            }
+
+            bool even = true;
+            for(int widthBits = 0; widthBits <= 8; widthBits++) {
+                int columns = 1 << widthBits;
+                int rows = 256 / columns;
+                std::vector<int> counts(256, 0);
+                for(int i = 0; i < 256; i++) {
+                    auto column = static_cast<int>(xs[i] * columns);
+                    auto row = static_cast<int>(ys[i] * rows);
+                    counts[row * columns + column]++;
+                }
+                for(auto count : counts) {
+                    even &= count == 1;
+                }
+            }
+            REQUIRE(even);
+        }
+
+        THEN("Instances are scrambled differently")
+        {
+            LowDiscrepancyRealGenerator first(Sequence::sobol);
+            LowDiscrepancyRealGenerator second(Sequence::sobol);
+            bool different = false;
+            for(int i = 0; i < 8; i++) {
+                different |= first.getNumber() != second.getNumber();
+            }
+            REQUIRE(different);
+        }
+    }
+
+    GIVEN("A Halton sequence")
+    {
+        THEN("The first b^k numbers fall one into each of b^k equal parts of "
+             "the range, where b is the base of the dimension")
+        {
+            LowDiscrepancyRealGenerator base2(Sequence::halton, 0);
+            LowDiscrepancyRealGenerator base3(Sequence::halton, 1);
+            LowDiscrepancyRealGenerator base53(Sequence::halton, 15);
+            std::vector<double> numbers2;
+            std::vector<double> numbers3;
+            std::vector<double> numbers53;
+            for(int i = 0; i < 2809; i++) {
+                numbers2.push_back(base2.getNumber());
+                numbers3.push_back(base3.getNumber());
+                numbers53.push_back(base53.getNumber());
+            }
+            numbers2.resize(2048);
+            numbers3.resize(2187);
+            REQUIRE(isStratified(numbers2, 2048));
+            REQUIRE(isStratified(numbers3, 2187));
+            REQUIRE(isStratified(numbers53, 2809));
+        }
+    }
+
+    GIVEN("Skipping ahead")
+    {
+        THEN("The sequence continues from the position skipped to")
+        {
+            for(auto sequence : {Sequence::sobol, Sequence::halton}) {
+                LowDiscrepancyRealGenerator instance(sequence);
+                instance.getNumber();
+                instance.skip(255);
+                REQUIRE(instance.getIndex() == 256);
+
+                // Points 256 to 511 are as evenly spread as the first 256
+                std::vector<double> numbers;
+                for(int i = 0; i < 256; i++) {
+                    numbers.push_back(instance.getNumber());
+                }
+                REQUIRE(isStratified(numbers, 256));
+                REQUIRE(instance.getIndex() == 512);
+            }
+
+            LowDiscrepancyRealGenerator instance(Sequence::sobol);
+            REQUIRE_THROWS_WITH(instance.skip(-1),
+                                "The count must be 0 or greater");
+        }
+    }
+
+    GIVEN("A range")
+    {
+        LowDiscrepancyRealGenerator instance(Sequence::halton, 2, -5.0, 5.0);
+
+        THEN("Numbers are within the range and the sequence position is kept "
+             "when it changes")
+        {
+            REQUIRE(instance.getDistribution().first == -5.0);
+            REQUIRE(instance.getDistribution().second == 5.0);
+            REQUIRE(instance.getSequence() == Sequence::halton);
+            REQUIRE(instance.getDimension() == 2);
+
+            bool inRange = true;
+            for(int i = 0; i < 1000; i++) {
+                auto number = instance.getNumber();
+                inRange &= number >= -5.0 && number < 5.0;
+            }
+            REQUIRE(inRange);
+
+            instance.setDistribution(10.0, 20.0);
+            REQUIRE(instance.getIndex() == 1000);
+            auto number = instance.getNumber();
+            REQUIRE((number >= 10.0 && number < 20.0));
+        }
+    }
+}
@@ -0,0 +1,266 @@
+#include "Markov.hpp"
+
+#include "Range.hpp"
+#include "UniformRealGenerator.hpp"
+
+#include <catch2/catch.hpp>
+
+SCENARIO("Numbers::Markov: default constructor")
+{
+    using namespace aleatoric;
+
+    Markov instance(std::make_unique<UniformRealGenerator>());
+
+    THEN("Params are set to defaults")
+    {
+        auto params = instance.getParams();
+        auto range = params.getRange();
+        auto transitions = params.protocols.getMarkov();
+
+        REQUIRE(range.start == 0);
+        REQUIRE(range.end == 1);
+        REQUIRE(transitions.getRowOffsets().empty());
+        REQUIRE(transitions.getColumns().empty());
+        REQUIRE(transitions.getWeights().empty());
+    }
+
+    THEN("With no transitions, numbers are selected from the whole range")
+    {
+        std::vector<int> set(1000);
+        for(auto &&i : set) {
+            i = instance.getIntegerNumber();
+        }
+
+        REQUIRE_THAT(set, Catch::VectorContains(0) && Catch::VectorContains(1));
+    }
+}
+
+SCENARIO("Numbers::Markov")
+{
+    using namespace aleatoric;
+
+    GIVEN("Construction: with an invalid transition matrix")
+    {
+        auto construct = [](std::vector<int> rowOffsets,
+                            std::vector<int> columns,
+                            std::vector<double> weights) {
+            Markov(std::make_unique<UniformRealGenerator>(),
+                   Range(1, 3),
+                   MarkovParams(rowOffsets, columns, weights));
+        };
+
+        THEN("Row offsets not matching the range size throw")
+        {
+            REQUIRE_THROWS_AS(construct({0, 1, 2}, {0, 1}, {1.0, 1.0}),
+                              std::invalid_argument);
+        }
+
+        THEN("Columns not matching the weights throw")
+        {
+            REQUIRE_THROWS_AS(construct({0, 1, 2, 2}, {0, 1}, {1.0}),
+                              std::invalid_argument);
+        }
+
+        THEN("Decreasing row offsets throw")
+        {
+            REQUIRE_THROWS_WITH(construct({0, 2, 1, 2}, {0, 1}, {1.0, 1.0}),
+                                "The row offsets must not decrease");
+        }
+
+        THEN("Columns outside the range throw")
+        {
+            REQUIRE_THROWS_WITH(construct({0, 1, 2, 2}, {0, 3}, {1.0, 1.0}),
+                                "Columns must be indices within the range");
+        }
+
+        THEN("Negative weights throw")
+        {
+            REQUIRE_THROWS_WITH(construct({0, 1, 2, 2}, {0, 1}, {1.0, -1.0}),
+                                "Weights must not be negative");
+        }
+
+        THEN("A row with transitions whose weights are all 0 throws")
+        {
+            REQUIRE_THROWS_WITH(
+                construct({0, 1, 2, 2}, {0, 1}, {1.0, 0.0}),
+                "The weights of a row with transitions must not all be 0");
+        }
+    }
+
+    GIVEN("Each state has a single transition")
+    {
+        // 10 -> 11 -> 12 -> 13 -> 10
+        Range range(10, 13);
+        Markov instance(std::make_unique<UniformRealGenerator>(),
+                        range,
+                        MarkovParams({0, 1, 2, 3, 4},
+                                     {1, 2, 3, 0},
+                                     {1, 1, 1, 1}));
+
+        THEN("The chain is followed deterministically after the first number")
+        {
+            auto previous = instance.getIntegerNumber();
+            for(int i = 0; i < 20; i++) {
+                auto number = instance.getIntegerNumber();
+                REQUIRE(number == (previous - range.offset + 1) % 4 +
+                                      range.offset);
+                previous = number;
+            }
+        }
+    }
+
+    GIVEN("A state with weighted transitions")
+    {
+        // 0 -> 1 (weight 3) or 2 (weight 1); 1 -> 0; 2 -> 0
+        Markov instance(std::make_unique<UniformRealGenerator>(),
+                        Range(0, 2),
+                        MarkovParams({0, 2, 3, 4}, {1, 2, 0, 0}, {3, 1, 1, 1}));
+
+        THEN("Transitions are selected in proportion to their weights")
+        {
+            int transitionsFromZero = 0;
+            int transitionsToOne = 0;
+            bool otherTransitionsToZero = true;
+            auto previous = instance.getIntegerNumber();
+
+            for(int i = 0; i < 8000; i++) {
+                auto number = instance.getIntegerNumber();
+                if(previous == 0) {
+                    transitionsFromZero++;
+                    transitionsToOne += number == 1;
+                } else {
+                    otherTransitionsToZero &= number == 0;
+                }
+                previous = number;
+            }
+
+            REQUIRE(otherTransitionsToZero);
+
+            auto proportion =
+                static_cast<double>(transitionsToOne) / transitionsFromZero;
+            REQUIRE(proportion == Approx(0.75).margin(0.05));
+        }
+    }
+
+    GIVEN("A state with no transitions")
+    {
+        // 0 -> 1; 1 has no transitions; 2 -> 1
+        Markov instance(std::make_unique<UniformRealGenerator>(),
+                        Range(0, 2),
+                        MarkovParams({0, 1, 1, 2}, {1, 1}, {1, 1}));
+
+        THEN("The number after it is selected from the whole range")
+        {
+            std::vector<int> numbersAfterOne;
+            auto previous = instance.getIntegerNumber();
+
+            for(int i = 0; i < 1000; i++) {
+                auto number = instance.getIntegerNumber();
+                if(previous == 1) {
+                    numbersAfterOne.push_back(number);
+                }
+                previous = number;
+            }
+
+            REQUIRE_THAT(numbersAfterOne,
+                         Catch::VectorContains(0) && Catch::VectorContains(1) &&
+                             Catch::VectorContains(2));
+        }
+    }
+
+    GIVEN("A large sparse state space")
+    {
+        // each state can move up 1, 2 or 3 states, wrapping around
+        int size = 10000;
+        std::vector<int> rowOffsets(size + 1);
+        std::vector<int> columns;
+        std::vector<double> weights;
+        for(int state = 0; state < size; state++) {
+            rowOffsets[state] = static_cast<int>(columns.size());
+            for(int step = 1; step <= 3; step++) {
+                columns.push_back((state + step) % size);
+                weights.push_back(step);
+            }
+        }
+        rowOffsets[size] = static_cast<int>(columns.size());
+
+        Markov instance(std::make_unique<UniformRealGenerator>(),
+                        Range(0, size - 1),
+                        MarkovParams(rowOffsets, columns, weights));
+
+        THEN("Only the transitions in the matrix occur")
+        {
+            bool transitionsValid = true;
+            auto previous = instance.getIntegerNumber();
+            for(int i = 0; i < 10000; i++) {
+                auto number = instance.getIntegerNumber();
+                auto step = (number - previous + size) % size;
+                transitionsValid &= step >= 1 && step <= 3;
+                previous = number;
+            }
+
+            REQUIRE(transitionsValid);
+        }
+    }
+}
+
+SCENARIO("Numbers::Markov: params")
+{
+    using namespace aleatoric;
+
+    MarkovParams transitions({0, 1, 2, 3}, {1, 2, 0}, {1, 1, 1});
+    Markov instance(std::make_unique<UniformRealGenerator>(),
+                    Range(1, 3),
+                    transitions);
+
+    WHEN("Get params")
+    {
+        auto params = instance.getParams();
+        auto returnedRange = params.getRange();
+
+        THEN("Reflects object state")
+        {
+            REQUIRE(returnedRange.start == 1);
+            REQUIRE(returnedRange.end == 3);
+            REQUIRE(params.protocols.getMarkov().getRowOffsets() ==
+                    transitions.getRowOffsets());
+            REQUIRE(params.protocols.getMarkov().getColumns() ==
+                    transitions.getColumns());
+            REQUIRE(params.protocols.getMarkov().getWeights() ==
+                    transitions.getWeights());
+            REQUIRE(params.protocols.getActiveProtocol() ==
+                    NumberProtocol::Type::markov);
+        }
+    }
+
+    WHEN("Set params with a range that includes the last number")
+    {
+        auto lastNumber = instance.getIntegerNumber();
+
+        // every state moves down one, wrapping around, over 0 to 4
+        Range newRange(0, 4);
+        instance.setParams(NumberProtocolConfig(
+            newRange,
+            NumberProtocolParams(MarkovParams({0, 1, 2, 3, 4, 5},
+                                              {4, 0, 1, 2, 3},
+                                              {1, 1, 1, 1, 1}))));
+
+        THEN("The new chain continues from the last number")
+        {
+            REQUIRE(instance.getIntegerNumber() == lastNumber - 1);
+        }
+    }
+
+    WHEN("Set params: invalid matrix")
+    {
+        NumberProtocolConfig newParams(
+            Range(4, 6),
+            NumberProtocolParams(MarkovParams({0, 1}, {0}, {1})));
+
+        THEN("Throw exception")
+        {
+            REQUIRE_THROWS_AS(instance.setParams(newParams),
+                              std::invalid_argument);
+        }
+    }
+}
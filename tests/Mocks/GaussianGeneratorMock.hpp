@@ -0,0 +1,20 @@
+#ifndef GaussianGeneratorMock_hpp
+#define GaussianGeneratorMock_hpp
+
+#include "IGaussianGenerator.hpp"
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+class GaussianGeneratorMock : public aleatoric::IGaussianGenerator {
+  public:
+    // An alias, as the comma in std::pair would split the macro arguments
+    using Distribution = std::pair<double, double>;
+
+    MAKE_MOCK0(getNumber, double(), override);
+    MAKE_MOCK2(getNumbers, void(double *, int), override);
+    MAKE_MOCK2(setDistribution, void(double, double), override);
+    MAKE_MOCK0(getDistribution, Distribution(), override);
+};
+
+#endif /* GaussianGeneratorMock_hpp */
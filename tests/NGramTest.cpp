@@ -0,0 +1,236 @@
+#include "NGram.hpp"
+
+#include "Range.hpp"
+#include "UniformGenerator.hpp"
+#include "UniformGeneratorMock.hpp"
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+
+SCENARIO("Numbers::NGram: default constructor")
+{
+    using namespace aleatoric;
+
+    NGram instance(std::make_unique<UniformGenerator>());
+
+    THEN("Params are set to defaults")
+    {
+        auto params = instance.getParams();
+        auto range = params.getRange();
+
+        REQUIRE(range.start == 0);
+        REQUIRE(range.end == 1);
+        REQUIRE(params.protocols.getNGram().getOrder() == 1);
+        REQUIRE(params.protocols.getNGram().getCorpus().empty());
+    }
+
+    THEN("With an empty corpus, numbers are selected from the whole range")
+    {
+        std::vector<int> set(1000);
+        for(auto &&i : set) {
+            i = instance.getIntegerNumber();
+        }
+
+        REQUIRE_THAT(set, Catch::VectorContains(0) && Catch::VectorContains(1));
+    }
+}
+
+SCENARIO("Numbers::NGram")
+{
+    using namespace aleatoric;
+
+    GIVEN("Construction: with invalid params")
+    {
+        THEN("An order outside 1 to 8 throws")
+        {
+            REQUIRE_THROWS_WITH(NGram(std::make_unique<UniformGenerator>(),
+                                      Range(1, 4),
+                                      NGramParams(0, {{1, 2}})),
+                                "The order must be between 1 and 8");
+            REQUIRE_THROWS_AS(NGram(std::make_unique<UniformGenerator>(),
+                                    Range(1, 4),
+                                    NGramParams(9, {{1, 2}})),
+                              std::invalid_argument);
+        }
+
+        THEN("A corpus with numbers outside the range throws")
+        {
+            REQUIRE_THROWS_WITH(
+                NGram(std::make_unique<UniformGenerator>(),
+                      Range(1, 4),
+                      NGramParams(1, {{1, 2}, {3, 5}})),
+                "Every number in the corpus must be within the range");
+        }
+    }
+
+    GIVEN("The object is constructed")
+    {
+        auto generator = std::make_unique<UniformGeneratorMock>();
+        auto generatorPointer = generator.get();
+        ALLOW_CALL(*generatorPointer, setDistribution(ANY(int), ANY(int)));
+        ALLOW_CALL(*generatorPointer, getNumber()).RETURN(0);
+
+        // 10 occurs 3 times, 11 twice and 12 once. 10 is followed by 11 twice
+        // and 12 once. 11 is always followed by 10.
+        Range range(10, 12);
+        NGram instance(std::move(generator),
+                       range,
+                       NGramParams(1, {{10, 11, 10, 11, 10, 12}}));
+
+        WHEN("The first number is requested")
+        {
+            THEN("It is selected in proportion to the count of each number in "
+                 "the corpus")
+            {
+                REQUIRE_CALL(*generatorPointer, setDistribution(0, 5));
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(3);
+                REQUIRE(instance.getIntegerNumber() == 11);
+            }
+        }
+
+        WHEN("A number follows a context in the corpus")
+        {
+            REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(0);
+            instance.getIntegerNumber(); // 10
+
+            THEN("It is selected in proportion to the count of each number "
+                 "that followed the context")
+            {
+                REQUIRE_CALL(*generatorPointer, setDistribution(0, 2));
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(2);
+                REQUIRE(instance.getIntegerNumber() == 12);
+            }
+        }
+
+        WHEN("A number follows a context that ends the corpus")
+        {
+            REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(5);
+            instance.getIntegerNumber(); // 12
+
+            THEN("It backs off to the count of each number in the corpus")
+            {
+                REQUIRE_CALL(*generatorPointer, setDistribution(0, 5));
+                instance.getIntegerNumber();
+            }
+        }
+    }
+
+    GIVEN("A higher order")
+    {
+        // with one number of context, 2 is followed by 3 or 5. With two, it
+        // depends on the number before the 2.
+        NGram instance(std::make_unique<UniformGenerator>(),
+                       Range(1, 5),
+                       NGramParams(2, {{1, 2, 3}, {4, 2, 5}}));
+
+        THEN("The longer context determines the number selected")
+        {
+            bool followsContext = true;
+            int contextsFound = 0;
+
+            auto beforeLast = instance.getIntegerNumber();
+            auto last = instance.getIntegerNumber();
+            for(int i = 0; i < 1000; i++) {
+                auto number = instance.getIntegerNumber();
+                if(last == 2 && beforeLast == 1) {
+                    followsContext &= number == 3;
+                    contextsFound++;
+                }
+                if(last == 2 && beforeLast == 4) {
+                    followsContext &= number == 5;
+                    contextsFound++;
+                }
+                beforeLast = last;
+                last = number;
+            }
+
+            REQUIRE(contextsFound > 0);
+            REQUIRE(followsContext);
+        }
+    }
+
+    GIVEN("A large range and the highest order")
+    {
+        Range range(0, 4999);
+        std::vector<int> sequence(20000);
+        UniformGenerator corpusGenerator(range.start, range.end);
+        for(auto &&i : sequence) {
+            i = corpusGenerator.getNumber();
+        }
+
+        NGram instance(std::make_unique<UniformGenerator>(),
+                       range,
+                       NGramParams(8, {sequence}));
+
+        THEN("Numbers continue runs of the corpus")
+        {
+            // every number in a random corpus of this size almost certainly
+            // has a single continuation, so after the first number the corpus
+            // is reproduced until its end
+            instance.getIntegerNumber();
+            std::vector<int> set(100);
+            for(auto &&i : set) {
+                i = instance.getIntegerNumber();
+            }
+
+            auto found = std::search(sequence.begin(),
+                                     sequence.end(),
+                                     set.begin(),
+                                     set.begin() + 5);
+            REQUIRE(found != sequence.end());
+        }
+    }
+}
+
+SCENARIO("Numbers::NGram: params")
+{
+    using namespace aleatoric;
+
+    std::vector<std::vector<int>> corpus {{1, 2, 3}, {3, 2, 1}};
+    NGram instance(std::make_unique<UniformGenerator>(),
+                   Range(1, 3),
+                   NGramParams(2, corpus));
+
+    WHEN("Get params")
+    {
+        auto params = instance.getParams();
+        auto returnedRange = params.getRange();
+
+        THEN("Reflects object state")
+        {
+            REQUIRE(returnedRange.start == 1);
+            REQUIRE(returnedRange.end == 3);
+            REQUIRE(params.protocols.getNGram().getOrder() == 2);
+            REQUIRE(params.protocols.getNGram().getCorpus() == corpus);
+            REQUIRE(params.protocols.getActiveProtocol() ==
+                    NumberProtocol::Type::nGram);
+        }
+    }
+
+    WHEN("Set params")
+    {
+        Range newRange(7, 9);
+        std::vector<std::vector<int>> newCorpus {{7, 8, 9, 7, 8, 9}};
+        instance.setParams(NumberProtocolConfig(
+            newRange,
+            NumberProtocolParams(NGramParams(1, newCorpus))));
+
+        THEN("Object is updated")
+        {
+            auto params = instance.getParams();
+            REQUIRE(params.getRange().start == newRange.start);
+            REQUIRE(params.protocols.getNGram().getOrder() == 1);
+            REQUIRE(params.protocols.getNGram().getCorpus() == newCorpus);
+        }
+
+        THEN("Numbers are produced from the new corpus")
+        {
+            auto previous = instance.getIntegerNumber();
+            for(int i = 0; i < 10; i++) {
+                auto number = instance.getIntegerNumber();
+                REQUIRE(number == (previous - 7 + 1) % 3 + 7);
+                previous = number;
+            }
+        }
+    }
+}
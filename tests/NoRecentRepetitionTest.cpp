@@ -0,0 +1,240 @@
+#include "NoRecentRepetition.hpp"
+
+#include "Range.hpp"
+#include "UniformGenerator.hpp"
+#include "UniformGeneratorMock.hpp"
+
+#include <catch2/catch.hpp>
+#include <catch2/trompeloeil.hpp>
+#include <vector>
+
+namespace {
+// Whether no number recurs within window numbers of its last occurrence
+bool keepsWindow(const std::vector<int> &set, int window)
+{
+    for(size_t i = 0; i < set.size(); i++) {
+        for(size_t j = i + 1; j < set.size() && j <= i + window; j++) {
+            if(set[i] == set[j]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+} // namespace
+
+SCENARIO("Numbers::NoRecentRepetition: default constructor")
+{
+    using namespace aleatoric;
+
+    NoRecentRepetition instance(std::make_unique<UniformGenerator>());
+
+    THEN("Params are set to defaults")
+    {
+        auto params = instance.getParams();
+        auto range = params.getRange();
+
+        REQUIRE(range.start == 0);
+        REQUIRE(range.end == 1);
+        REQUIRE(params.protocols.getNoRecentRepetition().getWindow() == 1);
+    }
+
+    THEN("Set should have no direct repetition")
+    {
+        std::vector<int> set(1000);
+        for(auto &&i : set) {
+            i = instance.getIntegerNumber();
+        }
+        REQUIRE(keepsWindow(set, 1));
+    }
+}
+
+SCENARIO("Numbers::NoRecentRepetition")
+{
+    using namespace aleatoric;
+
+    GIVEN("Construction: with invalid params")
+    {
+        THEN("Throws")
+        {
+            REQUIRE_THROWS_WITH(
+                NoRecentRepetition(std::make_unique<UniformGenerator>(),
+                                   Range(1, 4),
+                                   -1),
+                "The window must be between 0 and one less than the size of "
+                "the range");
+            REQUIRE_THROWS_WITH(
+                NoRecentRepetition(std::make_unique<UniformGenerator>(),
+                                   Range(1, 4),
+                                   4),
+                "The window must be between 0 and one less than the size of "
+                "the range");
+        }
+    }
+
+    GIVEN("The object is constructed")
+    {
+        auto generator = std::make_unique<UniformGeneratorMock>();
+        auto generatorPointer = generator.get();
+
+        Range range(1, 5);
+
+        WHEN("The object is constructed")
+        {
+            THEN("The generator selects from the whole range")
+            {
+                REQUIRE_CALL(*generatorPointer,
+                             setDistribution(0, range.size - 1));
+                NoRecentRepetition(std::move(generator), range, 2);
+            }
+        }
+
+        WHEN("Numbers are requested")
+        {
+            ALLOW_CALL(*generatorPointer, setDistribution(ANY(int), ANY(int)));
+            NoRecentRepetition instance(std::move(generator), range, 2);
+
+            THEN("The generator selects from one fewer numbers each time "
+                 "until the window is full")
+            {
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(1);
+                REQUIRE_CALL(*generatorPointer,
+                             setDistribution(0, range.size - 2));
+                REQUIRE(instance.getIntegerNumber() == 2);
+
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(1);
+                REQUIRE_CALL(*generatorPointer,
+                             setDistribution(0, range.size - 3));
+                REQUIRE(instance.getIntegerNumber() == 5);
+
+                FORBID_CALL(*generatorPointer,
+                            setDistribution(ANY(int), ANY(int)));
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(0);
+                REQUIRE(instance.getIntegerNumber() == 1);
+            }
+
+            THEN("Once the window is full, the oldest number in it can be "
+                 "selected again")
+            {
+                // Each oldest number takes the place of the number selected,
+                // so the same generated index cycles through three numbers
+                ALLOW_CALL(*generatorPointer, getNumber()).RETURN(1);
+                std::vector<int> expected {2, 5, 4, 2, 5, 4};
+                std::vector<int> set(expected.size());
+                for(auto &&i : set) {
+                    i = instance.getIntegerNumber();
+                }
+                REQUIRE(set == expected);
+            }
+        }
+    }
+
+    GIVEN("A range of windows")
+    {
+        Range range(1, 8);
+
+        THEN("No number recurs within the window, and every other number is "
+             "selected")
+        {
+            for(int window = 0; window < range.size; window++) {
+                NoRecentRepetition instance(
+                    std::make_unique<UniformGenerator>(),
+                    range,
+                    window);
+                std::vector<int> set(2000);
+                std::vector<int> counts(range.size, 0);
+                for(auto &&i : set) {
+                    i = instance.getIntegerNumber();
+                    counts[i - range.offset]++;
+                }
+                REQUIRE(keepsWindow(set, window));
+                for(auto &&count : counts) {
+                    REQUIRE(count > 100);
+                }
+            }
+        }
+
+        THEN("The largest window repeats the first numbers selected")
+        {
+            NoRecentRepetition instance(std::make_unique<UniformGenerator>(),
+                                        range,
+                                        range.size - 1);
+            std::vector<int> set(range.size * 10);
+            bool repeats = true;
+            for(size_t i = 0; i < set.size(); i++) {
+                set[i] = instance.getIntegerNumber();
+                if(i >= static_cast<size_t>(range.size)) {
+                    repeats &= set[i] == set[i - range.size];
+                }
+            }
+            REQUIRE(repeats);
+        }
+    }
+}
+
+SCENARIO("Numbers::NoRecentRepetition: params")
+{
+    using namespace aleatoric;
+
+    NoRecentRepetition instance(std::make_unique<UniformGenerator>(),
+                                Range(1, 10),
+                                3);
+
+    WHEN("get params")
+    {
+        THEN("should match state of the object")
+        {
+            auto params = instance.getParams();
+            auto returnedRange = params.getRange();
+            REQUIRE(returnedRange.start == 1);
+            REQUIRE(returnedRange.end == 10);
+            REQUIRE(params.protocols.getActiveProtocol() ==
+                    NumberProtocol::Type::noRecentRepetition);
+            REQUIRE(params.protocols.getNoRecentRepetition().getWindow() == 3);
+        }
+    }
+
+    WHEN("set params")
+    {
+        Range newRange(20, 25);
+        NumberProtocolConfig newParams(
+            newRange,
+            NumberProtocolParams(NoRecentRepetitionParams(5)));
+        instance.setParams(newParams);
+
+        THEN("object state should be updated")
+        {
+            auto params = instance.getParams();
+            auto returnedRange = params.getRange();
+            REQUIRE(returnedRange.start == newRange.start);
+            REQUIRE(returnedRange.end == newRange.end);
+            REQUIRE(params.protocols.getNoRecentRepetition().getWindow() == 5);
+        }
+
+        THEN("Numbers are within the new range and keep the new window")
+        {
+            std::vector<int> set(1000);
+            bool inRange = true;
+            for(auto &&i : set) {
+                i = instance.getIntegerNumber();
+                inRange &= newRange.numberIsInRange(i);
+            }
+            REQUIRE(inRange);
+            REQUIRE(keepsWindow(set, 5));
+        }
+    }
+
+    WHEN("set params: invalid")
+    {
+        THEN("Throws and leaves the params unchanged")
+        {
+            NumberProtocolConfig newParams(
+                Range(1, 3),
+                NumberProtocolParams(NoRecentRepetitionParams(3)));
+            REQUIRE_THROWS_WITH(instance.setParams(newParams),
+                                "The window must be between 0 and one less "
+                                "than the size of the range");
+            REQUIRE(instance.getParams().getRange().end == 10);
+        }
+    }
+}
@@ -1,8 +1,8 @@
 #include "NoRepetition.hpp"
 
-#include "DiscreteGenerator.hpp"
-#include "DiscreteGeneratorMock.hpp"
 #include "Range.hpp"
+#include "UniformGenerator.hpp"
+#include "UniformGeneratorMock.hpp"
 
 #include <catch2/catch.hpp>
 #include <catch2/trompeloeil.hpp>
@@ -11,7 +11,7 @@ SCENARIO("Numbers::NoRepetition: default constructor")
 {
     using namespace aleatoric;
 
-    NoRepetition instance(std::make_unique<DiscreteGenerator>());
+    NoRepetition instance(std::make_unique<UniformGenerator>());
 
     std::vector<int> set(1000);
     for(auto &&i : set) {
@@ -52,17 +52,17 @@ SCENARIO("Numbers::NoRepetition")
 
     GIVEN("Construction")
     {
-        auto generator = std::make_unique<DiscreteGeneratorMock>();
+        auto generator = std::make_unique<UniformGeneratorMock>();
         auto generatorPointer = generator.get();
 
         Range range(1, 3);
 
         WHEN("The object is constructed")
         {
-            THEN("The generator distribution is set to the range size")
+            THEN("The generator distribution is set to the range")
             {
                 REQUIRE_CALL(*generatorPointer,
-                             setDistributionVector(range.size, 1.0));
+                             setDistribution(range.start, range.end));
                 NoRepetition(std::move(generator), range);
             }
         }
@@ -70,48 +70,56 @@ SCENARIO("Numbers::NoRepetition")
 
     GIVEN("The object is constructed")
     {
-        int generatedNumber = 1;
-
-        auto generator = std::make_unique<DiscreteGeneratorMock>();
+        auto generator = std::make_unique<UniformGeneratorMock>();
         auto generatorPointer = generator.get();
 
-        ALLOW_CALL(*generatorPointer, updateDistributionVector(1.0));
-        ALLOW_CALL(*generatorPointer, updateDistributionVector(ANY(int), 0.0));
-        ALLOW_CALL(*generatorPointer, setDistributionVector(ANY(int), 1.0));
+        ALLOW_CALL(*generatorPointer, setDistribution(ANY(int), ANY(int)));
 
-        Range range(1, 3);
+        Range range(1, 4);
 
         NoRepetition instance(std::move(generator), range);
 
-        WHEN("A number is requested")
+        WHEN("The first number is requested")
         {
-            THEN("It should request a number from the generator")
+            THEN("It should return the generated number")
+            {
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(2);
+                REQUIRE(instance.getIntegerNumber() == 2);
+            }
+
+            THEN("The generator should be set to select from one fewer "
+                 "numbers than the range size")
             {
-                REQUIRE_CALL(*generatorPointer, getNumber())
-                    .RETURN(generatedNumber);
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(2);
+                REQUIRE_CALL(*generatorPointer,
+                             setDistribution(0, range.size - 2));
                 instance.getIntegerNumber();
             }
+        }
 
-            THEN("It should return the generated number with the range offset "
-                 "applied")
+        WHEN("There is a last number returned")
+        {
+            REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(2);
+            instance.getIntegerNumber();
+
+            THEN("A generated index below that of the last number is "
+                 "returned with the range offset applied")
             {
-                REQUIRE_CALL(*generatorPointer, getNumber())
-                    .RETURN(generatedNumber);
-                auto returnedNumber = instance.getIntegerNumber();
-                REQUIRE(returnedNumber == generatedNumber + range.offset);
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(0);
+                REQUIRE(instance.getIntegerNumber() == 1);
             }
 
-            THEN("It should ensure that the generated number cannot be "
-                 "selected at the next time of asking whilst ensuring all "
-                 "others have "
-                 "equal probability of being selected")
+            THEN("A generated index at or above that of the last number "
+                 "skips over the last number")
             {
-                REQUIRE_CALL(*generatorPointer, getNumber())
-                    .RETURN(generatedNumber);
-                REQUIRE_CALL(*generatorPointer, updateDistributionVector(1.0));
-                REQUIRE_CALL(*generatorPointer,
-                             updateDistributionVector(generatedNumber, 0.0));
-                instance.getIntegerNumber();
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(1);
+                REQUIRE(instance.getIntegerNumber() == 3);
+            }
+
+            THEN("The top generated index maps to the end of the range")
+            {
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(2);
+                REQUIRE(instance.getIntegerNumber() == range.end);
             }
         }
     }
@@ -121,9 +129,7 @@ SCENARIO("Numbers::NoRepetition: params")
 {
     using namespace aleatoric;
 
-    auto generator = std::make_unique<DiscreteGenerator>();
-    auto generatorPointer = generator.get();
-    NoRepetition instance(std::move(generator), Range(1, 10));
+    NoRepetition instance(std::make_unique<UniformGenerator>(), Range(1, 10));
 
     WHEN("get params")
     {
@@ -165,10 +171,10 @@ SCENARIO("Numbers::NoRepetition: params")
                 NumberProtocolParams(NoRepetitionParams()));
             instance.setParams(newParams);
 
-            THEN("Generator distribution should be equal prob for new range")
+            THEN("The next number should be selected from the new range")
             {
-                REQUIRE(generatorPointer->getDistributionVector() ==
-                        std::vector<double> {1, 1, 1});
+                auto nextNumber = instance.getIntegerNumber();
+                REQUIRE(newRange.numberIsInRange(nextNumber));
             }
         }
 
@@ -183,11 +189,10 @@ SCENARIO("Numbers::NoRepetition: params")
                     newRange,
                     NumberProtocolParams(NoRepetitionParams()));
                 instance.setParams(newParams);
-                THEN(
-                    "Generator distribution should be equal prob for new range")
+                THEN("The next number should be selected from the new range")
                 {
-                    REQUIRE(generatorPointer->getDistributionVector() ==
-                            std::vector<double> {1, 1, 1, 1});
+                    auto nextNumber = instance.getIntegerNumber();
+                    REQUIRE(newRange.numberIsInRange(nextNumber));
                 }
             }
 
@@ -2,6 +2,8 @@
 
 #include "DiscreteGenerator.hpp"
 #include "DiscreteGeneratorMock.hpp"
+#include "UniformGenerator.hpp"
+#include "UniformGeneratorMock.hpp"
 
 #include <catch2/catch.hpp>
 #include <catch2/trompeloeil.hpp>
@@ -11,7 +13,8 @@ SCENARIO("Numbers::Periodic: default constructor")
 {
     using namespace aleatoric;
 
-    Periodic instance(std::make_unique<DiscreteGenerator>());
+    Periodic instance(std::make_unique<UniformGenerator>(),
+                      std::make_unique<DiscreteGenerator>());
 
     THEN("Params are set to defaults")
     {
@@ -62,13 +65,15 @@ SCENARIO("Numbers::Periodic")
                 double invalidChanceValue = 1.1;
 
                 REQUIRE_THROWS_AS(
-                    Periodic(std::make_unique<DiscreteGenerator>(),
+                    Periodic(std::make_unique<UniformGenerator>(),
+                             std::make_unique<DiscreteGenerator>(),
                              Range(1, 3),
                              invalidChanceValue),
                     std::invalid_argument);
 
                 REQUIRE_THROWS_WITH(
-                    Periodic(std::make_unique<DiscreteGenerator>(),
+                    Periodic(std::make_unique<UniformGenerator>(),
+                             std::make_unique<DiscreteGenerator>(),
                              Range(1, 3),
                              invalidChanceValue),
                     "The value passed as argument for chanceOfRepetition must "
@@ -83,13 +88,15 @@ SCENARIO("Numbers::Periodic")
                 double invalidChanceValue = -0.1;
 
                 REQUIRE_THROWS_AS(
-                    Periodic(std::make_unique<DiscreteGenerator>(),
+                    Periodic(std::make_unique<UniformGenerator>(),
+                             std::make_unique<DiscreteGenerator>(),
                              Range(1, 3),
                              invalidChanceValue),
                     std::invalid_argument);
 
                 REQUIRE_THROWS_WITH(
-                    Periodic(std::make_unique<DiscreteGenerator>(),
+                    Periodic(std::make_unique<UniformGenerator>(),
+                             std::make_unique<DiscreteGenerator>(),
                              Range(1, 3),
                              invalidChanceValue),
                     "The value passed as argument for chanceOfRepetition must "
@@ -100,85 +107,109 @@ SCENARIO("Numbers::Periodic")
 
     GIVEN("Construction")
     {
-        auto generator = std::make_unique<DiscreteGeneratorMock>();
-        auto generatorPointer = generator.get();
-
-        std::vector<double> initialGeneratorDistributionState {1.0, 1.0, 1.0};
-        ALLOW_CALL(*generatorPointer, getDistributionVector())
-            .RETURN(initialGeneratorDistributionState);
+        auto uniformGenerator = std::make_unique<UniformGeneratorMock>();
+        auto uniformGeneratorPointer = uniformGenerator.get();
+        auto discreteGenerator = std::make_unique<DiscreteGeneratorMock>();
+        auto discreteGeneratorPointer = discreteGenerator.get();
 
         Range range(1, 3);
 
         WHEN("The object is constructed")
         {
-            THEN("The generator distribution is set to the range size")
+            THEN("The uniform generator distribution is set to the range and "
+                 "the discrete generator is set to the chance of repetition")
             {
-                REQUIRE_CALL(*generatorPointer,
-                             setDistributionVector(range.size, 1.0));
-                Periodic(std::move(generator), range, 0.5);
+                REQUIRE_CALL(*uniformGeneratorPointer,
+                             setDistribution(range.start, range.end));
+                REQUIRE_CALL(*discreteGeneratorPointer,
+                             setDistributionVector(
+                                 std::vector<double> {0.75, 0.25}));
+                Periodic(std::move(uniformGenerator),
+                         std::move(discreteGenerator),
+                         range,
+                         0.25);
             }
         }
     }
 
     GIVEN("The object is constructed")
     {
-        auto generator = std::make_unique<DiscreteGeneratorMock>();
-        auto generatorPointer = generator.get();
-
-        std::vector<double> initialGeneratorDistributionState {1.0, 1.0, 1.0};
-
-        ALLOW_CALL(*generatorPointer, getDistributionVector())
-            .RETURN(initialGeneratorDistributionState);
-        ALLOW_CALL(*generatorPointer,
+        auto uniformGenerator = std::make_unique<UniformGeneratorMock>();
+        auto uniformGeneratorPointer = uniformGenerator.get();
+        auto discreteGenerator = std::make_unique<DiscreteGeneratorMock>();
+        auto discreteGeneratorPointer = discreteGenerator.get();
+
+        ALLOW_CALL(*uniformGeneratorPointer,
+                   setDistribution(ANY(int), ANY(int)));
+        ALLOW_CALL(*discreteGeneratorPointer,
                    setDistributionVector(ANY(std::vector<double>)));
-        ALLOW_CALL(*generatorPointer, setDistributionVector(ANY(int), 1.0));
 
-        Range range(1, 3);
+        Range range(1, 4);
 
         double chanceOfRepetition = 0.5;
 
-        Periodic instance(std::move(generator), range, chanceOfRepetition);
+        Periodic instance(std::move(uniformGenerator),
+                          std::move(discreteGenerator),
+                          range,
+                          chanceOfRepetition);
 
-        int generatedNumber = 1; // mid range selection
-
-        WHEN("A number is requested")
+        WHEN("The first number is requested")
         {
-            THEN("It returns a generated number with the range offset added")
+            THEN("It returns a number generated from the whole range without "
+                 "a repetition decision")
             {
-                REQUIRE_CALL(*generatorPointer, getNumber())
-                    .RETURN(generatedNumber);
-                auto returnedNumber = instance.getIntegerNumber();
-                REQUIRE(returnedNumber == generatedNumber + range.offset);
+                REQUIRE_CALL(*uniformGeneratorPointer, getNumber()).RETURN(2);
+                FORBID_CALL(*discreteGeneratorPointer, getNumber());
+                REQUIRE(instance.getIntegerNumber() == 2);
             }
 
-            AND_THEN("The generator distibution should be set with a bias in "
-                     "favour of the last generated number according to the "
-                     "periodicity received during construction")
+            THEN("The uniform generator is set to select from one fewer "
+                 "numbers than the range size")
             {
-                REQUIRE_CALL(*generatorPointer, getNumber())
-                    .RETURN(generatedNumber);
-                REQUIRE_CALL(*generatorPointer, getDistributionVector())
-                    .TIMES(1) // doesn't seem to register that it is called in
-                              // the constructor as well
-                    .RETURN(initialGeneratorDistributionState);
-
-                // The total of all values in the vector must equal 1.0. The
-                // value at the index of the last selected number must have the
-                // value of the periodicity (chanceOfRepetition). The remainder
-                // of 1.0 - periodicity is shared equally amongst the remaining
-                // vector indices.
-
-                // NB: Due to floating-point representation of some numbers, we
-                // have to be careful what numbers to choose here to demonstrate
-                // that this logic is fundamentally correct. See note in
-                // setPeriodicDistribution()
-                REQUIRE_CALL(
-                    *generatorPointer,
-                    setDistributionVector(
-                        std::vector<double> {0.25, chanceOfRepetition, 0.25}));
+                REQUIRE_CALL(*uniformGeneratorPointer, getNumber()).RETURN(2);
+                REQUIRE_CALL(*uniformGeneratorPointer,
+                             setDistribution(0, range.size - 2));
                 instance.getIntegerNumber();
             }
         }
+
+        WHEN("There is a last number returned")
+        {
+            REQUIRE_CALL(*uniformGeneratorPointer, getNumber()).RETURN(2);
+            instance.getIntegerNumber();
+
+            AND_WHEN("The discrete generator decides to repeat")
+            {
+                THEN("The last number is returned without a further draw")
+                {
+                    REQUIRE_CALL(*discreteGeneratorPointer, getNumber())
+                        .RETURN(1);
+                    FORBID_CALL(*uniformGeneratorPointer, getNumber());
+                    REQUIRE(instance.getIntegerNumber() == 2);
+                }
+            }
+
+            AND_WHEN("The discrete generator decides not to repeat")
+            {
+                ALLOW_CALL(*discreteGeneratorPointer, getNumber()).RETURN(0);
+
+                THEN("A generated index below that of the last number is "
+                     "returned with the range offset applied")
+                {
+                    REQUIRE_CALL(*uniformGeneratorPointer, getNumber())
+                        .RETURN(0);
+                    REQUIRE(instance.getIntegerNumber() == 1);
+                }
+
+                THEN("A generated index at or above that of the last number "
+                     "skips over the last number")
+                {
+                    REQUIRE_CALL(*uniformGeneratorPointer, getNumber())
+                        .RETURN(1);
+                    REQUIRE(instance.getIntegerNumber() == 3);
+                }
+            }
+        }
     }
 }
 
@@ -188,9 +219,12 @@ SCENARIO("Numbers::Periodic: params")
 
     Range range(1, 10);
     double chanceOfRepetition = 0.5;
-    auto generator = std::make_unique<DiscreteGenerator>();
-    auto generatorPointer = generator.get();
-    Periodic instance(std::move(generator), range, chanceOfRepetition);
+    auto discreteGenerator = std::make_unique<DiscreteGenerator>();
+    auto discreteGeneratorPointer = discreteGenerator.get();
+    Periodic instance(std::make_unique<UniformGenerator>(),
+                      std::move(discreteGenerator),
+                      range,
+                      chanceOfRepetition);
 
     WHEN("Get params")
     {
@@ -299,12 +333,10 @@ SCENARIO("Numbers::Periodic: params")
 
             instance.setParams(newParams);
 
-            THEN("The generator distribution should be equal "
-                 "probability for the new range size")
+            THEN("The next number should be selected from the new range")
             {
-                std::vector<double> expectedDistribution {1, 1, 1};
-                REQUIRE(generatorPointer->getDistributionVector() ==
-                        expectedDistribution);
+                auto nextNumber = instance.getIntegerNumber();
+                REQUIRE(newRange.numberIsInRange(nextNumber));
             }
         }
 
@@ -319,12 +351,10 @@ SCENARIO("Numbers::Periodic: params")
 
             instance.setParams(newParams);
 
-            THEN("The generator distribution should be equal "
-                 "probability for the new range size")
+            THEN("The next number should be selected from the new range")
             {
-                std::vector<double> expectedDistribution {1, 1, 1};
-                REQUIRE(generatorPointer->getDistributionVector() ==
-                        expectedDistribution);
+                auto nextNumber = instance.getIntegerNumber();
+                REQUIRE(newRange.numberIsInRange(nextNumber));
             }
         }
 
@@ -341,26 +371,22 @@ SCENARIO("Numbers::Periodic: params")
 
             instance.setParams(newParams);
 
-            THEN("The generator distribution should favour the last "
-                 "number returned with the new chance of repetition")
+            THEN("The repetition of the last number returned should be "
+                 "decided with the new chance of repetition")
             {
-                // The total of all values in the vector must equal 1.0.
-                // The
-                // value at the index of the last selected number must
-                // have the value of the periodicity
-                // (chanceOfRepetition). The remainder of 1.0 -
-                // periodicity is shared equally amongst the remaining
-                // vector indices.
-
-                std::vector<double> expectedDistribution {0.1875,
-                                                          0.1875,
-                                                          newChanceOfRepetition,
-                                                          0.1875,
-                                                          0.1875};
-
-                REQUIRE(generatorPointer->getDistributionVector() ==
+                std::vector<double> expectedDistribution {
+                    1.0 - newChanceOfRepetition,
+                    newChanceOfRepetition};
+
+                REQUIRE(discreteGeneratorPointer->getDistributionVector() ==
                         expectedDistribution);
             }
+
+            THEN("The next number should be selected from the new range")
+            {
+                auto nextNumber = instance.getIntegerNumber();
+                REQUIRE(newRange.numberIsInRange(nextNumber));
+            }
         }
     }
 }
@@ -0,0 +1,200 @@
+#include "PinkNoise.hpp"
+
+#include "Range.hpp"
+#include "UniformRealGenerator.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cmath>
+
+SCENARIO("Numbers::PinkNoise: default constructor")
+{
+    using namespace aleatoric;
+
+    PinkNoise instance(std::make_unique<UniformRealGenerator>());
+
+    THEN("Params are set to defaults")
+    {
+        auto params = instance.getParams();
+        REQUIRE(params.getRange().start == 0);
+        REQUIRE(params.getRange().end == 1);
+        REQUIRE(params.protocols.getPinkNoise().getNumberOfRows() == 8);
+    }
+}
+
+SCENARIO("Numbers::PinkNoise")
+{
+    using namespace aleatoric;
+
+    GIVEN("Construction: with an invalid number of rows")
+    {
+        THEN("Throws")
+        {
+            REQUIRE_THROWS_WITH(
+                PinkNoise(std::make_unique<UniformRealGenerator>(),
+                          Range(1, 10),
+                          0),
+                "The number of rows must be between 1 and 30");
+            REQUIRE_THROWS_AS(
+                PinkNoise(std::make_unique<UniformRealGenerator>(),
+                          Range(1, 10),
+                          31),
+                std::invalid_argument);
+        }
+    }
+
+    GIVEN("The object is constructed")
+    {
+        Range range(0, 100);
+        PinkNoise instance(std::make_unique<UniformRealGenerator>(), range, 4);
+
+        THEN("Each number changes a single row, so moves no further than the "
+             "range divided by the number of rows")
+        {
+            bool withinOneRow = true;
+            auto previous = instance.getDecimalNumber();
+            for(int i = 0; i < 10000; i++) {
+                auto number = instance.getDecimalNumber();
+                withinOneRow &= std::abs(number - previous) <= 25.0;
+                previous = number;
+            }
+
+            REQUIRE(withinOneRow);
+        }
+
+        THEN("Every number changes a row, so no number repeats the last")
+        {
+            bool changes = true;
+            auto previous = instance.getDecimalNumber();
+            for(int i = 0; i < 10000; i++) {
+                auto number = instance.getDecimalNumber();
+                changes &= number != previous;
+                previous = number;
+            }
+
+            REQUIRE(changes);
+        }
+
+        THEN("Numbers are within the range")
+        {
+            bool inRange = true;
+            for(int i = 0; i < 10000; i++) {
+                inRange &=
+                    range.floatingPointIsInRange(instance.getDecimalNumber());
+                inRange &= range.numberIsInRange(instance.getIntegerNumber());
+            }
+
+            REQUIRE(inRange);
+        }
+    }
+
+    GIVEN("A single row")
+    {
+        PinkNoise instance(std::make_unique<UniformRealGenerator>(),
+                           Range(0, 1000000),
+                           1);
+
+        THEN("The row changes with every number")
+        {
+            bool changes = true;
+            auto previous = instance.getDecimalNumber();
+            for(int i = 0; i < 1000; i++) {
+                auto number = instance.getDecimalNumber();
+                changes &= number != previous;
+                previous = number;
+            }
+            REQUIRE(changes);
+        }
+    }
+
+    GIVEN("Many rows")
+    {
+        PinkNoise instance(std::make_unique<UniformRealGenerator>(),
+                           Range(0, 1000),
+                           16);
+
+        THEN("Numbers far apart in the sequence remain correlated")
+        {
+            // Of the 16 rows, roughly 9 are left unchanged over 64 numbers,
+            // whereas white noise has no correlation at any distance
+            auto numbers = instance.getDecimalCollection(100000);
+            int lag = 64;
+
+            double mean = 0.0;
+            for(auto number : numbers) {
+                mean += number;
+            }
+            mean /= numbers.size();
+
+            double covariance = 0.0;
+            double variance = 0.0;
+            for(size_t i = 0; i < numbers.size(); i++) {
+                variance += (numbers[i] - mean) * (numbers[i] - mean);
+                if(i + lag < numbers.size()) {
+                    covariance +=
+                        (numbers[i] - mean) * (numbers[i + lag] - mean);
+                }
+            }
+
+            REQUIRE(covariance / variance > 0.3);
+        }
+    }
+}
+
+SCENARIO("Numbers::PinkNoise: params")
+{
+    using namespace aleatoric;
+
+    PinkNoise instance(std::make_unique<UniformRealGenerator>(),
+                       Range(1, 10),
+                       4);
+
+    WHEN("Get params")
+    {
+        auto params = instance.getParams();
+
+        THEN("Reflects object state")
+        {
+            REQUIRE(params.getRange().start == 1);
+            REQUIRE(params.getRange().end == 10);
+            REQUIRE(params.protocols.getPinkNoise().getNumberOfRows() == 4);
+            REQUIRE(params.protocols.getActiveProtocol() ==
+                    NumberProtocol::Type::pinkNoise);
+        }
+    }
+
+    WHEN("Set params")
+    {
+        THEN("An invalid number of rows throws and leaves the object as it "
+             "was")
+        {
+            REQUIRE_THROWS_AS(instance.setParams(NumberProtocolConfig(
+                                  Range(20, 30),
+                                  NumberProtocolParams(PinkNoiseParams(40)))),
+                              std::invalid_argument);
+            REQUIRE(instance.getParams().getRange().start == 1);
+        }
+
+        instance.setParams(NumberProtocolConfig(
+            Range(20, 30),
+            NumberProtocolParams(PinkNoiseParams(12))));
+
+        THEN("Object is updated")
+        {
+            auto params = instance.getParams();
+            REQUIRE(params.getRange().start == 20);
+            REQUIRE(params.getRange().end == 30);
+            REQUIRE(params.protocols.getPinkNoise().getNumberOfRows() == 12);
+        }
+
+        THEN("Numbers are within the new range")
+        {
+            bool inRange = true;
+            for(auto number : instance.getIntegerCollection(1000)) {
+                inRange &= number >= 20 && number <= 30;
+            }
+
+            REQUIRE(inRange);
+        }
+    }
+}
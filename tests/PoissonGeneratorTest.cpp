@@ -0,0 +1,80 @@
+#include "PoissonGenerator.hpp"
+
+#include <catch2/catch.hpp>
+
+SCENARIO("PoissonGenerator")
+{
+    using namespace aleatoric;
+
+    auto getMeanAndVariance = [](const std::vector<int> &numbers) {
+        double sum = 0.0;
+        double sumOfSquares = 0.0;
+        for(auto number : numbers) {
+            sum += number;
+            sumOfSquares += static_cast<double>(number) * number;
+        }
+
+        auto mean = sum / numbers.size();
+        auto variance = sumOfSquares / numbers.size() - mean * mean;
+        return std::make_pair(mean, variance);
+    };
+
+    GIVEN("Default construction")
+    {
+        PoissonGenerator instance;
+
+        THEN("Returned mean is 1")
+        {
+            REQUIRE(instance.getDistribution() == 1.0);
+        }
+
+        THEN("A mean outside the limits throws")
+        {
+            REQUIRE_THROWS_WITH(
+                instance.setDistribution(0.0),
+                "The mean must be greater than 0 and no greater than "
+                "100000000");
+            REQUIRE_THROWS_AS(instance.setDistribution(100000001.0),
+                              std::invalid_argument);
+        }
+    }
+
+    GIVEN("A small mean")
+    {
+        PoissonGenerator instance(3.0);
+        auto numbers = instance.getNumbers(200000);
+
+        THEN("The mean, variance and chance of 0 match the distribution")
+        {
+            int zeros = 0;
+            bool noneNegative = true;
+            for(auto number : numbers) {
+                zeros += number == 0;
+                noneNegative &= number >= 0;
+            }
+
+            auto meanAndVariance = getMeanAndVariance(numbers);
+            REQUIRE(noneNegative);
+            REQUIRE(meanAndVariance.first == Approx(3.0).margin(0.02));
+            REQUIRE(meanAndVariance.second == Approx(3.0).margin(0.05));
+            // e^-3
+            REQUIRE(zeros / 200000.0 == Approx(0.0498).margin(0.002));
+        }
+    }
+
+    GIVEN("A large mean")
+    {
+        PoissonGenerator instance(5.0);
+        instance.setDistribution(1000000.0);
+        auto numbers = instance.getNumbers(100000);
+
+        THEN("The mean and variance match the distribution")
+        {
+            auto meanAndVariance = getMeanAndVariance(numbers);
+            REQUIRE(instance.getDistribution() == 1000000.0);
+            REQUIRE(meanAndVariance.first == Approx(1000000.0).margin(20.0));
+            REQUIRE(meanAndVariance.second ==
+                    Approx(1000000.0).margin(20000.0));
+        }
+    }
+}
@@ -1,8 +1,8 @@
 #include "Ratio.hpp"
 
-#include "DiscreteGenerator.hpp"
-#include "DiscreteGeneratorMock.hpp"
 #include "Range.hpp"
+#include "UniformGenerator.hpp"
+#include "UniformGeneratorMock.hpp"
 
 #include <catch2/catch.hpp>
 #include <catch2/trompeloeil.hpp>
@@ -11,7 +11,7 @@ SCENARIO("Numbers::Ratio: default constructor")
 {
     using namespace aleatoric;
 
-    Ratio instance(std::make_unique<DiscreteGenerator>());
+    Ratio instance(std::make_unique<UniformGenerator>());
 
     THEN("Params are set to defaults")
     {
@@ -61,13 +61,13 @@ SCENARIO("Numbers::Ratio")
                 // should have a size of 3 if it were to match the range size
                 std::vector<int> ratios {1, 2};
 
-                REQUIRE_THROWS_AS(Ratio(std::make_unique<DiscreteGenerator>(),
+                REQUIRE_THROWS_AS(Ratio(std::make_unique<UniformGenerator>(),
                                         Range(10, 12),
                                         ratios),
                                   std::invalid_argument);
 
                 REQUIRE_THROWS_WITH(
-                    Ratio(std::make_unique<DiscreteGenerator>(),
+                    Ratio(std::make_unique<UniformGenerator>(),
                           Range(10, 12),
                           ratios),
                     "The size of ratios collection must match the size of the "
@@ -76,120 +76,69 @@ SCENARIO("Numbers::Ratio")
         }
     }
 
-    GIVEN("Construction")
-    {
-        auto generator = std::make_unique<DiscreteGeneratorMock>();
-        auto generatorPointer = generator.get();
-
-        // 3 numbers because the range is inclusive
-        std::vector<int> ratios {1, 2, 3};
-        int ratiosSum = 6;
-
-        WHEN("The constructor is called")
-        {
-            THEN("The generator should be set to the size of the sum of the "
-                 "ratios supplied with equal probability")
-            {
-                REQUIRE_CALL(*generatorPointer,
-                             setDistributionVector(ratiosSum, 1.0));
-                Ratio(std::move(generator), Range(10, 12), ratios);
-            }
-        }
-    }
-
     GIVEN("The object is constructed")
     {
-        auto generator = std::make_unique<DiscreteGeneratorMock>();
+        auto generator = std::make_unique<UniformGeneratorMock>();
         auto generatorPointer = generator.get();
-        ALLOW_CALL(*generatorPointer, getNumber()).RETURN(1);
-        ALLOW_CALL(*generatorPointer,
-                   setDistributionVector(ANY(int), ANY(double)));
-        ALLOW_CALL(*generatorPointer,
-                   updateDistributionVector(ANY(int), ANY(double)));
-        // ensures that seriesIsComplete returns true
-        ALLOW_CALL(*generatorPointer, getDistributionVector())
-            .RETURN(std::vector<double> {1.0});
+        ALLOW_CALL(*generatorPointer, getNumber()).RETURN(0);
+        ALLOW_CALL(*generatorPointer, setDistribution(ANY(int), ANY(int)));
 
         Range range(10, 12);
 
         // 3 numbers because the range is inclusive
         std::vector<int> ratios {1, 3, 5};
+        int ratiosSum = 9;
 
         Ratio instance(std::move(generator), range, ratios);
 
         WHEN("A number is requested")
         {
-            THEN("It calls the generator to get a number")
+            THEN("The generator is set to the number of selections remaining "
+                 "in the series and called to get a number")
             {
-                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(1);
+                REQUIRE_CALL(*generatorPointer,
+                             setDistribution(0, ratiosSum - 1));
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(0);
                 instance.getIntegerNumber();
             }
 
-            THEN("It updates the generator to disallow the selected number "
-                 "from being selected in future calls")
+            THEN("It returns the number whose share of the ratios contains the "
+                 "generated number")
             {
-                int generatedNumber = 1;
-
-                REQUIRE_CALL(*generatorPointer, getNumber())
-                    .RETURN(generatedNumber);
-
-                REQUIRE_CALL(*generatorPointer,
-                             updateDistributionVector(generatedNumber, 0.0));
-
-                instance.getIntegerNumber();
+                // ratios laid end to end: 10, 11, 11, 11, 12, 12, 12, 12, 12
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(8);
+                REQUIRE(instance.getIntegerNumber() == 12);
             }
+        }
 
-            THEN("It returns the number held within the selectables collection "
-                 "at the index specified by the generated number")
+        WHEN("A series of numbers is requested")
+        {
+            THEN("Each selection reduces the number of selections remaining "
+                 "for the number selected")
             {
-                std::vector<int>
-                    expectedSelectables {10, 11, 11, 11, 12, 12, 12, 12, 12};
-
-                // get generator to return numbers for each index in
-                // expectedSelectables
-                for(int i = 0; i < expectedSelectables.size(); i++) {
-                    REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(i);
+                // with the generator always returning 0, the lowest number
+                // with selections remaining is always chosen
+                std::vector<int> expectedSeries {10, 11, 11, 11, 12, 12, 12, 12,
+                                                 12};
 
-                    auto returnedNumber = instance.getIntegerNumber();
-
-                    REQUIRE(returnedNumber == expectedSelectables[i]);
+                for(int i = 0; i < ratiosSum; i++) {
+                    REQUIRE_CALL(*generatorPointer,
+                                 setDistribution(0, ratiosSum - 1 - i));
+                    REQUIRE(instance.getIntegerNumber() == expectedSeries[i]);
                 }
             }
 
-            THEN("It gets the state of the generator distribution for "
-                 "determining if the series is complete")
-            {
-                // NB: the return value for this test can be anything
-                REQUIRE_CALL(*generatorPointer, getDistributionVector())
-                    .RETURN(std::vector<double> {1.0});
-                instance.getIntegerNumber();
-            }
-
             AND_WHEN("The series is complete")
             {
-                THEN("It resets the generator distribution")
-                {
-                    REQUIRE_CALL(*generatorPointer, getDistributionVector())
-                        .RETURN(std::vector<double> {0.0});
-
-                    REQUIRE_CALL(*generatorPointer,
-                                 updateDistributionVector(1.0));
-
+                for(int i = 0; i < ratiosSum; i++) {
                     instance.getIntegerNumber();
                 }
-            }
 
-            AND_WHEN("The series is not complete")
-            {
-                THEN("It does not reset the generator distribution")
+                THEN("The series is reset to the full ratios")
                 {
-                    REQUIRE_CALL(*generatorPointer, getDistributionVector())
-                        .RETURN(std::vector<double> {1.0});
-
-                    FORBID_CALL(*generatorPointer,
-                                updateDistributionVector(1.0));
-
-                    instance.getIntegerNumber();
+                    REQUIRE_CALL(*generatorPointer,
+                                 setDistribution(0, ratiosSum - 1));
+                    REQUIRE(instance.getIntegerNumber() == 10);
                 }
             }
         }
@@ -201,7 +150,7 @@ SCENARIO("Numbers::Ratio: params")
     using namespace aleatoric;
 
     std::vector<int> ratios {1, 1, 1};
-    Ratio instance(std::make_unique<DiscreteGenerator>(), Range(1, 3), ratios);
+    Ratio instance(std::make_unique<UniformGenerator>(), Range(1, 3), ratios);
 
     std::vector<int> initialExpectedSelectables {1, 2, 3};
 
@@ -276,3 +225,91 @@ SCENARIO("Numbers::Ratio: params")
         }
     }
 }
+
+SCENARIO("Numbers::Ratio: ratios of 0 or less")
+{
+    using namespace aleatoric;
+
+    GIVEN("A negative ratio")
+    {
+        Ratio instance(std::make_unique<UniformGenerator>(),
+                       Range(1, 3),
+                       std::vector<int> {2, -1, 1});
+
+        THEN("That number is never selected, as with a ratio of 0")
+        {
+            for(int series = 0; series < 100; series++) {
+                std::vector<int> set(3);
+                for(auto &&i : set) {
+                    i = instance.getIntegerNumber();
+                }
+                REQUIRE_THAT(
+                    set,
+                    Catch::UnorderedEquals(std::vector<int> {1, 1, 3}));
+            }
+        }
+    }
+
+    GIVEN("Only one ratio greater than 0")
+    {
+        Ratio instance(std::make_unique<UniformGenerator>(),
+                       Range(1, 2),
+                       std::vector<int> {1, -1});
+
+        THEN("Every series holds only that number")
+        {
+            bool onlyFirst = true;
+            for(int i = 0; i < 100; i++) {
+                onlyFirst &= instance.getIntegerNumber() == 1;
+            }
+            REQUIRE(onlyFirst);
+        }
+    }
+
+    GIVEN("No ratio greater than 0")
+    {
+        THEN("Construction throws")
+        {
+            REQUIRE_THROWS_WITH(Ratio(std::make_unique<UniformGenerator>(),
+                                      Range(1, 2),
+                                      std::vector<int> {-2, -1}),
+                                "At least one ratio must be greater than 0");
+            REQUIRE_THROWS_WITH(Ratio(std::make_unique<UniformGenerator>(),
+                                      Range(1, 2),
+                                      std::vector<int> {0, -1}),
+                                "At least one ratio must be greater than 0");
+        }
+
+        THEN("Setting params throws")
+        {
+            Ratio instance(std::make_unique<UniformGenerator>(),
+                           Range(1, 2),
+                           std::vector<int> {1, 1});
+            NumberProtocolConfig newParams(
+                Range(1, 2),
+                NumberProtocolParams(RatioParams(std::vector<int> {0, 0})));
+            REQUIRE_THROWS_WITH(instance.setParams(newParams),
+                                "At least one ratio must be greater than 0");
+        }
+    }
+}
+
+SCENARIO("Numbers::Ratio: large ratios")
+{
+    using namespace aleatoric;
+
+    std::vector<int> ratios {1000, 1, 250};
+    Ratio instance(std::make_unique<UniformGenerator>(), Range(0, 2), ratios);
+
+    THEN("Each series contains each number as many times as its ratio")
+    {
+        for(int series = 0; series < 3; series++) {
+            std::vector<int> counts(ratios.size(), 0);
+            for(int i = 0; i < 1251; i++) {
+                counts[instance.getIntegerNumber()]++;
+            }
+
+            REQUIRE(counts == ratios);
+        }
+    }
+}
@@ -3,8 +3,13 @@
 #include "DiscreteGenerator.hpp"
 #include "DiscreteGeneratorMock.hpp"
 #include "Range.hpp"
+#include "UniformGenerator.hpp"
+#include "UniformGeneratorMock.hpp"
 
+#include <algorithm>
 #include <array>
+#include <limits>
+#include <numeric>
 #include <catch2/catch.hpp>
 #include <catch2/trompeloeil.hpp>
 
@@ -200,3 +205,112 @@ SCENARIO("Numbers::Serial: params")
         }
     }
 }
+
+SCENARIO("Numbers::Serial: permutation mode")
+{
+    using namespace aleatoric;
+
+    GIVEN("The object is constructed with a seed generator")
+    {
+        auto generator = std::make_unique<UniformGeneratorMock>();
+        auto generatorPointer = generator.get();
+
+        Range range(1, 3);
+
+        THEN("A permutation is seeded on construction")
+        {
+            REQUIRE_CALL(*generatorPointer,
+                         setDistribution(0, std::numeric_limits<int>::max()));
+            REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(7).TIMES(4);
+            Serial(std::move(generator), range);
+        }
+
+        WHEN("A series is complete")
+        {
+            ALLOW_CALL(*generatorPointer, setDistribution(ANY(int), ANY(int)));
+            ALLOW_CALL(*generatorPointer, getNumber()).RETURN(7);
+
+            Serial instance(std::move(generator), range);
+
+            for(int i = 0; i < range.size; i++) {
+                instance.getIntegerNumber();
+            }
+
+            THEN("A new permutation is seeded for the next series")
+            {
+                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(7).TIMES(4);
+                instance.getIntegerNumber();
+            }
+        }
+    }
+
+    GIVEN("A range")
+    {
+        Range range(5, 1004);
+        Serial instance(std::make_unique<UniformGenerator>(), range);
+
+        THEN("Each series contains every number in the range exactly once")
+        {
+            std::vector<int> expectedValues(range.size);
+            std::iota(expectedValues.begin(),
+                      expectedValues.end(),
+                      range.start);
+
+            std::vector<std::vector<int>> series(3);
+            for(auto &&set : series) {
+                set.resize(range.size);
+                for(auto &&i : set) {
+                    i = instance.getIntegerNumber();
+                }
+
+                auto sorted = set;
+                std::sort(sorted.begin(), sorted.end());
+                REQUIRE(sorted == expectedValues);
+            }
+
+            // a new permutation is used for each series
+            REQUIRE(series[0] != series[1]);
+            REQUIRE(series[1] != series[2]);
+        }
+
+        WHEN("Params are set")
+        {
+            Range newRange(-2, 3);
+            instance.getIntegerNumber();
+            instance.setParams(
+                NumberProtocolConfig(newRange,
+                                     NumberProtocolParams(SerialParams())));
+
+            THEN("A new series over the new range is started")
+            {
+                std::vector<int> set(newRange.size);
+                for(auto &&i : set) {
+                    i = instance.getIntegerNumber();
+                }
+
+                REQUIRE_THAT(set,
+                             Catch::UnorderedEquals(
+                                 std::vector<int> {-2, -1, 0, 1, 2, 3}));
+            }
+        }
+    }
+
+    GIVEN("A very large range")
+    {
+        Range range(0, 99999999);
+        Serial instance(std::make_unique<UniformGenerator>(), range);
+
+        THEN("Numbers within a series do not repeat")
+        {
+            std::vector<int> set(100000);
+            for(auto &&i : set) {
+                i = instance.getIntegerNumber();
+            }
+
+            std::sort(set.begin(), set.end());
+            REQUIRE(range.numberIsInRange(set.front()));
+            REQUIRE(range.numberIsInRange(set.back()));
+            REQUIRE(std::adjacent_find(set.begin(), set.end()) == set.end());
+        }
+    }
+}
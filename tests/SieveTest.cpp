@@ -0,0 +1,192 @@
+#include "Sieve.hpp"
+
+#include "CollectionsProducer.hpp"
+#include "Cycle.hpp"
+
+#include <catch2/catch.hpp>
+
+SCENARIO("Sieve: residue classes")
+{
+    using namespace aleatoric;
+
+    GIVEN("An invalid modulus")
+    {
+        THEN("Throws")
+        {
+            REQUIRE_THROWS_WITH(Sieve(Range(0, 10), 0, 1),
+                                "The modulus must be 1 or greater");
+        }
+    }
+
+    GIVEN("An empty sieve")
+    {
+        Sieve instance(Range(0, 10));
+
+        THEN("It has no members")
+        {
+            REQUIRE(instance.getSize() == 0);
+            REQUIRE(instance.getNumbers().empty());
+            REQUIRE_FALSE(instance.contains(5));
+#ifndef ALEATORIC_UNCHECKED_ACCESS
+            REQUIRE_THROWS_AS(instance.getNumber(0), std::out_of_range);
+#endif
+        }
+    }
+
+    GIVEN("A residue class")
+    {
+        Sieve instance(Range(10, 30), 4, 1);
+
+        THEN("Members are the numbers that equal the residue modulo the "
+             "modulus")
+        {
+            REQUIRE(instance.getNumbers() ==
+                    std::vector<int> {13, 17, 21, 25, 29});
+            REQUIRE(instance.getSize() == 5);
+        }
+
+        THEN("Members can be tested, ranked and selected")
+        {
+            REQUIRE(instance.contains(17));
+            REQUIRE_FALSE(instance.contains(18));
+            REQUIRE_FALSE(instance.contains(1));
+            REQUIRE(instance.getRank(10) == 0);
+            REQUIRE(instance.getRank(17) == 1);
+            REQUIRE(instance.getRank(18) == 2);
+            REQUIRE(instance.getRank(100) == 5);
+            REQUIRE(instance.getNumber(0) == 13);
+            REQUIRE(instance.getNumber(4) == 29);
+#ifndef ALEATORIC_UNCHECKED_ACCESS
+            REQUIRE_THROWS_AS(instance.getNumber(5), std::out_of_range);
+#endif
+        }
+
+        WHEN("It is combined with other sieves")
+        {
+            auto combined = instance.getComplement().getIntersection(
+                instance.getUnion(Sieve(Range(10, 30), 4, 2)));
+
+            THEN("It is left unchanged")
+            {
+                REQUIRE(combined.getNumbers() ==
+                        std::vector<int> {10, 14, 18, 22, 26, 30});
+                REQUIRE(instance.getNumbers() ==
+                        std::vector<int> {13, 17, 21, 25, 29});
+            }
+        }
+    }
+
+    GIVEN("A residue class over a range with negative numbers")
+    {
+        Sieve instance(Range(-7, 7), 3, 2);
+
+        THEN("Residues are taken as for positive numbers")
+        {
+            REQUIRE(instance.getNumbers() ==
+                    std::vector<int> {-7, -4, -1, 2, 5});
+        }
+    }
+}
+
+SCENARIO("Sieve: combining sieves")
+{
+    using namespace aleatoric;
+
+    GIVEN("Sieves with different ranges")
+    {
+        THEN("Combining them throws")
+        {
+            REQUIRE_THROWS_WITH(
+                Sieve(Range(0, 10), 2, 0).getUnion(Sieve(Range(0, 11), 3, 0)),
+                "Sieves must share the same range");
+        }
+    }
+
+    GIVEN("Small and large moduli over a range spanning many words")
+    {
+        Range range(-100, 5000);
+
+        // (3, 1) ∪ (100, 7) ∩ ¬(7, 0) ∪ (2, 0) ∩ (5, 3)
+        auto sieve = Sieve(range, 3, 1)
+                         .getUnion(Sieve(range, 100, 7))
+                         .getIntersection(Sieve(range, 7, 0).getComplement())
+                         .getUnion(Sieve(range, 2, 0).getIntersection(
+                             Sieve(range, 5, 3)));
+
+        auto isMember = [](int n) {
+            auto modulo = [](int n, int m) { return ((n % m) + m) % m; };
+            return ((modulo(n, 3) == 1 || modulo(n, 100) == 7) &&
+                    modulo(n, 7) != 0) ||
+                   (modulo(n, 2) == 0 && modulo(n, 5) == 3);
+        };
+
+        THEN("Members, ranks and selections match the set operations")
+        {
+            std::vector<int> expected;
+            bool ranksMatch = true;
+            bool containsMatches = true;
+            for(int n = range.start; n <= range.end; n++) {
+                ranksMatch &= sieve.getRank(n) == expected.size();
+                containsMatches &= sieve.contains(n) == isMember(n);
+                if(isMember(n)) {
+                    expected.push_back(n);
+                }
+            }
+
+            bool selectionsMatch = true;
+            for(size_t i = 0; i < expected.size(); i++) {
+                selectionsMatch &= sieve.getNumber(i) == expected[i];
+            }
+
+            REQUIRE(sieve.getNumbers() == expected);
+            REQUIRE(sieve.getSize() == expected.size());
+            REQUIRE(ranksMatch);
+            REQUIRE(containsMatches);
+            REQUIRE(selectionsMatch);
+        }
+    }
+
+    GIVEN("A sparse sieve over a very large range")
+    {
+        Range range(0, 9999999);
+        auto sieve =
+            Sieve(range, 1000003, 5).getUnion(Sieve(range, 2499999, 0));
+
+        THEN("Members are selected across long runs of empty words")
+        {
+            REQUIRE(sieve.getNumbers() ==
+                    std::vector<int> {0,
+                                      5,
+                                      1000008,
+                                      2000011,
+                                      2499999,
+                                      3000014,
+                                      4000017,
+                                      4999998,
+                                      5000020,
+                                      6000023,
+                                      7000026,
+                                      7499997,
+                                      8000029,
+                                      9000032,
+                                      9999996});
+            REQUIRE(sieve.getNumber(7) == 4999998);
+            REQUIRE(sieve.getRank(9999999) == 15);
+        }
+    }
+
+    GIVEN("A sieve used as the source of a CollectionsProducer")
+    {
+        auto sieve = Sieve(Range(0, 11), 12, 0)
+                         .getUnion(Sieve(Range(0, 11), 12, 4))
+                         .getUnion(Sieve(Range(0, 11), 12, 7));
+
+        CollectionsProducer<int> producer(sieve.getNumbers(),
+                                          std::make_unique<Cycle>());
+
+        THEN("Items are the members of the sieve")
+        {
+            REQUIRE(producer.getCollection(4) == std::vector<int> {0, 4, 7, 0});
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#include "Sieved.hpp"
+
+#include <catch2/catch.hpp>
+#include <stdexcept>
+
+SCENARIO("TimeDomain::Sieved")
+{
+    using namespace aleatoric;
+
+    GIVEN("The class is instantiated with a sieve that includes 0")
+    {
+        THEN("A standard invalid_argument exception is thrown")
+        {
+            REQUIRE_THROWS_WITH(
+                Sieved(Sieve(Range(0, 100), 10, 0)),
+                "The range of the sieve supplied must have a start value "
+                "equal to, or greater than, 1");
+        }
+    }
+
+    GIVEN("The class is instantiated")
+    {
+        Range range(1, 1000000);
+        auto sieve =
+            Sieve(range, 250000, 0).getUnion(Sieve(range, 300000, 1000));
+        Sieved instance(sieve);
+
+        WHEN("The size of the duration collection is requested")
+        {
+            THEN("It is the number of members of the sieve")
+            {
+                REQUIRE(instance.getCollectionSize() == 8);
+            }
+        }
+
+        WHEN("Each duration is requested")
+        {
+            THEN("It matches the members of the sieve in order")
+            {
+                std::vector<int> expected {1000,
+                                           250000,
+                                           301000,
+                                           500000,
+                                           601000,
+                                           750000,
+                                           901000,
+                                           1000000};
+
+                REQUIRE(instance.getSelectableDurations() == expected);
+                for(int i = 0; i < 8; i++) {
+                    REQUIRE(instance.getDuration(i) == expected[i]);
+                }
+#ifndef ALEATORIC_UNCHECKED_ACCESS
+                REQUIRE_THROWS_AS(instance.getDuration(8), std::out_of_range);
+#endif
+            }
+        }
+    }
+
+    GIVEN("The factory is used")
+    {
+        auto instance =
+            DurationProtocol::createSieved(Sieve(Range(1, 20), 5, 0));
+
+        THEN("Durations are the members of the sieve")
+        {
+            REQUIRE(instance->getSelectableDurations() ==
+                    std::vector<int> {5, 10, 15, 20});
+        }
+    }
+}
@@ -1,19 +1,17 @@
 #include "Subset.hpp"
 
-#include "DiscreteGenerator.hpp"
-#include "DiscreteGeneratorMock.hpp"
 #include "Range.hpp"
 #include "UniformGenerator.hpp"
 #include "UniformGeneratorMock.hpp"
 
+#include <algorithm>
 #include <catch2/catch.hpp>
 
 SCENARIO("Numbers::Subset: default constructor")
 {
     using namespace aleatoric;
 
-    Subset instance(std::make_unique<UniformGenerator>(),
-                    std::make_unique<DiscreteGenerator>());
+    Subset instance(std::make_unique<UniformGenerator>());
 
     THEN("Params are set to defaults")
     {
@@ -61,7 +59,6 @@ SCENARIO("Numbers::Subset")
                 int invalidSubsetMin = 0;
 
                 REQUIRE_THROWS_AS(Subset(std::make_unique<UniformGenerator>(),
-                                         std::make_unique<DiscreteGenerator>(),
                                          Range(0, 9),
                                          invalidSubsetMin,
                                          9),
@@ -77,7 +74,6 @@ SCENARIO("Numbers::Subset")
                 int invalidMax = 6;
 
                 REQUIRE_THROWS_AS(Subset(std::make_unique<UniformGenerator>(),
-                                         std::make_unique<DiscreteGenerator>(),
                                          Range(0, 9),
                                          invalidMin,
                                          invalidMax),
@@ -92,7 +88,6 @@ SCENARIO("Numbers::Subset")
                 int invalidSubsetMax = 11;
 
                 REQUIRE_THROWS_AS(Subset(std::make_unique<UniformGenerator>(),
-                                         std::make_unique<DiscreteGenerator>(),
                                          Range(0, 9),
                                          1,
                                          invalidSubsetMax),
@@ -122,24 +117,20 @@ SCENARIO("Numbers::Subset")
                 REQUIRE_CALL(*uniformGeneratorPointer,
                              setDistribution(subSetMin, subSetMax));
 
+                ALLOW_CALL(*uniformGeneratorPointer, getNumber()).RETURN(0);
                 REQUIRE_CALL(*uniformGeneratorPointer, getNumber()).RETURN(1);
 
                 Subset(std::move(uniformGenerator),
-                       std::make_unique<DiscreteGenerator>(),
                        range,
                        subSetMin,
                        subSetMax);
             }
 
-            THEN("The subset collection should be filled with non-repeated "
-                 "numbers from the range supplied")
+            THEN("The subset collection should be filled using Floyd's "
+                 "algorithm, drawing once for each of the last indices of the "
+                 "range")
             {
-                // NB: the offset is added to each element in the subset here,
-                // but is not testable until the point at which a number is
-                // requested - see below
-
                 const int selectedSubsetSize = 5;
-                int numberSelectedByDiscreteGenerator = 1;
 
                 Range range(1, 10);
 
@@ -149,29 +140,20 @@ SCENARIO("Numbers::Subset")
 
                 ALLOW_CALL(*uniformGeneratorPointer,
                            setDistribution(ANY(int), ANY(int)));
+                ALLOW_CALL(*uniformGeneratorPointer, getNumber()).RETURN(1);
+
+                // selectedSubsetSize draws, one for each of the last
+                // indices of the range
+                REQUIRE_CALL(*uniformGeneratorPointer, setDistribution(0, 5));
+                REQUIRE_CALL(*uniformGeneratorPointer, setDistribution(0, 6));
+                REQUIRE_CALL(*uniformGeneratorPointer, setDistribution(0, 7));
+                REQUIRE_CALL(*uniformGeneratorPointer, setDistribution(0, 8));
+                REQUIRE_CALL(*uniformGeneratorPointer, setDistribution(0, 9));
 
                 REQUIRE_CALL(*uniformGeneratorPointer, getNumber())
                     .RETURN(selectedSubsetSize);
 
-                auto discreteGenerator =
-                    std::make_unique<DiscreteGeneratorMock>();
-                auto discreteGeneratorPointer = discreteGenerator.get();
-
-                REQUIRE_CALL(*discreteGeneratorPointer,
-                             setDistributionVector(range.size, 1.0));
-
-                REQUIRE_CALL(*discreteGeneratorPointer, getNumber())
-                    .TIMES(selectedSubsetSize)
-                    .RETURN(numberSelectedByDiscreteGenerator);
-
-                REQUIRE_CALL(
-                    *discreteGeneratorPointer,
-                    updateDistributionVector(numberSelectedByDiscreteGenerator,
-                                             0.0))
-                    .TIMES(selectedSubsetSize);
-
                 Subset(std::move(uniformGenerator),
-                       std::move(discreteGenerator),
                        range,
                        subSetMin,
                        subSetMax);
@@ -191,6 +173,7 @@ SCENARIO("Numbers::Subset")
                 ALLOW_CALL(*uniformGeneratorPointer,
                            setDistribution(ANY(int), ANY(int)));
 
+                ALLOW_CALL(*uniformGeneratorPointer, getNumber()).RETURN(0);
                 REQUIRE_CALL(*uniformGeneratorPointer, getNumber())
                     .RETURN(selectedSubsetSize);
 
@@ -198,7 +181,6 @@ SCENARIO("Numbers::Subset")
                              setDistribution(0, selectedSubsetSize - 1));
 
                 Subset(std::move(uniformGenerator),
-                       std::make_unique<DiscreteGenerator>(),
                        range,
                        subSetMin,
                        subSetMax);
@@ -213,7 +195,7 @@ SCENARIO("Numbers::Subset")
             int subSetMin = 4;
             int subSetMax = 7;
             const int selectedSubsetSize = 5;
-            int numberSelectedByDiscreteGenerator = 1;
+            int indexSelectedForSubset = 1;
 
             Range range(1, 10);
 
@@ -223,25 +205,13 @@ SCENARIO("Numbers::Subset")
             ALLOW_CALL(*uniformGeneratorPointer,
                        setDistribution(ANY(int), ANY(int)));
 
+            ALLOW_CALL(*uniformGeneratorPointer, getNumber())
+                .RETURN(indexSelectedForSubset);
+
             REQUIRE_CALL(*uniformGeneratorPointer, getNumber())
                 .RETURN(selectedSubsetSize);
 
-            auto discreteGenerator = std::make_unique<DiscreteGeneratorMock>();
-            auto discreteGeneratorPointer = discreteGenerator.get();
-
-            ALLOW_CALL(*discreteGeneratorPointer,
-                       setDistributionVector(range.size, 1.0));
-
-            ALLOW_CALL(*discreteGeneratorPointer, getNumber())
-                .RETURN(numberSelectedByDiscreteGenerator);
-
-            ALLOW_CALL(
-                *discreteGeneratorPointer,
-                updateDistributionVector(numberSelectedByDiscreteGenerator,
-                                         0.0));
-
             Subset instance(std::move(uniformGenerator),
-                            std::move(discreteGenerator),
                             range,
                             subSetMin,
                             subSetMax);
@@ -249,24 +219,35 @@ SCENARIO("Numbers::Subset")
             THEN("It should select an item from the subset collection "
                  "using a generated number as the index to select")
             {
-                REQUIRE_CALL(*uniformGeneratorPointer, getNumber()).RETURN(1);
+                REQUIRE_CALL(*uniformGeneratorPointer, getNumber()).RETURN(0);
 
                 instance.getIntegerNumber();
             }
 
-            THEN("The number returned should be the result of the number "
-                 "generated by the discrete generator in filling the subset "
-                 "with the range offset added")
+            THEN("The number returned should be the index selected in filling "
+                 "the subset with the range offset added")
             {
                 // NB: this is testing something that actually happens in the
                 // constructor but is only testable when a number is requested
 
-                REQUIRE_CALL(*uniformGeneratorPointer, getNumber()).RETURN(1);
+                REQUIRE_CALL(*uniformGeneratorPointer, getNumber()).RETURN(0);
 
                 auto returnedNumber = instance.getIntegerNumber();
 
                 REQUIRE(returnedNumber ==
-                        numberSelectedByDiscreteGenerator + range.offset);
+                        indexSelectedForSubset + range.offset);
+            }
+
+            THEN("Indices already in the subset are replaced by the index "
+                 "being drawn for, so the subset has no repetition")
+            {
+                std::vector<int> expectedSubset {2, 7, 8, 9, 10};
+
+                for(int i = 0; i < selectedSubsetSize; i++) {
+                    REQUIRE_CALL(*uniformGeneratorPointer, getNumber())
+                        .RETURN(i);
+                    REQUIRE(instance.getIntegerNumber() == expectedSubset[i]);
+                }
             }
         }
     }
@@ -280,7 +261,6 @@ SCENARIO("Numbers::subset: params")
     int subsetMax = 8;
 
     Subset instance(std::make_unique<UniformGenerator>(),
-                    std::make_unique<DiscreteGenerator>(),
                     Range(1, 10),
                     subsetMin,
                     subsetMax);
@@ -403,3 +383,31 @@ SCENARIO("Numbers::subset: params")
         }
     }
 }
+
+SCENARIO("Numbers::Subset: very large range")
+{
+    using namespace aleatoric;
+
+    Range range(0, 99999999);
+    Subset instance(std::make_unique<UniformGenerator>(), range, 8, 8);
+
+    WHEN("A set of numbers is gathered")
+    {
+        std::vector<int> set(1000);
+        for(auto &&i : set) {
+            i = instance.getIntegerNumber();
+        }
+
+        THEN("Exactly the subset size of unique numbers within the range are "
+             "produced")
+        {
+            std::sort(set.begin(), set.end());
+            set.erase(std::unique(set.begin(), set.end()), set.end());
+
+            REQUIRE(set.size() == 8);
+            for(auto &&i : set) {
+                REQUIRE(range.numberIsInRange(i));
+            }
+        }
+    }
+}
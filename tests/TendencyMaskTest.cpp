@@ -0,0 +1,205 @@
+#include "TendencyMask.hpp"
+
+#include "Cycle.hpp"
+#include "GranularWalk.hpp"
+#include "Range.hpp"
+#include "UniformRealGenerator.hpp"
+
+#include <catch2/catch.hpp>
+
+SCENARIO("Numbers::TendencyMask: default constructor")
+{
+    using namespace aleatoric;
+
+    TendencyMask instance(std::make_unique<Cycle>(Range(0, 4)));
+
+    THEN("Params are set to defaults")
+    {
+        auto params = instance.getParams();
+        auto lower = params.protocols.getTendencyMask().getLowerEnvelope();
+        auto upper = params.protocols.getTendencyMask().getUpperEnvelope();
+
+        REQUIRE(params.getRange().start == 0);
+        REQUIRE(params.getRange().end == 1);
+        REQUIRE(lower.size() == 1);
+        REQUIRE(lower[0].step == 0);
+        REQUIRE(lower[0].value == 0.0);
+        REQUIRE(upper.size() == 1);
+        REQUIRE(upper[0].step == 0);
+        REQUIRE(upper[0].value == 1.0);
+    }
+
+    THEN("The source is scaled from its range to the whole range")
+    {
+        REQUIRE(instance.getDecimalCollection(5) ==
+                std::vector<double> {0.0, 0.25, 0.5, 0.75, 1.0});
+    }
+}
+
+SCENARIO("Numbers::TendencyMask")
+{
+    using namespace aleatoric;
+
+    GIVEN("Construction: with invalid envelopes")
+    {
+        Range range(0, 100);
+        auto create = [&](std::vector<Breakpoint> lower,
+                          std::vector<Breakpoint> upper) {
+            TendencyMask(std::make_unique<Cycle>(Range(0, 4)),
+                         range,
+                         lower,
+                         upper);
+        };
+
+        THEN("An envelope that does not start at step 0 throws")
+        {
+            REQUIRE_THROWS_WITH(create({}, {{0, 100.0}}),
+                                "Envelopes must start at step 0");
+            REQUIRE_THROWS_WITH(create({{0, 0.0}}, {{1, 100.0}}),
+                                "Envelopes must start at step 0");
+        }
+
+        THEN("An envelope with steps that do not increase throws")
+        {
+            REQUIRE_THROWS_WITH(
+                create({{0, 0.0}, {5, 10.0}, {5, 20.0}}, {{0, 100.0}}),
+                "Envelope steps must be strictly increasing");
+        }
+
+        THEN("An envelope with values outside the range throws")
+        {
+            REQUIRE_THROWS_WITH(create({{0, -1.0}}, {{0, 100.0}}),
+                                "Envelope values must be within the range");
+        }
+
+        THEN("A lower envelope that rises above the upper envelope throws")
+        {
+            REQUIRE_THROWS_WITH(
+                create({{0, 0.0}, {10, 60.0}}, {{0, 50.0}}),
+                "The lower envelope must not rise above the upper envelope");
+        }
+    }
+
+    GIVEN("The object is constructed")
+    {
+        // The source produces 0, 1, 2, 3, 4, 0, 1...
+        Range range(0, 100);
+        std::vector<Breakpoint> lower {{0, 0.0}, {4, 40.0}};
+        std::vector<Breakpoint> upper {{0, 100.0}};
+        std::vector<double> expected {0.0, 32.5, 60.0, 82.5, 100.0, 40.0, 55.0};
+
+        TendencyMask instance(std::make_unique<Cycle>(Range(0, 4)),
+                              range,
+                              lower,
+                              upper);
+
+        THEN("Numbers are scaled to lie between the bounds at each step, "
+             "holding the final values after the last breakpoint")
+        {
+            for(auto number : expected) {
+                REQUIRE(instance.getDecimalNumber() == Approx(number));
+            }
+        }
+
+        THEN("Collections follow the envelopes in the same way")
+        {
+            auto collection = instance.getDecimalCollection(7);
+
+            for(size_t i = 0; i < expected.size(); i++) {
+                REQUIRE(collection[i] == Approx(expected[i]));
+            }
+        }
+
+        THEN("Integer numbers are rounded")
+        {
+            REQUIRE(instance.getIntegerCollection(4) ==
+                    std::vector<int> {0, 33, 60, 83});
+        }
+    }
+
+    GIVEN("A source of random numbers and a narrowing mask")
+    {
+        Range range(0, 1000);
+        TendencyMask instance(
+            std::make_unique<GranularWalk>(
+                std::make_unique<UniformRealGenerator>(),
+                Range(0, 1),
+                1.0),
+            range,
+            {{0, 0.0}, {10000, 500.0}},
+            {{0, 1000.0}, {10000, 510.0}});
+
+        THEN("Every number lies within the mask at its step")
+        {
+            auto numbers = instance.getDecimalCollection(20000);
+
+            bool withinMask = true;
+            for(int i = 0; i < 20000; i++) {
+                auto step = std::min(i, 10000) / 10000.0;
+                auto lower = 500.0 * step;
+                auto upper = 1000.0 - 490.0 * step;
+                withinMask &=
+                    numbers[i] >= lower - 1e-9 && numbers[i] <= upper + 1e-9;
+            }
+
+            REQUIRE(withinMask);
+        }
+    }
+}
+
+SCENARIO("Numbers::TendencyMask: params")
+{
+    using namespace aleatoric;
+
+    TendencyMask instance(std::make_unique<Cycle>(Range(0, 4)),
+                          Range(0, 100),
+                          {{0, 0.0}, {4, 40.0}},
+                          {{0, 100.0}});
+
+    WHEN("Get params")
+    {
+        auto params = instance.getParams();
+        auto lower = params.protocols.getTendencyMask().getLowerEnvelope();
+
+        THEN("Reflects object state")
+        {
+            REQUIRE(params.getRange().start == 0);
+            REQUIRE(params.getRange().end == 100);
+            REQUIRE(lower.size() == 2);
+            REQUIRE(lower[1].step == 4);
+            REQUIRE(lower[1].value == 40.0);
+            REQUIRE(params.protocols.getActiveProtocol() ==
+                    NumberProtocol::Type::tendencyMask);
+        }
+    }
+
+    WHEN("Set params")
+    {
+        instance.getDecimalCollection(3);
+
+        THEN("Invalid envelopes throw and leave the object as it was")
+        {
+            REQUIRE_THROWS_AS(
+                instance.setParams(NumberProtocolConfig(
+                    Range(0, 10),
+                    NumberProtocolParams(
+                        TendencyMaskParams({{0, 0.0}}, {{0, 100.0}})))),
+                std::invalid_argument);
+            REQUIRE(instance.getParams().getRange().end == 100);
+        }
+
+        THEN("The envelopes restart from step 0 with the source unchanged")
+        {
+            instance.setParams(NumberProtocolConfig(
+                Range(10, 20),
+                NumberProtocolParams(TendencyMaskParams({{0, 10.0}},
+                                                        {{0, 20.0}}))));
+
+            REQUIRE(instance.getParams().getRange().start == 10);
+            // the source continues from 3
+            REQUIRE(instance.getDecimalNumber() == 17.5);
+            REQUIRE(instance.getDecimalNumber() == 20.0);
+            REQUIRE(instance.getDecimalNumber() == 10.0);
+        }
+    }
+}
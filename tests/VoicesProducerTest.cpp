@@ -0,0 +1,252 @@
+#include "VoicesProducer.hpp"
+
+#include "Basic.hpp"
+#include "Cycle.hpp"
+#include "Range.hpp"
+#include "UniformGenerator.hpp"
+#include "UniformGeneratorMock.hpp"
+#include "Walk.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+std::vector<std::unique_ptr<aleatoric::NumberProtocol>>
+makeBasicVoices(int numberOfVoices, aleatoric::Range range)
+{
+    std::vector<std::unique_ptr<aleatoric::NumberProtocol>> voices;
+    for(int i = 0; i < numberOfVoices; i++) {
+        voices.push_back(std::make_unique<aleatoric::Basic>(
+            std::make_unique<aleatoric::UniformGenerator>(), range));
+    }
+    return voices;
+}
+
+// A voice whose first proposal is number
+std::unique_ptr<aleatoric::NumberProtocol> makeVoiceStartingAt(int number)
+{
+    return std::make_unique<aleatoric::Cycle>(
+        aleatoric::Range(number, number + 1));
+}
+
+bool areApart(std::vector<int> numbers, int minimumDistance)
+{
+    std::sort(numbers.begin(), numbers.end());
+    for(size_t i = 1; i < numbers.size(); i++) {
+        if(numbers[i] - numbers[i - 1] < minimumDistance) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+SCENARIO("VoicesProducer")
+{
+    using namespace aleatoric;
+
+    Range range(1, 10);
+
+    GIVEN("Construction: with invalid arguments")
+    {
+        THEN("Throws")
+        {
+            REQUIRE_THROWS_WITH(
+                VoicesProducer(makeBasicVoices(0, range),
+                               std::make_unique<UniformGenerator>(),
+                               range,
+                               1),
+                "The number of voices must be greater than 0");
+            REQUIRE_THROWS_WITH(
+                VoicesProducer(makeBasicVoices(2, range),
+                               std::make_unique<UniformGenerator>(),
+                               range,
+                               -1),
+                "The minimum distance must be 0 or greater");
+            REQUIRE_THROWS_WITH(
+                VoicesProducer(makeBasicVoices(4, range),
+                               std::make_unique<UniformGenerator>(),
+                               range,
+                               4),
+                "The range is too small for the voices to be the minimum "
+                "distance apart");
+            REQUIRE_NOTHROW(VoicesProducer(makeBasicVoices(4, range),
+                                           std::make_unique<UniformGenerator>(),
+                                           range,
+                                           3));
+        }
+    }
+
+    GIVEN("Distinct voices")
+    {
+        VoicesProducer instance(makeBasicVoices(4, Range(1, 4)),
+                                std::make_unique<UniformGenerator>(),
+                                Range(1, 4),
+                                1);
+
+        THEN("Every step is a permutation of the range")
+        {
+            bool permutations = true;
+            for(auto numbers : instance.getIntegerCollection(1000)) {
+                std::sort(numbers.begin(), numbers.end());
+                permutations &= numbers == std::vector<int> {1, 2, 3, 4};
+            }
+            REQUIRE(permutations);
+        }
+    }
+
+    GIVEN("A minimum distance that leaves only one way to fit the voices")
+    {
+        VoicesProducer instance(makeBasicVoices(4, range),
+                                std::make_unique<UniformGenerator>(),
+                                range,
+                                3);
+
+        THEN("Earlier voices leave room for later ones at every step")
+        {
+            bool fitted = true;
+            for(auto numbers : instance.getIntegerCollection(1000)) {
+                std::sort(numbers.begin(), numbers.end());
+                fitted &= numbers == std::vector<int> {1, 4, 7, 10};
+            }
+            REQUIRE(fitted);
+        }
+    }
+
+    GIVEN("Voices whose proposals are already far enough apart")
+    {
+        std::vector<std::unique_ptr<NumberProtocol>> voices;
+        voices.push_back(std::make_unique<Cycle>(Range(1, 3)));
+        voices.push_back(std::make_unique<Cycle>(Range(6, 8)));
+        VoicesProducer instance(std::move(voices),
+                                std::make_unique<UniformGenerator>(),
+                                range,
+                                3);
+
+        THEN("The proposals are used")
+        {
+            auto collection = instance.getIntegerCollection(3);
+            REQUIRE(collection[0] == std::vector<int> {1, 6});
+            REQUIRE(collection[1] == std::vector<int> {2, 7});
+            REQUIRE(collection[2] == std::vector<int> {3, 8});
+        }
+    }
+
+    GIVEN("Voices whose proposals collide")
+    {
+        auto generator = std::make_unique<UniformGeneratorMock>();
+        auto generatorPointer = generator.get();
+        REQUIRE_CALL(*generatorPointer, setDistribution(0, 1));
+
+        std::vector<std::unique_ptr<NumberProtocol>> voices;
+        voices.push_back(makeVoiceStartingAt(5));
+        voices.push_back(makeVoiceStartingAt(5));
+        voices.push_back(makeVoiceStartingAt(4));
+        VoicesProducer instance(std::move(voices),
+                                std::move(generator),
+                                range,
+                                2);
+
+        THEN("Later voices take the nearest number far enough away, with the "
+             "generator choosing between two equally near")
+        {
+            REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(1);
+            instance.step();
+            REQUIRE(instance.getIntegerNumbers() == std::vector<int> {5, 7, 3});
+        }
+    }
+
+    GIVEN("A minimum distance of 0")
+    {
+        std::vector<std::unique_ptr<NumberProtocol>> voices;
+        voices.push_back(makeVoiceStartingAt(5));
+        voices.push_back(makeVoiceStartingAt(5));
+        voices.push_back(makeVoiceStartingAt(12));
+        VoicesProducer instance(std::move(voices),
+                                std::make_unique<UniformGenerator>(),
+                                range,
+                                0);
+
+        THEN("Voices coincide, with proposals outside the range moved to the "
+             "nearest number within it")
+        {
+            instance.step();
+            REQUIRE(instance.getIntegerNumbers() ==
+                    std::vector<int> {5, 5, 10});
+        }
+    }
+
+    GIVEN("Many voices over a wide range")
+    {
+        Range wideRange(0, 200);
+        std::vector<std::unique_ptr<NumberProtocol>> voices;
+        for(int i = 0; i < 24; i++) {
+            voices.push_back(
+                std::make_unique<Walk>(std::make_unique<UniformGenerator>(),
+                                       Range(40, 160),
+                                       6));
+        }
+        VoicesProducer instance(std::move(voices),
+                                std::make_unique<UniformGenerator>(),
+                                wideRange,
+                                5);
+
+        THEN("Every step keeps the voices apart and within the range")
+        {
+            bool apart = true;
+            bool inRange = true;
+            for(auto &&numbers : instance.getIntegerCollection(5000)) {
+                apart &= areApart(numbers, 5);
+                for(auto number : numbers) {
+                    inRange &= wideRange.numberIsInRange(number);
+                }
+            }
+            REQUIRE(apart);
+            REQUIRE(inRange);
+        }
+    }
+
+    WHEN("Get and set params")
+    {
+        std::vector<std::unique_ptr<NumberProtocol>> voices;
+        voices.push_back(std::make_unique<Cycle>(Range(1, 3)));
+        voices.push_back(
+            std::make_unique<Basic>(std::make_unique<UniformGenerator>()));
+        VoicesProducer instance(std::move(voices),
+                                std::make_unique<UniformGenerator>(),
+                                range,
+                                1);
+
+        THEN("The params of each voice are those of its protocol")
+        {
+            REQUIRE(instance.getNumberOfVoices() == 2);
+            REQUIRE(instance.getRange().end == 10);
+            REQUIRE(instance.getParams(0).protocols.getActiveProtocol() ==
+                    NumberProtocol::Type::cycle);
+            REQUIRE(instance.getParams(1).protocols.getActiveProtocol() ==
+                    NumberProtocol::Type::basic);
+            REQUIRE_THROWS_WITH(instance.getParams(2),
+                                "The voice must be between 0 and 1");
+        }
+
+        THEN("Params are set on the protocol of the voice")
+        {
+            NumberProtocolConfig cycleParams(
+                Range(4, 6),
+                NumberProtocolParams(CycleParams(false, false)));
+            instance.setParams(0, cycleParams);
+            REQUIRE(instance.getParams(0).getRange().start == 4);
+            REQUIRE_THROWS_AS(instance.setParams(1, cycleParams),
+                              std::invalid_argument);
+        }
+
+        THEN("The minimum distance can be changed")
+        {
+            instance.setMinimumDistance(9);
+            REQUIRE(instance.getMinimumDistance() == 9);
+            REQUIRE_THROWS_AS(instance.setMinimumDistance(10),
+                              std::invalid_argument);
+            REQUIRE(instance.getMinimumDistance() == 9);
+        }
+    }
+}
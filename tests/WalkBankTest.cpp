@@ -0,0 +1,193 @@
+#include "WalkBank.hpp"
+
+#include "Range.hpp"
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <cstdlib>
+#include <set>
+
+SCENARIO("Numbers::WalkBank: default constructor")
+{
+    using namespace aleatoric;
+
+    WalkBank instance(4);
+
+    THEN("Every voice has default params")
+    {
+        REQUIRE(instance.getNumberOfVoices() == 4);
+
+        for(int voice = 0; voice < 4; voice++) {
+            auto params = instance.getParams(voice);
+            REQUIRE(params.getRange().start == 0);
+            REQUIRE(params.getRange().end == 1);
+            REQUIRE(params.protocols.getWalk().getMaxStep() == 1);
+        }
+    }
+}
+
+SCENARIO("Numbers::WalkBank")
+{
+    using namespace aleatoric;
+
+    GIVEN("Construction: with invalid arguments")
+    {
+        THEN("A number of voices less than 1 throws")
+        {
+            REQUIRE_THROWS_WITH(WalkBank(0, Range(1, 10), 2),
+                                "The number of voices must be greater than 0");
+        }
+
+        THEN("A maxStep greater than the range size throws")
+        {
+            REQUIRE_THROWS_WITH(WalkBank(2, Range(1, 10), 11),
+                                "The value passed as argument for maxStep must "
+                                "be less than or equal to 10");
+        }
+    }
+
+    GIVEN("The object is constructed")
+    {
+        Range range(1, 100);
+        int maxStep = 3;
+        int numberOfVoices = 500;
+        WalkBank instance(numberOfVoices, range, maxStep);
+
+        WHEN("The first step is taken")
+        {
+            instance.step();
+            auto numbers = instance.getIntegerNumbers();
+
+            THEN("Each voice selects from the whole range")
+            {
+                REQUIRE(static_cast<int>(numbers.size()) == numberOfVoices);
+
+                for(auto &&number : numbers) {
+                    REQUIRE(range.numberIsInRange(number));
+                }
+
+                // with 500 voices, far more than a single sub-range's worth of
+                // numbers will be present
+                std::set<int> distinct(numbers.begin(), numbers.end());
+                REQUIRE(distinct.size() > 50);
+            }
+        }
+
+        WHEN("Further steps are taken")
+        {
+            instance.step();
+
+            THEN("Each voice moves no further than the max step and stays "
+                 "within the range")
+            {
+                bool stepsWithinMaxStep = true;
+                bool numbersWithinRange = true;
+
+                for(int i = 0; i < 100; i++) {
+                    auto previous = instance.getIntegerNumbers();
+                    instance.step();
+                    auto current = instance.getIntegerNumbers();
+
+                    for(int voice = 0; voice < numberOfVoices; voice++) {
+                        stepsWithinMaxStep &=
+                            std::abs(current[voice] - previous[voice]) <=
+                            maxStep;
+                        numbersWithinRange &=
+                            range.numberIsInRange(current[voice]);
+                    }
+                }
+
+                REQUIRE(stepsWithinMaxStep);
+                REQUIRE(numbersWithinRange);
+            }
+        }
+
+        WHEN("Params are set for a single voice")
+        {
+            instance.step();
+            auto numbersBefore = instance.getIntegerNumbers();
+
+            Range newRange(1000, 1010);
+            instance.setParams(
+                2,
+                NumberProtocolConfig(newRange,
+                                     NumberProtocolParams(WalkParams(1))));
+
+            THEN("Only that voice's params are updated")
+            {
+                auto params = instance.getParams(2);
+                REQUIRE(params.getRange().start == newRange.start);
+                REQUIRE(params.getRange().end == newRange.end);
+                REQUIRE(params.protocols.getWalk().getMaxStep() == 1);
+                REQUIRE(params.protocols.getActiveProtocol() ==
+                        NumberProtocol::Type::walk);
+
+                auto otherParams = instance.getParams(3);
+                REQUIRE(otherParams.getRange().start == range.start);
+                REQUIRE(otherParams.getRange().end == range.end);
+                REQUIRE(otherParams.protocols.getWalk().getMaxStep() ==
+                        maxStep);
+            }
+
+            THEN("A voice whose last number is outside its new range selects "
+                 "from the whole new range")
+            {
+                instance.step();
+                auto numbers = instance.getIntegerNumbers();
+                REQUIRE(newRange.numberIsInRange(numbers[2]));
+
+                for(int voice = 0; voice < numberOfVoices; voice++) {
+                    if(voice != 2) {
+                        REQUIRE(std::abs(numbers[voice] -
+                                         numbersBefore[voice]) <= maxStep);
+                    }
+                }
+            }
+        }
+
+        WHEN("Params are set with a last number within the new range")
+        {
+            instance.step();
+            auto numberBefore = instance.getIntegerNumbers()[0];
+
+            instance.setParams(
+                0,
+                NumberProtocolConfig(range,
+                                     NumberProtocolParams(WalkParams(1))));
+            instance.step();
+
+            THEN("The walk continues from the last number")
+            {
+                REQUIRE(std::abs(instance.getIntegerNumbers()[0] -
+                                 numberBefore) <= 1);
+            }
+        }
+
+        WHEN("Invalid params are set")
+        {
+            THEN("An invalid voice throws")
+            {
+                REQUIRE_THROWS_AS(instance.getParams(numberOfVoices),
+                                  std::invalid_argument);
+                REQUIRE_THROWS_AS(
+                    instance.setParams(
+                        -1,
+                        NumberProtocolConfig(
+                            range,
+                            NumberProtocolParams(WalkParams(1)))),
+                    std::invalid_argument);
+            }
+
+            THEN("An invalid maxStep throws")
+            {
+                REQUIRE_THROWS_AS(
+                    instance.setParams(
+                        0,
+                        NumberProtocolConfig(
+                            Range(1, 3),
+                            NumberProtocolParams(WalkParams(4)))),
+                    std::invalid_argument);
+            }
+        }
+    }
+}
@@ -0,0 +1,242 @@
+#include "WeightedRoundRobin.hpp"
+
+#include "Range.hpp"
+#include "UniformRealGenerator.hpp"
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <numeric>
+
+namespace {
+// Whether, after every number, how often each number has occurred is within 1
+// of its share of the numbers so far
+bool keepsToShares(aleatoric::WeightedRoundRobin &instance,
+                   aleatoric::Range range,
+                   const std::vector<double> &weights,
+                   int size)
+{
+    auto total = std::accumulate(weights.begin(), weights.end(), 0.0);
+    std::vector<int> counts(weights.size(), 0);
+    for(int n = 1; n <= size; n++) {
+        counts[instance.getIntegerNumber() - range.offset]++;
+        for(size_t i = 0; i < weights.size(); i++) {
+            if(std::abs(counts[i] - n * weights[i] / total) >= 1.0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+} // namespace
+
+SCENARIO("Numbers::WeightedRoundRobin: default constructor")
+{
+    using namespace aleatoric;
+
+    WeightedRoundRobin instance(std::make_unique<UniformRealGenerator>());
+
+    THEN("Params are set to defaults")
+    {
+        auto params = instance.getParams();
+        auto range = params.getRange();
+        auto weights = params.protocols.getWeightedRoundRobin().getWeights();
+
+        REQUIRE(range.start == 0);
+        REQUIRE(range.end == 1);
+        REQUIRE(weights == std::vector<double> {1.0, 1.0});
+        REQUIRE(params.protocols.getWeightedRoundRobin().getJitter() == 1.0);
+    }
+
+    THEN("Each pair of numbers holds both numbers")
+    {
+        bool pairs = true;
+        for(int i = 0; i < 1000; i++) {
+            auto first = instance.getIntegerNumber();
+            auto second = instance.getIntegerNumber();
+            pairs &= first + second == 1;
+        }
+        REQUIRE(pairs);
+    }
+}
+
+SCENARIO("Numbers::WeightedRoundRobin")
+{
+    using namespace aleatoric;
+
+    GIVEN("Construction: with invalid params")
+    {
+        THEN("Throws")
+        {
+            REQUIRE_THROWS_WITH(
+                WeightedRoundRobin(std::make_unique<UniformRealGenerator>(),
+                                   Range(1, 3),
+                                   std::vector<double> {1.0, 1.0},
+                                   0.0),
+                "The size of the weights collection must match the size of the "
+                "range");
+            REQUIRE_THROWS_WITH(
+                WeightedRoundRobin(std::make_unique<UniformRealGenerator>(),
+                                   Range(1, 3),
+                                   std::vector<double> {1.0, -1.0, 1.0},
+                                   0.0),
+                "Weights must not be negative");
+            REQUIRE_THROWS_WITH(
+                WeightedRoundRobin(std::make_unique<UniformRealGenerator>(),
+                                   Range(1, 3),
+                                   std::vector<double> {0.0, 0.0, 0.0},
+                                   0.0),
+                "At least one weight must be greater than 0");
+            REQUIRE_THROWS_WITH(
+                WeightedRoundRobin(std::make_unique<UniformRealGenerator>(),
+                                   Range(1, 3),
+                                   std::vector<double> {1.0, 1.0, 1.0},
+                                   1.5),
+                "The jitter must be between 0 and 1");
+        }
+    }
+
+    GIVEN("Uneven weights")
+    {
+        Range range(1, 8);
+        std::vector<double> weights {5.0, 0.3, 1.0, 0.0, 2.5, 0.01, 7.0, 1.0};
+
+        THEN("Every prefix keeps to the shares of the weights, whatever the "
+             "jitter, and numbers with a weight of 0 never occur")
+        {
+            for(auto jitter : {0.0, 0.5, 1.0}) {
+                WeightedRoundRobin instance(
+                    std::make_unique<UniformRealGenerator>(),
+                    range,
+                    weights,
+                    jitter);
+                REQUIRE(keepsToShares(instance, range, weights, 20000));
+            }
+        }
+    }
+
+    GIVEN("Many numbers with random weights")
+    {
+        Range range(0, 999);
+        std::vector<double> weights(1000);
+        UniformRealGenerator generator;
+        for(auto &&weight : weights) {
+            weight = std::pow(generator.getNumber(), 4.0);
+        }
+        WeightedRoundRobin instance(std::make_unique<UniformRealGenerator>(),
+                                    range,
+                                    weights,
+                                    1.0);
+
+        THEN("Every prefix keeps to the shares of the weights")
+        {
+            REQUIRE(keepsToShares(instance, range, weights, 5000));
+        }
+    }
+
+    GIVEN("No jitter")
+    {
+        Range range(1, 2);
+        std::vector<double> weights {1.0, 2.0};
+        WeightedRoundRobin instance(std::make_unique<UniformRealGenerator>(),
+                                    range,
+                                    weights,
+                                    0.0);
+
+        THEN("The numbers are evenly interleaved and repeat")
+        {
+            std::vector<int> numbers;
+            for(int i = 0; i < 9; i++) {
+                numbers.push_back(instance.getIntegerNumber());
+            }
+            REQUIRE(numbers == std::vector<int> {2, 1, 2, 2, 1, 2, 2, 1, 2});
+        }
+    }
+
+    GIVEN("Equal weights with full jitter")
+    {
+        Range range(1, 5);
+        WeightedRoundRobin instance(std::make_unique<UniformRealGenerator>(),
+                                    range,
+                                    std::vector<double>(5, 1.0),
+                                    1.0);
+
+        THEN("Each run of five numbers is a permutation of the range, in "
+             "varying orders")
+        {
+            bool permutations = true;
+            std::vector<std::vector<int>> runs;
+            for(int run = 0; run < 200; run++) {
+                std::vector<int> numbers;
+                for(int i = 0; i < 5; i++) {
+                    numbers.push_back(instance.getIntegerNumber());
+                }
+                runs.push_back(numbers);
+                std::sort(numbers.begin(), numbers.end());
+                permutations &= numbers == std::vector<int> {1, 2, 3, 4, 5};
+            }
+            REQUIRE(permutations);
+            std::sort(runs.begin(), runs.end());
+            auto distinct = std::unique(runs.begin(), runs.end());
+            REQUIRE(distinct - runs.begin() > 50);
+        }
+    }
+}
+
+SCENARIO("Numbers::WeightedRoundRobin: params")
+{
+    using namespace aleatoric;
+
+    WeightedRoundRobin instance(std::make_unique<UniformRealGenerator>(),
+                                Range(1, 3),
+                                std::vector<double> {1.0, 2.0, 3.0},
+                                0.5);
+
+    WHEN("Get params")
+    {
+        auto params = instance.getParams();
+
+        THEN("Reflects object state")
+        {
+            auto protocolParams = params.protocols.getWeightedRoundRobin();
+            REQUIRE(params.getRange().start == 1);
+            REQUIRE(params.getRange().end == 3);
+            REQUIRE(protocolParams.getWeights() ==
+                    std::vector<double> {1.0, 2.0, 3.0});
+            REQUIRE(protocolParams.getJitter() == 0.5);
+            REQUIRE(params.protocols.getActiveProtocol() ==
+                    NumberProtocol::Type::weightedRoundRobin);
+        }
+    }
+
+    WHEN("Set params")
+    {
+        Range range(10, 11);
+        std::vector<double> weights {3.0, 1.0};
+        instance.setParams(NumberProtocolConfig(
+            range,
+            NumberProtocolParams(WeightedRoundRobinParams(weights, 0.0))));
+
+        THEN("Object is updated and tracking starts afresh over the new range")
+        {
+            auto params = instance.getParams();
+            REQUIRE(params.getRange().start == 10);
+            REQUIRE(params.protocols.getWeightedRoundRobin().getJitter() ==
+                    0.0);
+            REQUIRE(keepsToShares(instance, range, weights, 1000));
+        }
+    }
+
+    WHEN("Set params: invalid")
+    {
+        THEN("Throw exception")
+        {
+            REQUIRE_THROWS_AS(
+                instance.setParams(NumberProtocolConfig(
+                    Range(1, 4),
+                    NumberProtocolParams(
+                        WeightedRoundRobinParams({1.0, 1.0}, 0.0)))),
+                std::invalid_argument);
+        }
+    }
+}
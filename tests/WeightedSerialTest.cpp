@@ -0,0 +1,200 @@
+#include "WeightedSerial.hpp"
+
+#include "Range.hpp"
+#include "UniformRealGenerator.hpp"
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+
+SCENARIO("Numbers::WeightedSerial: default constructor")
+{
+    using namespace aleatoric;
+
+    WeightedSerial instance(std::make_unique<UniformRealGenerator>());
+
+    THEN("Params are set to defaults")
+    {
+        auto params = instance.getParams();
+        auto range = params.getRange();
+        auto weights = params.protocols.getWeightedSerial().getWeights();
+
+        REQUIRE(range.start == 0);
+        REQUIRE(range.end == 1);
+        REQUIRE(weights == std::vector<double> {1.0, 1.0});
+    }
+
+    THEN("Set of numbers is as per basic serial process")
+    {
+        std::vector<std::vector<int>> possibleResults {{0, 1}, {1, 0}};
+
+        for(int i = 0; i < 1000; i++) {
+            std::vector<int> pair(2);
+            for(auto &&i : pair) {
+                i = instance.getIntegerNumber();
+            }
+
+            REQUIRE_THAT(pair,
+                         Catch::Equals(possibleResults[0]) ||
+                             Catch::Equals(possibleResults[1]));
+        }
+    }
+}
+
+SCENARIO("Numbers::WeightedSerial")
+{
+    using namespace aleatoric;
+
+    GIVEN("Construction: with invalid weights")
+    {
+        THEN("Weights not matching the range size throw")
+        {
+            REQUIRE_THROWS_WITH(
+                WeightedSerial(std::make_unique<UniformRealGenerator>(),
+                               Range(1, 3),
+                               std::vector<double> {1.0, 1.0}),
+                "The size of the weights collection must match the size of the "
+                "range");
+        }
+
+        THEN("Negative weights throw")
+        {
+            REQUIRE_THROWS_WITH(
+                WeightedSerial(std::make_unique<UniformRealGenerator>(),
+                               Range(1, 3),
+                               std::vector<double> {1.0, -1.0, 1.0}),
+                "Weights must not be negative");
+        }
+
+        THEN("Weights that are all 0 throw")
+        {
+            REQUIRE_THROWS_AS(
+                WeightedSerial(std::make_unique<UniformRealGenerator>(),
+                               Range(1, 3),
+                               std::vector<double> {0.0, 0.0, 0.0}),
+                std::invalid_argument);
+        }
+    }
+
+    GIVEN("The object is constructed")
+    {
+        Range range(10, 14);
+        std::vector<double> weights {1.0, 5.0, 0.0, 2.0, 0.5};
+
+        WeightedSerial instance(std::make_unique<UniformRealGenerator>(),
+                                range,
+                                weights);
+
+        WHEN("A number of series are gathered")
+        {
+            std::vector<std::vector<int>> series(100);
+            for(auto &&set : series) {
+                set.resize(4);
+                for(auto &&i : set) {
+                    i = instance.getIntegerNumber();
+                }
+            }
+
+            THEN("Each series contains every number with a weight above 0 "
+                 "exactly once")
+            {
+                for(auto &&set : series) {
+                    REQUIRE_THAT(set,
+                                 Catch::UnorderedEquals(
+                                     std::vector<int> {10, 11, 13, 14}));
+                }
+            }
+        }
+
+        WHEN("The first number of many series is gathered")
+        {
+            std::vector<int> counts(range.size, 0);
+            for(int i = 0; i < 1000; i++) {
+                counts[instance.getIntegerNumber() - range.offset]++;
+                for(int ii = 0; ii < 3; ii++) {
+                    instance.getIntegerNumber();
+                }
+            }
+
+            THEN("The number with the highest weight is most often first")
+            {
+                // probability of the number with weight 5 coming first is
+                // 5 / 8.5, so its count is very likely to be above 500
+                REQUIRE(counts[1] > 500);
+                REQUIRE(counts[2] == 0);
+                REQUIRE(counts[1] ==
+                        *std::max_element(counts.begin(), counts.end()));
+            }
+        }
+    }
+}
+
+SCENARIO("Numbers::WeightedSerial: params")
+{
+    using namespace aleatoric;
+
+    std::vector<double> weights {1.0, 2.0, 3.0};
+    WeightedSerial instance(std::make_unique<UniformRealGenerator>(),
+                            Range(1, 3),
+                            weights);
+
+    WHEN("Get params")
+    {
+        auto params = instance.getParams();
+        auto returnedRange = params.getRange();
+
+        THEN("Reflects object state")
+        {
+            REQUIRE(returnedRange.start == 1);
+            REQUIRE(returnedRange.end == 3);
+            REQUIRE(params.protocols.getWeightedSerial().getWeights() ==
+                    weights);
+            REQUIRE(params.protocols.getActiveProtocol() ==
+                    NumberProtocol::Type::weightedSerial);
+        }
+    }
+
+    WHEN("Set params")
+    {
+        Range newRange(4, 6);
+        std::vector<double> newWeights {0.0, 2.0, 3.0};
+
+        instance.getIntegerNumber();
+        instance.setParams(NumberProtocolConfig(
+            newRange,
+            NumberProtocolParams(WeightedSerialParams(newWeights))));
+
+        THEN("Object is updated")
+        {
+            auto params = instance.getParams();
+            auto returnedRange = params.getRange();
+
+            REQUIRE(returnedRange.start == newRange.start);
+            REQUIRE(returnedRange.end == newRange.end);
+            REQUIRE(params.protocols.getWeightedSerial().getWeights() ==
+                    newWeights);
+        }
+
+        THEN("A new series over the new range is started")
+        {
+            std::vector<int> set(2);
+            for(auto &&i : set) {
+                i = instance.getIntegerNumber();
+            }
+
+            REQUIRE_THAT(set, Catch::UnorderedEquals(std::vector<int> {5, 6}));
+        }
+    }
+
+    WHEN("Set params: weights and range sizes do not match")
+    {
+        NumberProtocolConfig newParams(
+            Range(4, 6),
+            NumberProtocolParams(WeightedSerialParams({1.0, 1.0})));
+
+        THEN("Throw exception")
+        {
+            REQUIRE_THROWS_AS(instance.setParams(newParams),
+                              std::invalid_argument);
+        }
+    }
+}